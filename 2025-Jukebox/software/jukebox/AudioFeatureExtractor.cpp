@@ -0,0 +1,68 @@
+#include "AudioFeatureExtractor.h"
+#include "IntMath.h"
+
+static uint16_t clamp16(uint32_t v) {
+  return v > 0xffff ? 0xffff : (uint16_t)v;
+}
+
+void AudioFeatureExtractor::setRate(int hz) {
+  if (hz <= 0) return;
+  _hz = hz;
+  _hopLen = max(hz / FEATURE_HOPS_PER_SEC, 1);
+  reset();
+}
+
+void AudioFeatureExtractor::reset() {
+  uint8_t beats = _features.beats;
+  memset(&_features, 0, sizeof(_features));
+  _features.beats = beats;
+
+  memset(_lp, 0, sizeof(_lp));
+  _prev = 0;
+  _peak = 0;
+  _energy = 0;
+  _diffEnergy = 0;
+  memset(_bandEnergy, 0, sizeof(_bandEnergy));
+  _count = 0;
+  _bassAverage = 0;
+  _samplesSinceOnset = _hz;
+}
+
+void AudioFeatureExtractor::finishHop() {
+  uint32_t n = _count;
+
+  _features.rms = clamp16(isqrt64(_energy / n));
+  _features.peak = _peak;
+  for (int i = 0; i < PROTOCOL_FEATURE_BANDS; i++)
+    _features.bands[i] = clamp16(isqrt64(_bandEnergy[i] / n));
+
+  // For a tone of frequency f, diffEnergy / energy = (2 sin(pi f / hz))^2,
+  // so f ~ hz / (2 pi) * sqrt(diffEnergy / energy). The ratio is taken in
+  // Q8 and 10430 / 65536 is 1 / (2 pi).
+  if (_energy > 0) {
+    uint64_t ratio = isqrt64((_diffEnergy << 16) / _energy);
+    _features.centroidHz = clamp16(min((uint32_t)((ratio * _hz * 10430) >> 24), (uint32_t)(_hz / 2)));
+  } else {
+    _features.centroidHz = 0;
+  }
+
+  // Onset when the lowest band is half again above its average over the
+  // last ~64 hops
+  uint32_t bass = (uint32_t)min(_bandEnergy[0] / n, (uint64_t)UINT32_MAX);
+  _features.flags = 0;
+  if (_samplesSinceOnset < UINT32_MAX - n) _samplesSinceOnset += n;
+  if (bass > (uint32_t)FEATURE_ONSET_MIN_RMS * FEATURE_ONSET_MIN_RMS &&
+      (uint64_t)bass * 2 > (uint64_t)_bassAverage * 3 &&
+      _samplesSinceOnset >= (uint32_t)(_hz / FEATURE_ONSET_MIN_GAP_HZ)) {
+    _features.flags |= AUDIO_FEATURE_ONSET;
+    _features.beats++;
+    _samplesSinceOnset = 0;
+  }
+  _bassAverage = _bassAverage == 0 ? bass : (uint32_t)((int64_t)_bassAverage + (((int64_t)bass - _bassAverage) >> 6));
+
+  _count = 0;
+  _peak = 0;
+  _energy = 0;
+  _diffEnergy = 0;
+  memset(_bandEnergy, 0, sizeof(_bandEnergy));
+}
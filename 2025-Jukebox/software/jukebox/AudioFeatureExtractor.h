@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+#include <JukeboxProtocol.h>
+
+// Turns the decoded sample stream into an audio_features_packet_t every
+// FEATURE_HOPS_PER_SEC of a second, so the laser controller can follow the
+// music from a 20 byte packet instead of raw samples. Everything per sample
+// is integer adds, shifts and squares; the divisions and square roots
+// happen once per hop.
+//
+// The bands come from three one-pole low-pass filters with cutoffs of
+// about 110 Hz, 440 Hz and 1.8 kHz at 44.1 kHz, and the band energies are
+// the differences between them. The centroid is estimated from the energy
+// of the first difference against the energy of the signal, which for a
+// single tone gives back its frequency. An onset is a jump in the lowest
+// band over its recent average.
+
+#define FEATURE_HOPS_PER_SEC     100
+#define FEATURE_ONSET_MIN_RMS    300   // lowest band, ignored below this
+#define FEATURE_ONSET_MIN_GAP_HZ 4     // at most this many onsets per second
+
+class AudioFeatureExtractor {
+  public:
+    void setRate(int hz);
+    void reset();
+
+    // Adds one mono sample, returns true when a hop has finished and
+    // features() holds its results
+    bool add(int16_t sample) {
+      int32_t x = sample;
+      int32_t x8 = x << 8;
+      _lp[0] += (x8 - _lp[0]) >> 6;
+      _lp[1] += (x8 - _lp[1]) >> 4;
+      _lp[2] += (x8 - _lp[2]) >> 2;
+
+      _energy += square(x);
+      _diffEnergy += square(x - _prev);
+      _bandEnergy[0] += square(_lp[0] >> 8);
+      _bandEnergy[1] += square((_lp[1] - _lp[0]) >> 8);
+      _bandEnergy[2] += square((_lp[2] - _lp[1]) >> 8);
+      _bandEnergy[3] += square(x - (_lp[2] >> 8));
+      _prev = x;
+
+      uint16_t level = (uint16_t)(x < 0 ? -x : x);
+      if (level > _peak) _peak = level;
+
+      if (++_count < _hopLen) return false;
+      finishHop();
+      return true;
+    }
+
+    const audio_features_packet_t &features() const { return _features; }
+
+  private:
+    audio_features_packet_t _features = {};
+    int _hz = 44100;
+    uint32_t _hopLen = 44100 / FEATURE_HOPS_PER_SEC;
+    uint32_t _count = 0;
+
+    int32_t _lp[3] = {0, 0, 0};
+    int32_t _prev = 0;
+    uint16_t _peak = 0;
+    uint64_t _energy = 0;
+    uint64_t _diffEnergy = 0;
+    uint64_t _bandEnergy[PROTOCOL_FEATURE_BANDS] = {0, 0, 0, 0};
+
+    uint32_t _bassAverage = 0;
+    uint32_t _samplesSinceOnset = 44100;
+
+    static uint32_t square(int32_t v) {
+      uint32_t a = (uint32_t)(v < 0 ? -v : v);
+      return a * a;
+    }
+
+    void finishHop();
+};
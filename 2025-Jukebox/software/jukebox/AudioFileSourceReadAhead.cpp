@@ -0,0 +1,86 @@
+#include "AudioFileSourceReadAhead.h"
+
+bool AudioFileSourceReadAhead::open(const char *filename) {
+  reset(0);
+  started = false;
+  minFill = READ_AHEAD_SIZE;
+  underruns = 0;
+  return src->open(filename);
+}
+
+bool AudioFileSourceReadAhead::close() {
+  reset(0);
+  return src->close();
+}
+
+void AudioFileSourceReadAhead::reset(uint32_t pos) {
+  tail = head = start = pos;
+  eof = false;
+}
+
+// Reads up to the next chunk boundary, or less if the ring is that full
+uint32_t AudioFileSourceReadAhead::readChunk() {
+  uint32_t room = READ_AHEAD_SIZE - (head - tail);
+  uint32_t n = READ_AHEAD_CHUNK - (head & (READ_AHEAD_CHUNK - 1));
+  if (n > room) n = room;
+  if (n == 0 || eof) return 0;
+
+  uint32_t got = src->read(ring + (head & (READ_AHEAD_SIZE - 1)), n);
+  head += got;
+  if (got < n) eof = true;
+  return got;
+}
+
+bool AudioFileSourceReadAhead::fill() {
+  if (eof || !src->isOpen()) return false;
+  // Partial chunks are left for when the decoder has made room
+  if (READ_AHEAD_SIZE - (head - tail) < READ_AHEAD_CHUNK - (head & (READ_AHEAD_CHUNK - 1))) return false;
+  started = true;
+  return readChunk() > 0;
+}
+
+uint32_t AudioFileSourceReadAhead::read(void *data, uint32_t len) {
+  uint8_t *out = (uint8_t *)data;
+  uint32_t done = 0;
+  bool missed = false;
+
+  while (done < len) {
+    uint32_t avail = head - tail;
+    if (avail == 0) {
+      missed = true;
+      if (readChunk() == 0) break;
+      continue;
+    }
+    uint32_t index = tail & (READ_AHEAD_SIZE - 1);
+    uint32_t n = len - done;
+    if (n > avail) n = avail;
+    if (n > READ_AHEAD_SIZE - index) n = READ_AHEAD_SIZE - index;
+    memcpy(out + done, ring + index, n);
+    tail += n;
+    done += n;
+  }
+
+  if (started && !eof) {
+    if (missed) underruns++;
+    if (head - tail < minFill) minFill = head - tail;
+  }
+  return done;
+}
+
+// Seeks within what is still buffered are free, anything else drops the
+// ring and seeks the file
+bool AudioFileSourceReadAhead::seek(int32_t pos, int dir) {
+  int32_t target = pos;
+  if (dir == SEEK_CUR) target += (int32_t)tail;
+  else if (dir == SEEK_END) target += (int32_t)getSize();
+  if (target < 0) return false;
+
+  uint32_t oldest = head - start > READ_AHEAD_SIZE ? head - READ_AHEAD_SIZE : start;
+  if ((uint32_t)target >= oldest && (uint32_t)target <= head) {
+    tail = (uint32_t)target;
+    return true;
+  }
+  if (!src->seek(target, SEEK_SET)) return false;
+  reset((uint32_t)target);
+  return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <AudioFileSource.h>
+
+// Bytes buffered ahead of the decoder (~93 ms of 44.1 kHz 16 bit stereo),
+// and the most read from the card at once. Both are multiples of the SD
+// sector size so file reads stay sector aligned.
+#define READ_AHEAD_SIZE    16384
+#define READ_AHEAD_CHUNK   4096
+
+static_assert((READ_AHEAD_SIZE & (READ_AHEAD_SIZE - 1)) == 0, "read-ahead ring must be a power of two");
+static_assert(READ_AHEAD_SIZE % READ_AHEAD_CHUNK == 0, "read-ahead ring must hold whole chunks");
+
+// Ring buffer in front of another source, usually an AudioFileSourceSD.
+// The decoder's small reads are served from RAM, and the card is read a
+// chunk at a time by fill(), which the owner calls when the output has
+// enough buffered to wait for the card. A read that finds the ring empty
+// reads the card itself and counts as an underrun.
+//
+// The ring is indexed by file offset, so a chunk never wraps and the card
+// is always read from a chunk boundary once the first chunk after an open
+// or seek has been read.
+class AudioFileSourceReadAhead : public AudioFileSource
+{
+  public:
+    AudioFileSourceReadAhead(AudioFileSource *source) : src(source) {}
+
+    virtual bool open(const char *filename) override;
+    virtual uint32_t read(void *data, uint32_t len) override;
+    virtual bool seek(int32_t pos, int dir) override;
+    virtual bool close() override;
+    virtual bool isOpen() override { return src->isOpen(); }
+    virtual uint32_t getSize() override { return src->getSize(); }
+    virtual uint32_t getPos() override { return tail; }
+
+    // Reads one chunk from the card if there is room for it, returns false
+    // when there was nothing to do
+    bool fill();
+
+    // Bytes buffered now, and the fewest there have been since the first
+    // fill() after open(), not counting the end of the file
+    uint32_t Fill() const { return head - tail; }
+    uint32_t MinFill() const { return minFill; }
+    // Reads that found the ring empty after the first fill()
+    uint32_t Underruns() const { return underruns; }
+    // True once fill() has run since open(), so the counters mean something
+    bool Started() const { return started; }
+
+  private:
+    AudioFileSource *src;
+    uint8_t ring[READ_AHEAD_SIZE];
+    // File offsets of the next byte for the decoder, of the next byte to
+    // read from the card, and of the first byte read since the last reset
+    uint32_t tail = 0;
+    uint32_t head = 0;
+    uint32_t start = 0;
+    bool eof = false;
+
+    bool started = false;
+    uint32_t minFill = READ_AHEAD_SIZE;
+    uint32_t underruns = 0;
+
+    void reset(uint32_t pos);
+    uint32_t readChunk();
+};
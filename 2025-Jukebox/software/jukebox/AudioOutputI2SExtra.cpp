@@ -1,10 +1,113 @@
 #include "AudioOutputI2SExtra.h"
 
+bool AudioOutputI2SExtra::SetPinout(int bclk, int wclk, int dout) {
+  if (wclk != bclk + 1) return false;
+  bclkPin = bclk;
+  doutPin = dout;
+  return true;
+}
+
+bool AudioOutputI2SExtra::SetRate(int hz) {
+  features.setRate(hz);
+  AudioOutput::SetRate(hz);
+  if (running) i2s.setFrequency(hz);
+  return true;
+}
+
+bool AudioOutputI2SExtra::begin() {
+  if (running) return true;
+  if (bclkPin < 0) return false;
+  i2s.setBCLK(bclkPin);
+  i2s.setDATA(doutPin);
+  i2s.setBitsPerSample(16);
+  i2s.setBuffers(I2S_DMA_BUFFERS, I2S_DMA_BUFFER_WORDS);
+  running = i2s.begin(hertz);
+  stagedFrames = 0;
+  return running;
+}
+
+// I2S keeps running after a song ends. The tail already in the DMA
+// buffers plays out, the next song can follow it without a gap, and I2S
+// plays silence when nothing follows.
+bool AudioOutputI2SExtra::stop() {
+  unsigned long start = millis();
+  while (running && stagedFrames > 0 && millis() - start < 10)
+    flushStaged();
+  stagedFrames = 0;
+  return true;
+}
+
+// Returns false only while a full block is staged and I2S has no room for
+// it, in which case the generator offers the same frame again later
 bool AudioOutputI2SExtra::ConsumeSample(int16_t sample[2]) {
-  if (bps == 8)
-    udpBuffer[udpBufferIndex + 1] = (uint8_t)(sample[0] + 128);
-  else
-    udpBuffer[udpBufferIndex + 1] = (uint8_t)((sample[0] + 32768) >> 8);
-  udpBufferIndex = (udpBufferIndex + 1) % (UDP_AUDIO_BUFF_SIZE - 1);
-  return AudioOutputI2S::ConsumeSample(sample);
+  if (stagedFrames == I2S_BLOCK_FRAMES) {
+    flushStaged();
+    if (stagedFrames == I2S_BLOCK_FRAMES) return false;
+  }
+
+  staged[stagedFrames * 2] = sample[LEFTCHANNEL];
+  staged[stagedFrames * 2 + 1] = sample[RIGHTCHANNEL];
+  if (++stagedFrames == I2S_BLOCK_FRAMES) flushStaged();
+  return true;
+}
+
+void AudioOutputI2SExtra::flushStaged() {
+  if (stagedFrames == 0) return;
+  uint16_t written = ConsumeSamples(staged, stagedFrames);
+  stagedFrames -= written;
+  memmove(staged, staged + written * 2, stagedFrames * 2 * sizeof(int16_t));
+}
+
+// Takes up to I2S_BLOCK_FRAMES frames and returns how many went out. Only
+// those are tapped, the rest are offered again by the caller.
+uint16_t AudioOutputI2SExtra::ConsumeSamples(int16_t *samples, uint16_t count) {
+  if (!running) return 0;
+  uint16_t frames = min(count, (uint16_t)I2S_BLOCK_FRAMES);
+
+  // The format checks happen once per block instead of once per frame
+  bool mono = channels == 1;
+  bool eightBit = bps == 8;
+  int32_t gain = gainF2P6;
+  for (uint16_t i = 0; i < frames; i++) {
+    int32_t l = samples[i * 2];
+    int32_t r = mono ? l : samples[i * 2 + 1];
+    if (eightBit) {
+      // 8 bit WAV samples arrive unsigned
+      l = ((l & 0xff) - 128) << 8;
+      r = ((r & 0xff) - 128) << 8;
+    }
+    block[i * 2] = (int16_t)l;
+    block[i * 2 + 1] = (int16_t)r;
+
+    l = constrain((l * gain) >> 6, -32768, 32767);
+    r = constrain((r * gain) >> 6, -32768, 32767);
+    words[i] = (uint32_t)l << 16 | ((uint32_t)r & 0xffff);
+  }
+
+  uint16_t written = (uint16_t)(i2s.write((const uint8_t *)words, frames * sizeof(uint32_t)) / sizeof(uint32_t));
+  outputFull = written < frames;
+  tap(written);
+  return written;
+}
+
+// Feeds frames that reached I2S, before gain, to the laser taps
+void AudioOutputI2SExtra::tap(uint16_t frames) {
+  uint32_t head = spectrumHead;
+  for (uint16_t i = 0; i < frames; i++) {
+    int16_t l = block[i * 2], r = block[i * 2 + 1];
+    int16_t mono = (int16_t)((l + r) >> 1);
+
+    audioPacket.samples[audioPacketIndex] = (uint8_t)((l + 32768) >> 8);
+    audioPacketIndex = (audioPacketIndex + 1) & (PROTOCOL_AUDIO_SAMPLES - 1);
+    spectrumRing[head++ & (SPECTRUM_RING_SIZE - 1)] = mono;
+
+    if (features.add(mono))
+      featureMailbox.write(features.features());
+  }
+  __atomic_store_n(&spectrumHead, head, __ATOMIC_RELEASE);
+}
+
+void AudioOutputI2SExtra::ClearFeatures() {
+  features.reset();
+  featureMailbox.write(features.features());
 }
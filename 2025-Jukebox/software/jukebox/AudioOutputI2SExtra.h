@@ -1,15 +1,77 @@
 #pragma once
 
-#include <AudioOutputI2S.h>
+#include <AudioOutput.h>
+#include <I2S.h>
+#include <JukeboxProtocol.h>
+#include <Mailbox.h>
+#include "AudioFeatureExtractor.h"
 
-#define UDP_AUDIO_BUFF_SIZE 1025
+// Mono samples kept for the spectrum analysis on the other core, enough
+// for two FFT windows
+#define SPECTRUM_RING_SIZE 2048
 
-class AudioOutputI2SExtra : public AudioOutputI2S
+// Frames handled per block, and the DMA buffering behind them (8 x 256
+// frames is ~46 ms at 44.1 kHz)
+#define I2S_BLOCK_FRAMES       64
+#define I2S_DMA_BUFFERS        8
+#define I2S_DMA_BUFFER_WORDS   256
+
+static_assert((PROTOCOL_AUDIO_SAMPLES & (PROTOCOL_AUDIO_SAMPLES - 1)) == 0, "sample ring must be a power of two");
+
+// I2S output on the RP2040 that also feeds the laser taps: the raw sample
+// ring, the audio features and the spectrum ring. Samples are handled in
+// blocks. ConsumeSamples() converts, taps, applies gain and hands a whole
+// block to the I2S DMA buffers at once; ConsumeSample(), which the WAV
+// generator calls per frame, only stages frames until a block is full.
+class AudioOutputI2SExtra : public AudioOutput
 {
-  public: 
-    uint8_t udpBuffer[UDP_AUDIO_BUFF_SIZE];
+  public:
+    // Ring of the most recent 8 bit mono samples, sent as-is to the laser controller
+    audio_data_packet_t audioPacket;
+    // Latest features of the samples before gain, written on the audio core
+    Mailbox<audio_features_packet_t> featureMailbox;
+
+    // The word clock has to be on the pin after the bit clock
+    bool SetPinout(int bclk, int wclk, int dout);
+    virtual bool SetRate(int hz) override;
+    virtual bool begin() override;
     virtual bool ConsumeSample(int16_t sample[2]) override;
-      
+    virtual uint16_t ConsumeSamples(int16_t *samples, uint16_t count) override;
+    virtual bool stop() override;
+    // Publishes silent features, call from the audio core when playback stops
+    void ClearFeatures();
+    // True when the last block did not fit, so the DMA buffers hold
+    // I2S_DMA_BUFFERS worth of audio and there is time for slow work
+    bool BuffersFull() const { return outputFull; }
+    int GetRate() const { return hertz; }
+
+    // Number of samples written to the spectrum ring so far. The head moves
+    // a block at a time after the block is written, so sample n is only
+    // safe at SpectrumSample(n) while SpectrumHead() - n is at most
+    // SPECTRUM_RING_SIZE - I2S_BLOCK_FRAMES.
+    uint32_t SpectrumHead() const { return __atomic_load_n(&spectrumHead, __ATOMIC_ACQUIRE); }
+    int16_t SpectrumSample(uint32_t n) const { return spectrumRing[n & (SPECTRUM_RING_SIZE - 1)]; }
+
   private:
-    uint16_t udpBufferIndex = 0;
+    I2S i2s{OUTPUT};
+    int bclkPin = -1;
+    int doutPin = -1;
+    bool running = false;
+    bool outputFull = false;
+
+    // Frames from ConsumeSample() waiting for a full block
+    int16_t staged[I2S_BLOCK_FRAMES * 2];
+    uint16_t stagedFrames = 0;
+    // One block converted to signed 16 bit stereo, and the same after gain
+    // packed as I2S words
+    int16_t block[I2S_BLOCK_FRAMES * 2];
+    uint32_t words[I2S_BLOCK_FRAMES];
+
+    uint16_t audioPacketIndex = 0;
+    AudioFeatureExtractor features;
+    int16_t spectrumRing[SPECTRUM_RING_SIZE];
+    uint32_t spectrumHead = 0;
+
+    void flushStaged();
+    void tap(uint16_t frames);
 };
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include "IntMath.h"
+
+// 1024 point radix-4 FFT on 16 bit integers for the laser spectrum. The
+// Cortex-M0+ has no FPU and only a 32x32->32 multiply, so the data stays in
+// int16 with a block exponent. A quiet block is first shifted up to use the
+// full range, then before each of the five stages it is scanned and shifted
+// down just enough that the stage cannot overflow. The net shift is
+// returned so callers can scale back, and quiet passages keep the same
+// precision as loud ones instead of losing a fixed 10 bits.
+//
+//   fft.begin();
+//   fft.window(samples, re, im);
+//   int exp = fft.transform(re, im);
+//   fft.bandLevels(re, im, exp, levels);
+//
+// At 44.1 kHz bins are 43 Hz apart, and the FFT_BANDS bands are spaced
+// logarithmically from bin 1 up to Nyquist.
+
+#define FFT_SIZE   1024
+#define FFT_LOG4   5
+#define FFT_BANDS  16
+
+class FixedFFT {
+  public:
+    void begin() {
+      for (int i = 0; i < FFT_SIZE; i++)
+        _sin[i] = (int16_t)lround(32767.0 * sin(2.0 * M_PI * i / FFT_SIZE));
+
+      for (int i = 0; i < FFT_SIZE; i++) {
+        int r = 0;
+        for (int d = 0, v = i; d < FFT_LOG4; d++, v >>= 2)
+          r = (r << 2) | (v & 3);
+        _reverse[i] = (uint16_t)r;
+      }
+
+      // Geometric from bin 1 to FFT_SIZE / 2, at least one bin per band
+      _edges[0] = 1;
+      for (int b = 1; b <= FFT_BANDS; b++) {
+        int edge = (int)lround(pow(FFT_SIZE / 2, (double)b / FFT_BANDS));
+        _edges[b] = (uint16_t)(edge > _edges[b - 1] ? edge : _edges[b - 1] + 1);
+      }
+      _edges[FFT_BANDS] = FFT_SIZE / 2 + 1;
+    }
+
+    // Applies a Hann window to FFT_SIZE samples
+    void window(const int16_t *samples, int16_t *re, int16_t *im) const {
+      for (int i = 0; i < FFT_SIZE; i++) {
+        int32_t w = (32768 - cosine(i)) >> 1;
+        re[i] = (int16_t)(((int32_t)samples[i] * w) >> 15);
+        im[i] = 0;
+      }
+    }
+
+    // In place, leaves the bins in natural order. Returns the block
+    // exponent: the true spectrum is the result times 2^exp, which can be
+    // negative.
+    int transform(int16_t *re, int16_t *im) const {
+      int exp = 0;
+
+      int32_t peak = 0;
+      for (int i = 0; i < FFT_SIZE; i++) {
+        int32_t a = abs(re[i]), b = abs(im[i]);
+        if (a > peak) peak = a;
+        if (b > peak) peak = b;
+      }
+      if (peak == 0) return 0;
+      while ((peak << 1) < 32768) {
+        peak <<= 1;
+        exp--;
+      }
+      if (exp < 0) {
+        for (int i = 0; i < FFT_SIZE; i++) {
+          re[i] = (int16_t)(re[i] << -exp);
+          im[i] = (int16_t)(im[i] << -exp);
+        }
+      }
+
+      for (int len = FFT_SIZE, stride = 1; len >= 4; len >>= 2, stride <<= 2) {
+        // A radix-4 butterfly and its twiddle grow a component by at most
+        // 4 * sqrt(2), so shift until 6 times the peak fits
+        peak = 0;
+        for (int i = 0; i < FFT_SIZE; i++) {
+          int32_t a = abs(re[i]), b = abs(im[i]);
+          if (a > peak) peak = a;
+          if (b > peak) peak = b;
+        }
+        int s = 0;
+        while (((peak * 6) >> s) >= 32768) s++;
+        exp += s;
+
+        int q = len >> 2;
+        for (int start = 0; start < FFT_SIZE; start += len) {
+          for (int k = 0; k < q; k++) {
+            int i0 = start + k, i1 = i0 + q, i2 = i1 + q, i3 = i2 + q;
+            int32_t ar = re[i0] + re[i2], ai = im[i0] + im[i2];
+            int32_t br = re[i0] - re[i2], bi = im[i0] - im[i2];
+            int32_t cr = re[i1] + re[i3], ci = im[i1] + im[i3];
+            int32_t dr = re[i1] - re[i3], di = im[i1] - im[i3];
+
+            re[i0] = (int16_t)((ar + cr) >> s);
+            im[i0] = (int16_t)((ai + ci) >> s);
+            twiddle(re, im, i1, (br + di) >> s, (bi - dr) >> s, k * stride);
+            twiddle(re, im, i2, (ar - cr) >> s, (ai - ci) >> s, 2 * k * stride);
+            twiddle(re, im, i3, (br - di) >> s, (bi + dr) >> s, 3 * k * stride);
+          }
+        }
+      }
+
+      for (int i = 0; i < FFT_SIZE; i++) {
+        int j = _reverse[i];
+        if (j > i) {
+          int16_t t = re[i]; re[i] = re[j]; re[j] = t;
+          t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+      }
+      return exp;
+    }
+
+    // RMS of each band of a transformed window, in sample units: a full
+    // scale sine inside one band reads about 23170 there. Assumes a real,
+    // Hann windowed input.
+    void bandLevels(const int16_t *re, const int16_t *im, int exp, uint16_t *levels) const {
+      for (int b = 0; b < FFT_BANDS; b++) {
+        uint64_t sum = 0;
+        for (int k = _edges[b]; k < _edges[b + 1]; k++)
+          sum += (uint32_t)((int32_t)re[k] * re[k]) + (uint32_t)((int32_t)im[k] * im[k]);
+
+        // Parseval with the Hann window's power gain of 3/8, one side of
+        // the spectrum, and the FFT's gain of FFT_SIZE
+        uint64_t rms = isqrt64(sum * 16 / 3);
+        rms = exp >= 10 ? rms << (exp - 10) : rms >> (10 - exp);
+        levels[b] = rms > 0xffff ? 0xffff : (uint16_t)rms;
+      }
+    }
+
+    int bandEdge(int b) const { return _edges[b]; }
+
+  private:
+    int16_t _sin[FFT_SIZE];
+    uint16_t _reverse[FFT_SIZE];
+    uint16_t _edges[FFT_BANDS + 1];
+
+    int32_t cosine(int i) const { return _sin[(i + FFT_SIZE / 4) & (FFT_SIZE - 1)]; }
+
+    // Stores (yr + j yi) * e^(-2 pi j m / FFT_SIZE) at index i
+    void twiddle(int16_t *re, int16_t *im, int i, int32_t yr, int32_t yi, int m) const {
+      int32_t c = cosine(m), s = _sin[m & (FFT_SIZE - 1)];
+      re[i] = (int16_t)((yr * c + yi * s + (1 << 14)) >> 15);
+      im[i] = (int16_t)((yi * c - yr * s + (1 << 14)) >> 15);
+    }
+};
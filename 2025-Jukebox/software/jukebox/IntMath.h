@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>
+
+// Integer square root, rounded down
+inline uint32_t isqrt64(uint64_t v) {
+  uint64_t result = 0;
+  uint64_t bit = (uint64_t)1 << 62;
+  while (bit > v) bit >>= 2;
+  while (bit != 0) {
+    if (v >= result + bit) {
+      v -= result + bit;
+      result = (result >> 1) + bit;
+    } else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint32_t)result;
+}
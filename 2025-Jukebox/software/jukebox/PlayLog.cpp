@@ -0,0 +1,77 @@
+#include "PlayLog.h"
+
+void PlayLog::begin(const char *filename) {
+  _filename = filename;
+  play_log_record_t boot = {};
+  boot.type = PLAY_LOG_BOOT;
+  add(boot);
+}
+
+bool PlayLog::add(const play_log_record_t &record) {
+  if (_head - _tail == PLAY_LOG_RING) {
+    dropped++;
+    return false;
+  }
+  if (_head == _tail) _oldestMs = millis();
+  _ring[_head % PLAY_LOG_RING] = record;
+  _head++;
+  return true;
+}
+
+bool PlayLog::flush(bool force) {
+  uint32_t pending = _head - _tail;
+  if (pending == 0 || !_filename) return false;
+  if (!force && pending < PLAY_LOG_BATCH && millis() - _oldestMs < PLAY_LOG_MAX_AGE_MS) return false;
+  // A card that is missing or full is not retried on every pass
+  if (_failed && millis() - _lastAttemptMs < PLAY_LOG_RETRY_MS) return false;
+  _lastAttemptMs = millis();
+
+  File f = SD.open(_filename, FILE_WRITE);
+  _failed = !f;
+  if (_failed) {
+    writeErrors++;
+    return true;
+  }
+  if (f.size() == 0) {
+    play_log_header_t header = { PLAY_LOG_MAGIC, PLAY_LOG_VERSION, sizeof(play_log_record_t) };
+    if (f.write((const uint8_t *)&header, sizeof(header)) != sizeof(header)) {
+      f.truncate(0);
+      f.close();
+      writeErrors++;
+      _failed = true;
+      return true;
+    }
+  }
+  // A record cut short by a power loss would shift every one after it
+  uint32_t end = f.size();
+  uint32_t partial = end < sizeof(play_log_header_t) ? 0 :
+                     (end - sizeof(play_log_header_t)) % sizeof(play_log_record_t);
+  if (partial) {
+    end -= partial;
+    f.truncate(end);
+  }
+
+  // At most two writes, the pending records may wrap around the ring
+  while (_tail != _head) {
+    uint32_t index = _tail % PLAY_LOG_RING;
+    uint32_t n = min(_head - _tail, (uint32_t)(PLAY_LOG_RING - index));
+    size_t len = n * sizeof(play_log_record_t);
+    size_t written = f.write((const uint8_t *)&_ring[index], len);
+    // Whole records that made it stay written, a partial one is cut off
+    // so the records after it keep their place in the file
+    uint32_t whole = written / sizeof(play_log_record_t);
+    _tail += whole;
+    end += whole * sizeof(play_log_record_t);
+    if (written != len) {
+      if (written % sizeof(play_log_record_t)) f.truncate(end);
+      writeErrors++;
+      _failed = true;
+      break;
+    }
+  }
+  f.close();
+  // Records a failed write left behind keep their age, so they are retried
+  // as soon as PLAY_LOG_RETRY_MS allows
+  if (_tail == _head) _oldestMs = millis();
+  return true;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Arduino.h>
+#include <SD.h>
+
+// /play_log.bin, decoded by sd_card_setup/read_play_log.py. Little endian,
+// a play_log_header_t when the file is created, then play_log_record_t
+// records appended in batches.
+#define PLAY_LOG_MAGIC    0x4c50424a  // "JBPL"
+#define PLAY_LOG_VERSION  1
+
+// Records kept in RAM, how many make a batch worth writing, and how long
+// a smaller batch may wait
+#define PLAY_LOG_RING         32
+#define PLAY_LOG_BATCH        8
+#define PLAY_LOG_MAX_AGE_MS   60000
+#define PLAY_LOG_RETRY_MS     1000
+
+#define PLAY_LOG_BOOT    0  // the jukebox started
+#define PLAY_LOG_SONG    1  // a song played from the queue
+#define PLAY_LOG_RESUME  2  // a paused song played on
+
+#define PLAY_END_FINISHED  0
+#define PLAY_END_SKIPPED   1
+#define PLAY_END_PAUSED    2  // the jukebox mode changed
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+} play_log_header_t;
+
+typedef struct __attribute__((packed)) {
+  uint32_t startMs;           // millis() when the song started
+  uint32_t playedMs;
+  uint32_t queueWaitMs;       // from being queued to starting, 0 for a resume
+  uint32_t gapUs;             // from the end of the song before, 0 if none
+  uint16_t song;
+  uint8_t type;               // PLAY_LOG_*
+  uint8_t end;                // PLAY_END_*
+  uint16_t readAheadMinFill;  // see AudioFileSourceReadAhead
+  uint16_t underruns;
+} play_log_record_t;
+
+// Keeps records in RAM so logging a song costs no card access, and
+// appends them in one write per batch when the card is free. Core 0 only,
+// like the rest of the card.
+class PlayLog {
+  public:
+    // Also logs a PLAY_LOG_BOOT record
+    void begin(const char *filename);
+    // False if the ring was full and the record was dropped
+    bool add(const play_log_record_t &record);
+    // Writes the pending records once there is a batch of them or they
+    // have waited long enough, or whenever there are any if force is set.
+    // Returns false when there was nothing to do.
+    bool flush(bool force);
+
+    uint32_t dropped = 0;
+    uint32_t writeErrors = 0;
+
+  private:
+    const char *_filename = nullptr;
+    play_log_record_t _ring[PLAY_LOG_RING];
+    uint32_t _head = 0;
+    uint32_t _tail = 0;
+    unsigned long _oldestMs = 0;
+    unsigned long _lastAttemptMs = 0;
+    bool _failed = false;
+};
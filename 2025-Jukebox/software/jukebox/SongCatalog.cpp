@@ -0,0 +1,53 @@
+#include "SongCatalog.h"
+
+bool SongCatalog::begin(const char *filename) {
+  _file = SD.open(filename);
+  if (!_file) return false;
+
+  if (_file.read((uint8_t *)&_header, sizeof(_header)) != sizeof(_header) ||
+      _header.magic != SONG_CATALOG_MAGIC || _header.version != SONG_CATALOG_VERSION ||
+      _header.entrySize < sizeof(song_catalog_entry_t) || _header.namesSize == 0 ||
+      _header.namesSize > 0xffff) {
+    _file.close();
+    return false;
+  }
+
+  _names = (char *)malloc(_header.namesSize);
+  if (!_names) {
+    _file.close();
+    return false;
+  }
+  if (!_file.seek(_header.namesOffset) || _file.read((uint8_t *)_names, _header.namesSize) != _header.namesSize) {
+    free(_names);
+    _names = nullptr;
+    _file.close();
+    return false;
+  }
+  _names[_header.namesSize - 1] = '\0';
+
+  uint16_t count = min(_header.count, (uint16_t)SONG_CATALOG_MAX);
+  uint16_t offset = 0;
+  for (_count = 0; _count < count && offset < _header.namesSize; _count++) {
+    _nameOffsets[_count] = offset;
+    offset += strlen(_names + offset) + 1;
+  }
+  return true;
+}
+
+bool SongCatalog::lookup(uint16_t index, song_info_t *info) {
+  if (index >= _count) return false;
+
+  song_catalog_entry_t entry;
+  if (!_file.seek(_header.entriesOffset + (uint32_t)index * _header.entrySize) ||
+      _file.read((uint8_t *)&entry, sizeof(entry)) != sizeof(entry) ||
+      entry.pathLen >= SONG_PATH_LEN)
+    return false;
+
+  if (!_file.seek(entry.pathOffset) || _file.read((uint8_t *)info->path, entry.pathLen) != entry.pathLen)
+    return false;
+  info->path[entry.pathLen] = '\0';
+  info->durationMs = entry.durationMs;
+  info->metaOffset = entry.metaOffset;
+  info->gain = entry.gain / 256.0f;
+  return true;
+}
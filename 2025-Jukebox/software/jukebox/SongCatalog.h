@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+#include <SD.h>
+
+// /song_catalog.bin, written by sd_card_setup/setup_songs.py. Little endian,
+// the header is followed by one entry per song, then the NUL terminated
+// display names in song order, then the paths.
+#define SONG_CATALOG_MAGIC    0x5443424a  // "JBCT"
+#define SONG_CATALOG_VERSION  2
+#define SONG_CATALOG_MAX      260         // A0 to Z9
+#define SONG_PATH_LEN         96
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+  uint16_t entrySize;
+  uint16_t reserved;
+  uint32_t entriesOffset;
+  uint32_t namesOffset;
+  uint32_t namesSize;
+} song_catalog_header_t;
+
+typedef struct __attribute__((packed)) {
+  uint32_t pathOffset;
+  uint32_t durationMs;
+  uint32_t metaOffset;  // of the song's section in song_meta.bin, 0 for none
+  uint16_t gain;        // Q8, evens out loudness across the library
+  uint8_t pathLen;
+  uint8_t flags;
+} song_catalog_entry_t;
+
+typedef struct {
+  char path[SONG_PATH_LEN];
+  uint32_t durationMs;
+  uint32_t metaOffset;
+  float gain;
+} song_info_t;
+
+// The names are loaded into RAM in one read at boot, since both cores show
+// them and the card can only be used from core 0. Everything else stays
+// on the card and is read by lookup() when a song starts.
+class SongCatalog {
+  public:
+    bool begin(const char *filename);
+    uint16_t count() const { return _count; }
+    // Empty for an index without a song, safe from either core
+    const char *name(uint16_t index) const { return index < _count ? _names + _nameOffsets[index] : ""; }
+    // Reads a song's entry and path from the card, core 0 only
+    bool lookup(uint16_t index, song_info_t *info);
+
+  private:
+    File _file;
+    song_catalog_header_t _header;
+    uint16_t _count = 0;
+    char *_names = nullptr;
+    uint16_t _nameOffsets[SONG_CATALOG_MAX];
+};
@@ -0,0 +1,83 @@
+#include "SongMeta.h"
+
+bool SongMeta::begin(const char *filename) {
+  _file = SD.open(filename);
+  if (!_file) return false;
+
+  song_meta_file_header_t header;
+  if (_file.read((uint8_t *)&header, sizeof(header)) != sizeof(header) ||
+      header.magic != SONG_META_MAGIC || header.version != SONG_META_VERSION) {
+    _file.close();
+    return false;
+  }
+  return true;
+}
+
+// Beats are read from the start of the song and skipped up to the position
+// by beatAt(), levels are at a fixed rate and can be found directly
+bool SongMeta::start(uint32_t offset, uint32_t positionMs) {
+  _active = false;
+  if (!_file || offset == 0) return false;
+  song_meta_header_t song;
+  if (!_file.seek(offset) || _file.read((uint8_t *)&song, sizeof(song)) != sizeof(song) || song.envelopeHz == 0)
+    return false;
+
+  _beatCount = song.beatCount;
+  _levelCount = song.envelopeCount;
+  _levelHz = song.envelopeHz;
+  _beatPeriodMs = song.tempo ? (uint16_t)(6000000UL / song.tempo) : 0;
+  _beatsOffset = offset + sizeof(song);
+  _levelsOffset = _beatsOffset + _beatCount * sizeof(uint32_t);
+  _beatNext = _beatLoaded = 0;
+  _levelNext = _levelLoaded = min(positionMs * _levelHz / 1000, _levelCount);
+  _active = true;
+  return true;
+}
+
+bool SongMeta::fill() {
+  if (!_active) return false;
+
+  if (_beatLoaded < _beatCount && _beatLoaded - _beatNext < SONG_META_BEATS / 2) {
+    uint32_t n = SONG_META_BEATS - (_beatLoaded - _beatNext);
+    n = min(n, _beatCount - _beatLoaded);
+    n = min(n, SONG_META_BEATS - _beatLoaded % SONG_META_BEATS);
+    uint8_t *dest = (uint8_t *)&_beats[_beatLoaded % SONG_META_BEATS];
+    if (!_file.seek(_beatsOffset + _beatLoaded * sizeof(uint32_t)) || _file.read(dest, n * sizeof(uint32_t)) != n * sizeof(uint32_t))
+      _active = false;
+    _beatLoaded += n;
+    return true;
+  }
+
+  if (_levelLoaded < _levelCount && _levelLoaded - _levelNext < SONG_META_LEVELS / 2) {
+    uint32_t n = SONG_META_LEVELS - (_levelLoaded - _levelNext);
+    n = min(n, _levelCount - _levelLoaded);
+    n = min(n, SONG_META_LEVELS - _levelLoaded % SONG_META_LEVELS);
+    uint8_t *dest = &_levels[_levelLoaded % SONG_META_LEVELS];
+    if (!_file.seek(_levelsOffset + _levelLoaded) || _file.read(dest, n) != n)
+      _active = false;
+    _levelLoaded += n;
+    return true;
+  }
+  return false;
+}
+
+bool SongMeta::beatAt(uint32_t positionMs, audio_beat_packet_t *pkt) {
+  if (!_active || _beatPeriodMs == 0) return false;
+
+  while (_beatNext < _beatLoaded && beat(_beatNext) <= positionMs) _beatNext++;
+  // Levels that were due before they could be read are skipped
+  uint32_t level = min(positionMs * _levelHz / 1000, _levelCount);
+  if (level > _levelLoaded) _levelLoaded = level;
+  if (level > _levelNext) _levelNext = level;
+  if (_beatNext >= _beatLoaded) return false;
+
+  uint32_t next = beat(_beatNext);
+  uint32_t beatLevel = next * _levelHz / 1000;
+  if (beatLevel >= _levelLoaded) beatLevel = _levelNext;
+
+  pkt->nextBeatMs = (uint16_t)min(next - positionMs, (uint32_t)0xffff);
+  pkt->beatPeriodMs = _beatPeriodMs;
+  pkt->beatIndex = (uint16_t)_beatNext;
+  pkt->level = _levelNext < _levelLoaded ? _levels[beatLevel % SONG_META_LEVELS] : 0;
+  return true;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+#include <SD.h>
+#include <JukeboxProtocol.h>
+
+// /song_meta.bin, written by sd_card_setup/setup_songs.py next to the song
+// catalog, which holds the offset of each song's section. Little endian.
+#define SONG_META_MAGIC    0x544d424a  // "JBMT"
+#define SONG_META_VERSION  1
+
+// Beat times and envelope levels kept in RAM ahead of the playback
+// position, the envelope is 3.2 s at 20 Hz
+#define SONG_META_BEATS    32
+#define SONG_META_LEVELS   64
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+} song_meta_file_header_t;
+
+// Followed by beatCount beat times in ms and envelopeCount levels
+typedef struct __attribute__((packed)) {
+  uint16_t tempo;         // 1/100 BPM
+  uint16_t envelopeHz;
+  uint32_t beatCount;
+  uint32_t envelopeCount;
+} song_meta_header_t;
+
+// Streams the playing song's beat grid and loudness envelope from the card
+// as playback goes on, so the laser controller can follow the beat without
+// analysing anything. All of it is core 0 only, like the rest of the card.
+//
+//   meta.start(info.metaOffset, 0);        // when the song starts
+//   meta.fill();                           // when the output is full
+//   meta.beatAt(positionMs, &pkt);         // as it plays
+class SongMeta {
+  public:
+    bool begin(const char *filename);
+    // Loads the section at offset and skips to positionMs, false if the
+    // song has no metadata
+    bool start(uint32_t offset, uint32_t positionMs);
+    void stop() { _active = false; }
+    // Reads the next batch of beats or levels if either is running low,
+    // returns false when there was nothing to do
+    bool fill();
+    // The next beat after positionMs, false if it is not known
+    bool beatAt(uint32_t positionMs, audio_beat_packet_t *pkt);
+
+  private:
+    File _file;
+    bool _active = false;
+    uint32_t _beatCount = 0;
+    uint32_t _levelCount = 0;
+    uint16_t _levelHz = 0;
+    uint16_t _beatPeriodMs = 0;
+    uint32_t _beatsOffset = 0;
+    uint32_t _levelsOffset = 0;
+
+    // Rings indexed by beat and level number. Entries from next up to
+    // loaded are in RAM.
+    uint32_t _beats[SONG_META_BEATS];
+    uint32_t _beatNext = 0;
+    uint32_t _beatLoaded = 0;
+    uint8_t _levels[SONG_META_LEVELS];
+    uint32_t _levelNext = 0;
+    uint32_t _levelLoaded = 0;
+
+    uint32_t beat(uint32_t index) const { return _beats[index % SONG_META_BEATS]; }
+};
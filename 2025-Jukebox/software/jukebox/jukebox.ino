@@ -7,8 +7,17 @@
 #include <AudioFileSourceFunction.h>
 #include <AudioGeneratorWAV.h>
 #include "AudioOutputI2SExtra.h"
+#include "AudioFileSourceReadAhead.h"
+#include "SongCatalog.h"
+#include "SongMeta.h"
+#include "PlayLog.h"
+#include "FixedFFT.h"
 #include <Ethernet.h>
 #include <EthernetUdp.h>
+#include <JukeboxProtocol.h>
+#include <PacketDispatcher.h>
+#include <Mailbox.h>
+#include <LinkHealth.h>
 
 #define SDA_PIN       2
 #define SCL_PIN       3
@@ -42,21 +51,14 @@
 #define JUKEBOX_MODE_EFFECTS 2
 #define JUKEBOX_MODE_INVALID 255
 
-#define PACKET_ID_ROBBIE_MODE    1
-#define PACKET_ID_LASER_DATA     2
-#define PACKET_ID_AUDIO_DATA     3
-#define PACKET_ID_BUTTON_PRESS   4
-#define PACKET_ID_AUDIO_METADATA 5
-#define PACKET_ID_PLAY_EFFECT    6
-#define PACKET_ID_WAND_DATA      7
-#define PACKET_ID_JUKEBOX_MODE   8
-
 #define MENU_MODE_SELECTED_SONG 0
 #define MENU_MODE_CURRENT_SONG  1
 #define MENU_MODE_SONG_QUEUE    2
 #define MENU_MODE_JUKEBOX_MODE  3
 #define MENU_MODE_WAND_DATA     4
 #define MENU_MODE_VOLUME_DATA   5
+#define MENU_MODE_TRANSITIONS   6
+#define MENU_MODES              7
 
 #define SCREEN_WIDTH 128
 #define SCREEN_HEIGHT 32
@@ -108,21 +110,52 @@ uint8_t currentNumber = 0;
 bool letterShowing = true;
 uint8_t buttonStates[8] = {0, 0, 0, 0, 0, 0, 0, 0};
 
-#define SONG_QUEUE_LIMIT 20
+#define SONG_QUEUE_LIMIT PROTOCOL_SONG_QUEUE_MAX
 uint16_t songQueue[SONG_QUEUE_LIMIT];
+uint32_t songQueueTime[SONG_QUEUE_LIMIT];  // millis() when each entry was queued
+uint32_t dequeuedWaitMs = 0;
 uint16_t songQueueIndex = 0;
 uint8_t songQueueLength = 0;
 bool skipSong = false;
 
-#define MAX_SONG_NAME_LEN 60
-char songList[260][MAX_SONG_NAME_LEN];
-uint16_t numSongs = 0;
+#define MAX_SONG_NAME_LEN PROTOCOL_SONG_NAME_LEN
+SongCatalog catalog;
 uint16_t playingSongIndex = 0;
+song_info_t playingSong = {"", 0, 0, 1.0f};
+song_info_t nextSong;
+SongMeta meta;
+// Spectrum ring count at the first frame of the playing song
+uint32_t songStartFrame = 0;
+// Frames between being written and being heard, when the DMA buffers are full
+#define I2S_LATENCY_FRAMES (I2S_DMA_BUFFERS * I2S_DMA_BUFFER_WORDS)
+#define WAV_HEADER_LEN     44
+#define BEAT_UPDATE_MS     50
+Mailbox<audio_beat_packet_t> beatMailbox;  // core 0 -> core 1
+
+PlayLog playLog;
+// The song playing, added to the log when it ends
+play_log_record_t playRecord;
+bool playRecordOpen = false;
+uint32_t playStartPositionMs = 0;
 char effectFileName[MAX_SONG_NAME_LEN];
 bool playEffect = false;
 bool songPaused = false;
 uint32_t songPausedPosition = 0;
 
+// The head of the queue is opened and read ahead in nextSource while the
+// current song plays, so the change to it is only a header parse
+int preloadedSong = -1;
+bool preloadOk = false;
+
+// Time from the end of one song to the first samples of the next, written
+// on core 0 and shown on core 1
+unsigned long songEndUs = 0;
+bool songEnded = false;
+uint32_t transitionUs = 0;
+uint32_t transitionMaxUs = 0;
+uint16_t transitions = 0;
+uint16_t transitionsPreloaded = 0;
+
 uint8_t menuMode = MENU_MODE_SELECTED_SONG;
 uint8_t jukeboxMode = JUKEBOX_MODE_MUSIC;
 uint8_t nextJukeboxMode = JUKEBOX_MODE_INVALID;
@@ -131,8 +164,8 @@ bool displayUpdating = false;
 uint16_t volumeRaw = 0;
 float volume = 0;
 
-File file;
-AudioFileSourceSD *sdSource;
+AudioFileSourceReadAhead *sdSource;
+AudioFileSourceReadAhead *nextSource;
 AudioFileSourceFunction* funcSource;
 AudioGeneratorWAV *wav;
 AudioOutputI2SExtra *out;
@@ -142,13 +175,28 @@ IPAddress ip(10, 0, 0, 32);
 EthernetUDP udp;
 IPAddress ioIP(10, 0, 0, 31);
 IPAddress laserControllerIP(10, 0, 0, 33);
+IPAddress statusIP(10, 0, 0, 255);
+LinkHealth laserControllerLink(laserControllerIP, 1000, 10000);
+LinkHealth ioLink(ioIP, 1000, 10000);
 #define PACKET_BUF_SIZE 1472
-uint8_t packetBuffer[PACKET_BUF_SIZE];
-
-//Packet ID, selected song ID, current song ID, num songs in queue, queued songs, current song name
-uint8_t metaDataPacketBuffer[1 + 2 + 2 + 1 + SONG_QUEUE_LIMIT * 2 + MAX_SONG_NAME_LEN];
+#define RX_RING_SLOTS   4
+#define RX_BUDGET_US    1000
+PacketDispatcher<RX_RING_SLOTS, PACKET_BUF_SIZE> rx;
+WizInterrupt wizInt;
 bool forceAudioData = false;
 
+// Set to 1 to send the laser controller the raw sample ring every 50 ms as
+// before, instead of a features packet every 10 ms and a spectrum packet
+// every SPECTRUM_HOP samples
+#define AUDIO_SEND_SAMPLES 0
+
+// The FFT runs on this core, off the audio path, over windows that
+// overlap by half
+#define SPECTRUM_HOP (FFT_SIZE / 2)
+static_assert(FFT_BANDS == PROTOCOL_SPECTRUM_BANDS, "spectrum band count mismatch");
+static_assert(SPECTRUM_RING_SIZE >= FFT_SIZE + SPECTRUM_HOP + I2S_BLOCK_FRAMES, "spectrum ring too small");
+FixedFFT fft;
+
 double baseVector[3] = {0.0, -1.0, 0.0};
 double wandVector[3] = {0.0, 1.0, 0.0};
 uint8_t wandButtonPressed = 0;
@@ -174,8 +222,14 @@ void setup1() {
   Ethernet.begin(mac, ip);
   Ethernet.setRetransmissionCount(0);
   Ethernet.setRetransmissionTimeout(0);
-  udp.begin(8888);
-  metaDataPacketBuffer[0] = PACKET_ID_AUDIO_METADATA;
+  udp.begin(PROTOCOL_PORT);
+  wizInt.begin(WIZ_INT_PIN);
+  rx.on(PACKET_ID_JUKEBOX_MODE, handleJukeboxMode);
+  rx.on(PACKET_ID_BUTTON_PRESS, handleButtonPress);
+  rx.on(PACKET_ID_PLAY_EFFECT, handlePlayEffect);
+  rx.on(PACKET_ID_WAND_DATA, handleWandData);
+
+  fft.begin();
 
   display.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS);
   display.setTextSize(1);
@@ -184,9 +238,16 @@ void setup1() {
 
 void loop1() {
   checkButtons();
-  checkForPacket();
+  rx.poll(udp, wizInt, RX_BUDGET_US);
+#if AUDIO_SEND_SAMPLES
   sendUDPAudioData();
+#else
+  sendUDPAudioFeatures();
+  sendUDPAudioSpectrum();
+  sendUDPAudioBeat();
+#endif
   sendUDPAudioMetadata();
+  sendLinkStatus();
   updateDisplay();
 }
 
@@ -201,13 +262,13 @@ void setup() {
   digitalWrite(SEG_DIG2_PIN, LOW);
 
   audioLogger = &Serial;
-  sdSource = new AudioFileSourceSD();
+  sdSource = new AudioFileSourceReadAhead(new AudioFileSourceSD());
+  nextSource = new AudioFileSourceReadAhead(new AudioFileSourceSD());
   wav = new AudioGeneratorWAV();
   wav->SetBufferSize(1024);
   out = new AudioOutputI2SExtra();
   out->SetPinout(PCM_BCK_PIN, PCM_LRCLK_PIN, PCM_DAT_PIN);
-  out->udpBuffer[0] = PACKET_ID_AUDIO_DATA;
-  memset(out->udpBuffer + 1, 128, UDP_AUDIO_BUFF_SIZE - 1);
+  memset(out->audioPacket.samples, 128, PROTOCOL_AUDIO_SAMPLES);
 
   SPI1.setRX(SD_DAT0_PIN);
   SPI1.setTX(SD_CMD_PIN);
@@ -215,24 +276,11 @@ void setup() {
   SPI1.setCS(SD_DAT3_PIN);
   SD.begin(SD_DAT3_PIN, SPI_FULL_SPEED, SPI1);
 
-  for (int i = 0; i < 260; i++)
-    for (int j = 0; j < MAX_SONG_NAME_LEN; j++)
-      songList[i][j] = 0;
-
-  file = SD.open("/song_list.txt");
-  if (file) {
-    while (file.available() && numSongs < 260) {
-      int charIndex = 0;
-      while (file.available() && charIndex < MAX_SONG_NAME_LEN - 1) {
-        char ch = file.read();
-        if (ch == '\n' || ch == '\r' || ch == '.') break;
-        songList[numSongs][charIndex++] = ch;
-      }
-      if (charIndex > 3)
-        songList[numSongs++][charIndex] = '\0';
-    }
-    file.close();
-  }
+  playLog.begin("/play_log.bin");
+  if (!catalog.begin("/song_catalog.bin"))
+    Serial.println("No song catalog");
+  if (!meta.begin("/song_meta.bin"))
+    Serial.println("No song metadata");
 }
 
 void loop() {
@@ -261,122 +309,183 @@ float sine_wave(const float time) {
 
 void sendUDPAudioData() {
   static unsigned long lastAudioDataUpdate = 0;
-  static unsigned long extraDelay = 0;
-  if (millis() - lastAudioDataUpdate > 50 + extraDelay && (wav->isRunning() || forceAudioData)) {
+  if (millis() - lastAudioDataUpdate > 50 && (wav->isRunning() || forceAudioData) && laserControllerLink.ready()) {
     forceAudioData = false;
-    if (udp.beginPacket(laserControllerIP, 8888) == 1) {
-      udp.write(out->udpBuffer, UDP_AUDIO_BUFF_SIZE);
-      extraDelay = udp.endPacket() == 1 ? 0 : 1000;
-    } else {
-      extraDelay = 1000;
-    }
+    // Encoding copies the ring out first, so the CRC covers exactly the
+    // samples that are sent even while core 0 keeps writing into it
+    static uint8_t buf[PACKET_MAX_LEN(audio_data_packet_t)];
+    size_t len = packet_encode(out->audioPacket, buf, sizeof(buf));
+    link_send(laserControllerLink, udp, PROTOCOL_PORT, buf, len);
     lastAudioDataUpdate = millis();
   }
 }
 
+// Sends each new set of features as the audio core publishes them, which
+// is FEATURE_HOPS_PER_SEC times a second while something is playing
+void sendUDPAudioFeatures() {
+  static uint32_t sentVersion = 0;
+  if (out->featureMailbox.version() == sentVersion || !laserControllerLink.ready()) return;
+
+  audio_features_packet_t pkt;
+  sentVersion = out->featureMailbox.read(&pkt);
+  uint8_t buf[PACKET_MAX_LEN(audio_features_packet_t)];
+  link_send(laserControllerLink, udp, PROTOCOL_PORT, buf, packet_encode(pkt, buf, sizeof(buf)));
+}
+
+void sendUDPAudioBeat() {
+  static uint32_t sentVersion = 0;
+  if (beatMailbox.version() == sentVersion || !laserControllerLink.ready()) return;
+
+  audio_beat_packet_t pkt;
+  sentVersion = beatMailbox.read(&pkt);
+  uint8_t buf[PACKET_MAX_LEN(audio_beat_packet_t)];
+  link_send(laserControllerLink, udp, PROTOCOL_PORT, buf, packet_encode(pkt, buf, sizeof(buf)));
+}
+
+// Transforms the latest window once another SPECTRUM_HOP samples have been
+// played. If this core fell behind, windows are skipped rather than queued,
+// and a window the audio core overwrote while it was being copied is
+// dropped.
+void sendUDPAudioSpectrum() {
+  static uint32_t windowEnd = FFT_SIZE;
+  static int16_t samples[FFT_SIZE], re[FFT_SIZE], im[FFT_SIZE];
+
+  uint32_t head = out->SpectrumHead();
+  if ((int32_t)(head - windowEnd) < 0) return;
+  if (head - windowEnd > SPECTRUM_HOP) windowEnd = head;
+
+  uint32_t start = windowEnd - FFT_SIZE;
+  for (int i = 0; i < FFT_SIZE; i++)
+    samples[i] = out->SpectrumSample(start + i);
+  windowEnd += SPECTRUM_HOP;
+  if (out->SpectrumHead() - start > SPECTRUM_RING_SIZE - I2S_BLOCK_FRAMES || !laserControllerLink.ready()) return;
+
+  fft.window(samples, re, im);
+  int exp = fft.transform(re, im);
+  audio_spectrum_packet_t pkt;
+  fft.bandLevels(re, im, exp, pkt.bands);
+
+  uint8_t buf[PACKET_MAX_LEN(audio_spectrum_packet_t)];
+  link_send(laserControllerLink, udp, PROTOCOL_PORT, buf, packet_encode(pkt, buf, sizeof(buf)));
+}
+
 void sendUDPAudioMetadata() {
   static unsigned long lastAudioDataUpdate = 0;
-  static unsigned long extraDelay = 0;
-  if (millis() - lastAudioDataUpdate > 200 + extraDelay) {
-    uint16_t selectedIndex = getSelectedSongIndex();
-    metaDataPacketBuffer[1] = ((uint16_t)selectedIndex >> 8) & 0xff;
-    metaDataPacketBuffer[2] = selectedIndex & 0xff;
-    metaDataPacketBuffer[5] = songQueueLength;
-    
-    for (uint8_t i = 0; i < songQueueLength; i++) {
-      uint16_t songIndex = songQueue[(songQueueIndex + i) % SONG_QUEUE_LIMIT];
-      metaDataPacketBuffer[6 + i * 2] = ((uint16_t)songIndex >> 8) & 0xff;
-      metaDataPacketBuffer[6 + i * 2 + 1] = songIndex & 0xff;
-    }
+  if (millis() - lastAudioDataUpdate > 200 && ioLink.ready()) {
+    audio_metadata_packet_t pkt;
+    pkt.selectedSong = getSelectedSongIndex();
+    pkt.queueLength = songQueueLength;
+    for (uint8_t i = 0; i < songQueueLength; i++)
+      pkt.queue[i] = songQueue[(songQueueIndex + i) % SONG_QUEUE_LIMIT];
     
     if (wav->isRunning() && jukeboxMode == JUKEBOX_MODE_MUSIC) {
-      for (int i = 0; i < MAX_SONG_NAME_LEN; i++)
-        metaDataPacketBuffer[6 + songQueueLength * 2 + i] = songList[playingSongIndex][i];
-      metaDataPacketBuffer[3] = ((uint16_t)playingSongIndex >> 8) & 0xff;
-      metaDataPacketBuffer[4] = playingSongIndex & 0xff;
+      memset(pkt.songName, 0, MAX_SONG_NAME_LEN);
+      strncpy(pkt.songName, catalog.name(playingSongIndex), MAX_SONG_NAME_LEN - 1);
+      pkt.playingSong = playingSongIndex;
     } else {
-      for (int i = 0; i < MAX_SONG_NAME_LEN; i++)
-        metaDataPacketBuffer[6 + songQueueLength * 2 + i] = 0;
-      metaDataPacketBuffer[3] = 0xff;
-      metaDataPacketBuffer[4] = 0xff;
-    }
-  
-    if (udp.beginPacket(ioIP, 8888) == 1) {
-      udp.write(metaDataPacketBuffer, 6 + songQueueLength * 2 + MAX_SONG_NAME_LEN);
-      extraDelay = udp.endPacket() == 1 ? 0 : 1000;
-    } else {
-      extraDelay = 1000;
+      memset(pkt.songName, 0, MAX_SONG_NAME_LEN);
+      pkt.playingSong = PROTOCOL_SONG_NONE;
     }
 
+    uint8_t buf[PACKET_MAX_LEN(audio_metadata_packet_t)];
+    link_send(ioLink, udp, PROTOCOL_PORT, buf, packet_encode(pkt, buf, sizeof(buf)));
     lastAudioDataUpdate = millis();
   }
 }
 
-void checkForPacket() {
-  int packetSize = udp.parsePacket();
-  if (packetSize) {
-    udp.read(packetBuffer, PACKET_BUF_SIZE);
-    if (packetBuffer[0] == PACKET_ID_JUKEBOX_MODE && packetSize == 2) {
-      nextJukeboxMode = packetBuffer[1];
-    } else if (packetBuffer[0] == PACKET_ID_BUTTON_PRESS && packetSize == 2) {
-      switch (packetBuffer[1]) {
-        case 0:
-          buttonAction(6);
-          break;
-        case 1:
-          buttonAction(5);
-          break;
-        case 2:
-          buttonAction(2);
-          break;
-        case 3:
-          buttonAction(4);
-          break;
-        case 4:
-          buttonAction(3);
-          break;
-        case 5:
-          buttonAction(1);
-          break;
-        default:
-          break;
-      }
-    } else if (packetBuffer[0] == PACKET_ID_PLAY_EFFECT && packetSize - 1 <= MAX_SONG_NAME_LEN) {
-      for (int i = 1; i < packetSize; i++) {
-        effectFileName[i - 1] = packetBuffer[i];
-        if (packetBuffer[i] == 0) break;
-      }
-      playEffect = true;
-    } else if (packetBuffer[0] == PACKET_ID_WAND_DATA && packetSize == 10) {
-      wandButtonPressed = packetBuffer[9];
-
-      uint16_t w = ((uint16_t)packetBuffer[1] << 8) | (uint16_t)packetBuffer[2];
-      uint16_t x = ((uint16_t)packetBuffer[3] << 8) | (uint16_t)packetBuffer[4];
-      uint16_t y = ((uint16_t)packetBuffer[5] << 8) | (uint16_t)packetBuffer[6];
-      uint16_t z = ((uint16_t)packetBuffer[7] << 8) | (uint16_t)packetBuffer[8];
-      
-      double q[4] = {
-        ((double)x - 16384.0) / 16384.0,
-        ((double)y - 16384.0) / 16384.0,
-        ((double)z - 16384.0) / 16384.0,
-        ((double)w - 16384.0) / 16384.0
-      };
-
-      rotate(q, baseVector, wandVector);
-    }
+// Broadcasts the state of both links, see sendLinkStatus() on the laser controller
+void sendLinkStatus() {
+  static unsigned long lastUpdate = 0;
+
+  if (millis() - lastUpdate < LINK_STATUS_PERIOD_MS) return;
+  lastUpdate = millis();
+
+  link_status_packet_t pkt;
+  pkt.uptimeMs = millis();
+  pkt.numLinks = 2;
+  laserControllerLink.report(&pkt.links[0]);
+  ioLink.report(&pkt.links[1]);
+
+  uint8_t buf[PACKET_MAX_LEN(link_status_packet_t)];
+  size_t len = packet_encode(pkt, buf, sizeof(buf));
+  if (udp.beginPacket(statusIP, PROTOCOL_PORT) == 1) {
+    udp.write(buf, len);
+    udp.endPacket();
   }
 }
 
+bool handleJukeboxMode(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  jukebox_mode_packet_t pkt;
+  if (!packet_decode(buf, len, &pkt)) return false;
+  nextJukeboxMode = pkt.mode;
+  return true;
+}
+
+bool handleButtonPress(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  button_press_packet_t pkt;
+  if (!packet_decode(buf, len, &pkt)) return false;
+  switch (pkt.button) {
+    case 0:
+      buttonAction(6);
+      break;
+    case 1:
+      buttonAction(5);
+      break;
+    case 2:
+      buttonAction(2);
+      break;
+    case 3:
+      buttonAction(4);
+      break;
+    case 4:
+      buttonAction(3);
+      break;
+    case 5:
+      buttonAction(1);
+      break;
+    default:
+      break;
+  }
+  return true;
+}
+
+bool handlePlayEffect(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  play_effect_packet_t pkt;
+  if (!packet_decode(buf, len, &pkt)) return false;
+  strcpy(effectFileName, pkt.fileName);
+  playEffect = true;
+  return true;
+}
+
+bool handleWandData(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  wand_data_packet_t pkt;
+  if (!packet_decode(buf, len, &pkt)) return false;
+  wandButtonPressed = pkt.buttonPressed;
+  
+  double q[4] = {
+    ((double)pkt.x - 16384.0) / 16384.0,
+    ((double)pkt.y - 16384.0) / 16384.0,
+    ((double)pkt.z - 16384.0) / 16384.0,
+    ((double)pkt.w - 16384.0) / 16384.0
+  };
+
+  rotate(q, baseVector, wandVector);
+  return true;
+}
+
 void stopAudio() {
   wav->stop();
-  memset(out->udpBuffer + 1, 128, UDP_AUDIO_BUFF_SIZE - 1);
+  meta.stop();
+  beatMailbox.write(audio_beat_packet_t{});
+  memset(out->audioPacket.samples, 128, PROTOCOL_AUDIO_SAMPLES);
+  out->ClearFeatures();
   forceAudioData = true;
 }
 
 void updateAudio() {
   volumeRaw = analogRead(VOL_PIN);
   volume = volumeRaw / 1023.0f;
-  out->SetGain(volume);
+  out->SetGain(jukeboxMode == JUKEBOX_MODE_MUSIC ? volume * playingSong.gain : volume);
   //out->SetGain(volume > 0.02 ? volume : 0);
 
   if (nextJukeboxMode != JUKEBOX_MODE_INVALID) {
@@ -384,38 +493,55 @@ void updateAudio() {
       songPausedPosition = sdSource->getPos();
       songPaused = songPausedPosition > 0;
     }
+    logPlayEnd(PLAY_END_PAUSED);
     stopAudio();
     jukeboxMode = nextJukeboxMode;
     nextJukeboxMode = JUKEBOX_MODE_INVALID;
   }
 
   if (skipSong) {
+    logPlayEnd(PLAY_END_SKIPPED);
     stopAudio();
     skipSong = false;
   }
 
   if (wav->isRunning()) {
-    if (!wav->loop()) stopAudio();
+    // One card access per pass, and only while the output has enough
+    // buffered to wait for it: the playing song first, then its beat
+    // grid, then the next song, then the play log
+    if (wav->loop()) {
+      updateBeat();
+      if (out->BuffersFull() && !sdSource->fill() && !meta.fill() && !preloadNextSong())
+        playLog.flush(false);
+      return;
+    }
+    // The song ended on its own, go straight on to the next one if there
+    // is one. The output keeps playing what it has buffered meanwhile.
+    songEndUs = micros();
+    songEnded = true;
+    logPlayEnd(PLAY_END_FINISHED);
+    if (jukeboxMode == JUKEBOX_MODE_MUSIC && songQueueLength > 0 && startSong(dequeueSong())) return;
+    songEnded = false;
+    stopAudio();
     return;
   }
 
   if (jukeboxMode == JUKEBOX_MODE_MUSIC) {
     if (songPaused) {
       songPaused = false;
-      sdSource->close();
-      if (sdSource->open((String("/songs/") + String(songList[playingSongIndex]) + String(".wav")).c_str())) {
+      if (openSong(sdSource, playingSongIndex, &playingSong)) {
         wav->begin(sdSource, out);
         sdSource->seek(songPausedPosition, SEEK_SET);
+        // The catalog's songs are all 16 bit stereo
+        uint32_t frames = songPausedPosition > WAV_HEADER_LEN ? (songPausedPosition - WAV_HEADER_LEN) / 4 : 0;
+        songStartFrame = out->SpectrumHead() - frames;
+        uint32_t positionMs = (uint64_t)frames * 1000 / out->GetRate();
+        meta.start(playingSong.metaOffset, positionMs);
+        logPlayStart(PLAY_LOG_RESUME, playingSongIndex, 0, 0, positionMs);
       }
     } else {
       int nextSongIndex = dequeueSong();
-      if (nextSongIndex == -1) return;
-      sdSource->close();
-      logSong(nextSongIndex);
-      if (sdSource->open((String("/songs/") + String(songList[nextSongIndex]) + String(".wav")).c_str())) {
-        wav->begin(sdSource, out);
-        playingSongIndex = nextSongIndex;
-      }
+      if (nextSongIndex != -1) startSong(nextSongIndex);
     }
   } else if (jukeboxMode == JUKEBOX_MODE_SYNTH) {
     funcSource = new AudioFileSourceFunction(120.0);
@@ -427,6 +553,109 @@ void updateAudio() {
     if (sdSource->open((const char*)effectFileName))
       wav->begin(sdSource, out);
   }
+
+  if (!wav->isRunning()) playLog.flush(true);
+}
+
+bool openSong(AudioFileSourceReadAhead *source, int index, song_info_t *info) {
+  source->close();
+  return catalog.lookup(index, info) && source->open(info->path);
+}
+
+// Opens the head of the queue in nextSource and fills its read-ahead a
+// chunk per call, only while the output buffers are full so the SD
+// directory lookup cannot starve the song that is playing. Returns false
+// when there was nothing to do.
+bool preloadNextSong() {
+  if (jukeboxMode != JUKEBOX_MODE_MUSIC || songQueueLength == 0 || !out->BuffersFull()) return false;
+  int next = songQueue[songQueueIndex];
+  if (next == preloadedSong) return preloadOk && nextSource->fill();
+
+  preloadedSong = next;
+  preloadOk = openSong(nextSource, next, &nextSong);
+  return true;
+}
+
+// Plays a song from the queue, from nextSource if it was preloaded
+bool startSong(int index) {
+  bool preloaded = preloadOk && index == preloadedSong;
+  preloadedSong = -1;
+  preloadOk = false;
+  if (!preloaded && !openSong(nextSource, index, &nextSong)) {
+    songEnded = false;
+    return false;
+  }
+
+  AudioFileSourceReadAhead *finished = sdSource;
+  sdSource = nextSource;
+  nextSource = finished;
+  nextSource->close();
+
+  playingSong = nextSong;
+  out->SetGain(volume * playingSong.gain);
+  songStartFrame = out->SpectrumHead();
+  wav->begin(sdSource, out);
+  playingSongIndex = index;
+  wav->loop();
+
+  uint32_t gapUs = 0;
+  if (songEnded) {
+    gapUs = transitionUs = micros() - songEndUs;
+    if (transitionUs > transitionMaxUs) transitionMaxUs = transitionUs;
+    transitions++;
+    if (preloaded) transitionsPreloaded++;
+    songEnded = false;
+  }
+
+  // After the first samples are queued, so it stays out of the gap
+  meta.start(playingSong.metaOffset, 0);
+  logPlayStart(PLAY_LOG_SONG, index, dequeuedWaitMs, gapUs, 0);
+  return true;
+}
+
+void logPlayStart(uint8_t type, uint16_t index, uint32_t queueWaitMs, uint32_t gapUs, uint32_t positionMs) {
+  playRecord = play_log_record_t{};
+  playRecord.startMs = millis();
+  playRecord.queueWaitMs = queueWaitMs;
+  playRecord.gapUs = gapUs;
+  playRecord.song = index;
+  playRecord.type = type;
+  playStartPositionMs = positionMs;
+  playRecordOpen = true;
+}
+
+// Call before the song's source is closed or swapped, the read-ahead
+// counters are the song's own until then
+void logPlayEnd(uint8_t end) {
+  if (!playRecordOpen) return;
+  playRecordOpen = false;
+  // At the end of the file the last frames are still in the DMA buffers
+  uint32_t positionMs = end == PLAY_END_FINISHED ? playingSong.durationMs : songPositionMs();
+  playRecord.playedMs = positionMs > playStartPositionMs ? positionMs - playStartPositionMs : 0;
+  playRecord.end = end;
+  playRecord.readAheadMinFill = (uint16_t)min(sdSource->MinFill(), (uint32_t)0xffff);
+  playRecord.underruns = (uint16_t)min(sdSource->Underruns(), (uint32_t)0xffff);
+  playLog.add(playRecord);
+}
+
+// Where the listener is in the playing song
+uint32_t songPositionMs() {
+  uint32_t frames = out->SpectrumHead() - songStartFrame;
+  frames = frames > I2S_LATENCY_FRAMES ? frames - I2S_LATENCY_FRAMES : 0;
+  return (uint64_t)frames * 1000 / out->GetRate();
+}
+
+// Hands core 1 the next beat of the playing song whenever a beat passes,
+// and every BEAT_UPDATE_MS in between so the laser controller stays in step
+void updateBeat() {
+  static unsigned long lastUpdate = 0;
+  static uint16_t lastIndex = 0;
+  audio_beat_packet_t pkt;
+  if (!meta.beatAt(songPositionMs(), &pkt)) return;
+  if (pkt.beatIndex == lastIndex && millis() - lastUpdate < BEAT_UPDATE_MS) return;
+  lastIndex = pkt.beatIndex;
+  lastUpdate = millis();
+  beatMailbox.write(pkt);
 }
 
 void updateSegDisplay() {
@@ -466,18 +695,18 @@ void buttonAction(int index) {
       if (jukeboxMode == JUKEBOX_MODE_MUSIC) enqueueSong();
       break;
     case 4:
-      if (currentNumber < 9 && getSongIndex(currentLetter, currentNumber + 1) < numSongs)
+      if (currentNumber < 9 && getSongIndex(currentLetter, currentNumber + 1) < catalog.count())
         currentNumber++;
       break;
     case 5:
-      if (currentLetter < 25 && getSongIndex(currentLetter + 1, currentNumber) < numSongs)
+      if (currentLetter < 25 && getSongIndex(currentLetter + 1, currentNumber) < catalog.count())
         currentLetter++;
       break;
     case 6:
       if (currentLetter > 0) currentLetter--;
       break;
     case 7:
-      menuMode = (menuMode + 1) % 6;
+      menuMode = (menuMode + 1) % MENU_MODES;
       break;
     default:
       break;
@@ -512,11 +741,20 @@ void updateDisplay() {
     switch (menuMode) {
       case MENU_MODE_SELECTED_SONG:
         display.println("Selected Song: ");
-        display.println(songList[getSelectedSongIndex()]);
+        display.println(catalog.name(getSelectedSongIndex()));
         break;
       case MENU_MODE_CURRENT_SONG:
         display.println("Song Playing: ");
-        display.print(wav->isRunning() && jukeboxMode == JUKEBOX_MODE_MUSIC ? songList[playingSongIndex] : "None");
+        if (wav->isRunning() && jukeboxMode == JUKEBOX_MODE_MUSIC) {
+          display.println(catalog.name(playingSongIndex));
+          display.print(playingSong.durationMs / 60000);
+          display.print(":");
+          uint32_t seconds = playingSong.durationMs / 1000 % 60;
+          if (seconds < 10) display.print("0");
+          display.print(seconds);
+        } else {
+          display.print("None");
+        }
         break;
       case MENU_MODE_SONG_QUEUE:
         display.println("Song Queue: ");
@@ -549,6 +787,24 @@ void updateDisplay() {
         display.print(volumeRaw);
         display.print(" ");
         display.print(volume);
+        break;
+      case MENU_MODE_TRANSITIONS:
+        display.println("Song Transitions:");
+        display.print("Last ");
+        display.print(transitionUs / 1000.0, 1);
+        display.print(" Max ");
+        display.print(transitionMaxUs / 1000.0, 1);
+        display.println(" ms");
+        display.print(transitionsPreloaded);
+        display.print("/");
+        display.print(transitions);
+        display.println(" preloaded");
+        display.print("Read-ahead ");
+        display.print(sdSource->MinFill() / 1024);
+        display.print("K min ");
+        display.print(sdSource->Underruns());
+        display.print(" U");
+        break;
       default:
         break;
     }
@@ -572,6 +828,7 @@ void enqueueSong() {
   if (songQueueLength > 0 && songQueue[(songQueueIndex + songQueueLength - 1) % SONG_QUEUE_LIMIT] == getSelectedSongIndex())
     return;
   songQueue[(songQueueIndex + songQueueLength) % SONG_QUEUE_LIMIT] = getSelectedSongIndex();
+  songQueueTime[(songQueueIndex + songQueueLength) % SONG_QUEUE_LIMIT] = millis();
   songQueueLength++;
 }
 
@@ -579,19 +836,12 @@ int dequeueSong() {
   if (songQueueLength == 0)
     return -1;
   uint16_t songIndex = songQueue[songQueueIndex];
+  dequeuedWaitMs = millis() - songQueueTime[songQueueIndex];
   songQueueLength--;
   songQueueIndex = (songQueueIndex + 1) % SONG_QUEUE_LIMIT;
   return songIndex;
 }
 
-void logSong(int index) {
-  File f = SD.open("/play_log.txt", FILE_WRITE);
-  if (f) {
-    f.println(songList[index]);
-    f.close();
-  }
-}
-
 void rotate(double q[4], double v[3], double result[3]) {
   double conj[4] = { -q[0], -q[1], -q[2], q[3] };
   double qv[4] = {
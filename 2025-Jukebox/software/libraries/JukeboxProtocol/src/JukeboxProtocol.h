@@ -0,0 +1,498 @@
+#ifndef _JUKEBOX_PROTOCOL_
+#define _JUKEBOX_PROTOCOL_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Packets exchanged by the 2025 nodes (jukebox, laser controller, UI module)
+// on UDP port 8888. Every packet is framed as
+//
+//   [id] [version] [payload ...] [crc hi] [crc lo]
+//
+// with big-endian fields and a CRC-16/CCITT-FALSE over id, version and
+// payload. Fields are only ever appended: a node accepts a newer version as
+// long as the payload holds the fields it knows, and ignores the rest.
+//
+// Sending:   size_t len = packet_encode(pkt, buf, sizeof(buf));
+// Receiving: switch (packet_check(buf, len)) {
+//              case PACKET_ID_WAND_DATA:
+//                if (packet_decode(buf, len, &wand)) ...
+//
+// The laser point stream on port 8090 goes to the projectors and is not
+// framed by this library.
+
+#define PROTOCOL_VERSION 1
+#define PROTOCOL_PORT    8888
+
+#define PACKET_HEADER_LEN   2
+#define PACKET_CRC_LEN      2
+#define PACKET_OVERHEAD     (PACKET_HEADER_LEN + PACKET_CRC_LEN)
+#define PACKET_LEN(payload) ((payload) + PACKET_OVERHEAD)
+
+#define PACKET_ID_ROBBIE_MODE         1
+#define PACKET_ID_LASER_DATA          2
+#define PACKET_ID_AUDIO_DATA          3
+#define PACKET_ID_BUTTON_PRESS        4
+#define PACKET_ID_AUDIO_METADATA      5
+#define PACKET_ID_PLAY_EFFECT         6
+#define PACKET_ID_WAND_DATA           7
+#define PACKET_ID_JUKEBOX_MODE        8
+#define PACKET_ID_POINT_STATS_REQUEST 9
+#define PACKET_ID_POINT_STATS         10
+#define PACKET_ID_LINK_STATUS         11
+#define PACKET_ID_AUDIO_FEATURES      12
+#define PACKET_ID_AUDIO_SPECTRUM      13
+#define PACKET_ID_AUDIO_BEAT          14
+
+#define PROTOCOL_AUDIO_SAMPLES  1024
+#define PROTOCOL_SONG_NAME_LEN  60
+#define PROTOCOL_SONG_QUEUE_MAX 20
+#define PROTOCOL_SONG_NONE      0xffff
+#define PROTOCOL_JITTER_BUCKETS 8
+#define PROTOCOL_MAX_LINKS      8
+#define PROTOCOL_LINK_NEVER     0xffffffff
+#define PROTOCOL_FEATURE_BANDS  4
+#define PROTOCOL_SPECTRUM_BANDS 16
+
+#define AUDIO_FEATURE_ONSET     0x01
+
+/////////////////////////////////////////////////////////////////////
+
+typedef struct {
+  uint8_t mode;
+} robbie_mode_packet_t;
+
+typedef struct {
+  uint8_t samples[PROTOCOL_AUDIO_SAMPLES];
+} audio_data_packet_t;
+
+typedef struct {
+  uint8_t button;
+} button_press_packet_t;
+
+typedef struct {
+  uint16_t selectedSong;
+  uint16_t playingSong;  // PROTOCOL_SONG_NONE when nothing is playing
+  uint8_t queueLength;
+  uint16_t queue[PROTOCOL_SONG_QUEUE_MAX];
+  char songName[PROTOCOL_SONG_NAME_LEN];
+} audio_metadata_packet_t;
+
+typedef struct {
+  char fileName[PROTOCOL_SONG_NAME_LEN];
+} play_effect_packet_t;
+
+typedef struct {
+  uint16_t w, x, y, z;
+  uint8_t buttonPressed;
+} wand_data_packet_t;
+
+typedef struct {
+  uint8_t mode;
+} jukebox_mode_packet_t;
+
+typedef struct {
+  uint16_t periodUs;  // 0 or out of range keeps the current period
+} point_stats_request_packet_t;
+
+typedef struct {
+  uint16_t periodUs;
+  uint16_t queueLevel, queueMin, queueMax;
+  uint32_t ticks;
+  uint32_t lateTicks;     // ticks that fired before the last point was generated
+  uint32_t skippedTicks;  // ticks dropped by catch-up, never generated
+  uint32_t dropped;       // points generated while the queue was full
+  uint32_t jitter[PROTOCOL_JITTER_BUCKETS];
+} point_stats_packet_t;
+
+// One destination a node sends to, see LinkHealth.h
+typedef struct {
+  uint8_t ip[4];
+  uint32_t successes, failures;
+  uint16_t consecutiveFailures;
+  uint16_t backoffMs;
+  uint32_t lastSuccessAgeMs;  // PROTOCOL_LINK_NEVER before the first success
+  uint16_t latencyAvgUs, latencyMaxUs;
+} link_status_t;
+
+typedef struct {
+  uint32_t uptimeMs;
+  uint8_t numLinks;
+  link_status_t links[PROTOCOL_MAX_LINKS];
+} link_status_packet_t;
+
+// Summary of the last few ms of audio, levels are 0-32767 like the samples
+typedef struct {
+  uint16_t rms;
+  uint16_t peak;
+  uint16_t bands[PROTOCOL_FEATURE_BANDS];  // RMS per band, lowest first
+  uint16_t centroidHz;
+  uint8_t flags;                           // AUDIO_FEATURE_ONSET
+  uint8_t beats;                           // bumped on every onset
+} audio_features_packet_t;
+
+// RMS per log-spaced FFT band, from about 43 Hz up to Nyquist
+typedef struct {
+  uint16_t bands[PROTOCOL_SPECTRUM_BANDS];
+} audio_spectrum_packet_t;
+
+// Where the playing song is in its precomputed beat grid
+typedef struct {
+  uint16_t nextBeatMs;    // until the next beat, from when the packet was sent
+  uint16_t beatPeriodMs;  // 0 when there is no beat grid
+  uint16_t beatIndex;     // of the next beat, counted from the start of the song
+  uint8_t level;          // loudness at the next beat, 0 is -60 dBFS and 255 full scale
+} audio_beat_packet_t;
+
+/////////////////////////////////////////////////////////////////////
+
+typedef struct {
+  uint16_t v[256];
+} packet_crc_table_t;
+
+constexpr packet_crc_table_t make_packet_crc_table() {
+  packet_crc_table_t t = {};
+  for (int i = 0; i < 256; i++) {
+    uint16_t crc = (uint16_t)(i << 8);
+    for (int b = 0; b < 8; b++)
+      crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    t.v[i] = crc;
+  }
+  return t;
+}
+
+inline constexpr packet_crc_table_t PACKET_CRC_TABLE = make_packet_crc_table();
+
+inline uint16_t packet_crc(const uint8_t *buf, size_t len) {
+  uint16_t crc = 0xffff;
+  for (size_t i = 0; i < len; i++)
+    crc = (uint16_t)(crc << 8) ^ PACKET_CRC_TABLE.v[(crc >> 8) ^ buf[i]];
+  return crc;
+}
+
+class packet_writer {
+  public:
+    packet_writer(uint8_t *buf) : _buf(buf), _pos(0) {}
+    void u8(uint8_t v) { _buf[_pos++] = v; }
+    void u16(uint16_t v) { u8((uint8_t)(v >> 8)); u8((uint8_t)(v & 0xff)); }
+    void u32(uint32_t v) { u16((uint16_t)(v >> 16)); u16((uint16_t)(v & 0xffff)); }
+    void bytes(const void *src, size_t n) { memcpy(_buf + _pos, src, n); _pos += n; }
+    size_t pos() const { return _pos; }
+
+  private:
+    uint8_t *_buf;
+    size_t _pos;
+};
+
+// Reads past the end return 0 and latch overrun(), so schemas can read
+// unconditionally and check once at the end
+class packet_reader {
+  public:
+    packet_reader(const uint8_t *buf, size_t len) : _buf(buf), _len(len), _pos(0), _overrun(false) {}
+    uint8_t u8() {
+      if (_pos >= _len) { _overrun = true; return 0; }
+      return _buf[_pos++];
+    }
+    uint16_t u16() { uint16_t hi = u8(); return (uint16_t)(hi << 8 | u8()); }
+    uint32_t u32() { uint32_t hi = u16(); return hi << 16 | u16(); }
+    bool bytes(void *dst, size_t n) {
+      // Checked against _len rather than remaining() so GCC can bound the
+      // copy and does not warn about fixed size fields on short buffers
+      if (n > _len || _pos > _len - n) { _overrun = true; return false; }
+      memcpy(dst, _buf + _pos, n);
+      _pos += n;
+      return true;
+    }
+    size_t remaining() const { return _len - _pos; }
+    bool overrun() const { return _overrun; }
+
+  private:
+    const uint8_t *_buf;
+    size_t _len;
+    size_t _pos;
+    bool _overrun;
+};
+
+/////////////////////////////////////////////////////////////////////
+
+// One specialization per packet: its id, the largest payload it can encode
+// to, the payload length of a given packet, and how to write and read it
+template <typename T> struct packet_schema;
+
+template <> struct packet_schema<robbie_mode_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_ROBBIE_MODE;
+  static constexpr size_t max_len = 1;
+  static size_t len(const robbie_mode_packet_t &) { return max_len; }
+  static void write(const robbie_mode_packet_t &p, packet_writer &w) { w.u8(p.mode); }
+  static bool read(packet_reader &r, robbie_mode_packet_t &p) { p.mode = r.u8(); return true; }
+};
+
+template <> struct packet_schema<audio_data_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_AUDIO_DATA;
+  static constexpr size_t max_len = PROTOCOL_AUDIO_SAMPLES;
+  static size_t len(const audio_data_packet_t &) { return max_len; }
+  static void write(const audio_data_packet_t &p, packet_writer &w) { w.bytes(p.samples, PROTOCOL_AUDIO_SAMPLES); }
+  static bool read(packet_reader &r, audio_data_packet_t &p) { return r.bytes(p.samples, PROTOCOL_AUDIO_SAMPLES); }
+};
+
+template <> struct packet_schema<button_press_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_BUTTON_PRESS;
+  static constexpr size_t max_len = 1;
+  static size_t len(const button_press_packet_t &) { return max_len; }
+  static void write(const button_press_packet_t &p, packet_writer &w) { w.u8(p.button); }
+  static bool read(packet_reader &r, button_press_packet_t &p) { p.button = r.u8(); return true; }
+};
+
+template <> struct packet_schema<audio_metadata_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_AUDIO_METADATA;
+  static constexpr size_t max_len = 5 + 2 * PROTOCOL_SONG_QUEUE_MAX + PROTOCOL_SONG_NAME_LEN;
+  static size_t len(const audio_metadata_packet_t &p) {
+    return 5 + 2 * (size_t)p.queueLength + PROTOCOL_SONG_NAME_LEN;
+  }
+  static void write(const audio_metadata_packet_t &p, packet_writer &w) {
+    w.u16(p.selectedSong);
+    w.u16(p.playingSong);
+    w.u8(p.queueLength);
+    for (uint8_t i = 0; i < p.queueLength; i++)
+      w.u16(p.queue[i]);
+    w.bytes(p.songName, PROTOCOL_SONG_NAME_LEN);
+  }
+  static bool read(packet_reader &r, audio_metadata_packet_t &p) {
+    p.selectedSong = r.u16();
+    p.playingSong = r.u16();
+    p.queueLength = r.u8();
+    if (p.queueLength > PROTOCOL_SONG_QUEUE_MAX) return false;
+    for (uint8_t i = 0; i < p.queueLength; i++)
+      p.queue[i] = r.u16();
+    if (!r.bytes(p.songName, PROTOCOL_SONG_NAME_LEN)) return false;
+    p.songName[PROTOCOL_SONG_NAME_LEN - 1] = '\0';
+    return true;
+  }
+};
+
+// The name is sent with its terminator, so later fields can follow it
+template <> struct packet_schema<play_effect_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_PLAY_EFFECT;
+  static constexpr size_t max_len = PROTOCOL_SONG_NAME_LEN;
+  static size_t len(const play_effect_packet_t &p) { return strnlen(p.fileName, PROTOCOL_SONG_NAME_LEN - 1) + 1; }
+  static void write(const play_effect_packet_t &p, packet_writer &w) {
+    size_t n = len(p) - 1;
+    w.bytes(p.fileName, n);
+    w.u8(0);
+  }
+  static bool read(packet_reader &r, play_effect_packet_t &p) {
+    for (size_t i = 0; i < PROTOCOL_SONG_NAME_LEN && r.remaining() > 0; i++) {
+      p.fileName[i] = (char)r.u8();
+      if (p.fileName[i] == '\0') return true;
+    }
+    return false;
+  }
+};
+
+template <> struct packet_schema<wand_data_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_WAND_DATA;
+  static constexpr size_t max_len = 9;
+  static size_t len(const wand_data_packet_t &) { return max_len; }
+  static void write(const wand_data_packet_t &p, packet_writer &w) {
+    w.u16(p.w);
+    w.u16(p.x);
+    w.u16(p.y);
+    w.u16(p.z);
+    w.u8(p.buttonPressed);
+  }
+  static bool read(packet_reader &r, wand_data_packet_t &p) {
+    p.w = r.u16();
+    p.x = r.u16();
+    p.y = r.u16();
+    p.z = r.u16();
+    p.buttonPressed = r.u8();
+    return true;
+  }
+};
+
+template <> struct packet_schema<jukebox_mode_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_JUKEBOX_MODE;
+  static constexpr size_t max_len = 1;
+  static size_t len(const jukebox_mode_packet_t &) { return max_len; }
+  static void write(const jukebox_mode_packet_t &p, packet_writer &w) { w.u8(p.mode); }
+  static bool read(packet_reader &r, jukebox_mode_packet_t &p) { p.mode = r.u8(); return true; }
+};
+
+template <> struct packet_schema<point_stats_request_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_POINT_STATS_REQUEST;
+  static constexpr size_t max_len = 2;
+  static size_t len(const point_stats_request_packet_t &) { return max_len; }
+  static void write(const point_stats_request_packet_t &p, packet_writer &w) { w.u16(p.periodUs); }
+  static bool read(packet_reader &r, point_stats_request_packet_t &p) { p.periodUs = r.u16(); return true; }
+};
+
+template <> struct packet_schema<point_stats_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_POINT_STATS;
+  static constexpr size_t max_len = 2 * 4 + 4 * 4 + 4 * PROTOCOL_JITTER_BUCKETS;
+  static size_t len(const point_stats_packet_t &) { return max_len; }
+  static void write(const point_stats_packet_t &p, packet_writer &w) {
+    w.u16(p.periodUs);
+    w.u16(p.queueLevel);
+    w.u16(p.queueMin);
+    w.u16(p.queueMax);
+    w.u32(p.ticks);
+    w.u32(p.lateTicks);
+    w.u32(p.skippedTicks);
+    w.u32(p.dropped);
+    for (int i = 0; i < PROTOCOL_JITTER_BUCKETS; i++)
+      w.u32(p.jitter[i]);
+  }
+  static bool read(packet_reader &r, point_stats_packet_t &p) {
+    p.periodUs = r.u16();
+    p.queueLevel = r.u16();
+    p.queueMin = r.u16();
+    p.queueMax = r.u16();
+    p.ticks = r.u32();
+    p.lateTicks = r.u32();
+    p.skippedTicks = r.u32();
+    p.dropped = r.u32();
+    for (int i = 0; i < PROTOCOL_JITTER_BUCKETS; i++)
+      p.jitter[i] = r.u32();
+    return true;
+  }
+};
+
+template <> struct packet_schema<link_status_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_LINK_STATUS;
+  static constexpr size_t link_len = 4 + 4 * 2 + 2 * 2 + 4 + 2 * 2;
+  static constexpr size_t max_len = 5 + link_len * PROTOCOL_MAX_LINKS;
+  static size_t len(const link_status_packet_t &p) { return 5 + link_len * (size_t)p.numLinks; }
+  static void write(const link_status_packet_t &p, packet_writer &w) {
+    w.u32(p.uptimeMs);
+    w.u8(p.numLinks);
+    for (uint8_t i = 0; i < p.numLinks; i++) {
+      const link_status_t &l = p.links[i];
+      w.bytes(l.ip, 4);
+      w.u32(l.successes);
+      w.u32(l.failures);
+      w.u16(l.consecutiveFailures);
+      w.u16(l.backoffMs);
+      w.u32(l.lastSuccessAgeMs);
+      w.u16(l.latencyAvgUs);
+      w.u16(l.latencyMaxUs);
+    }
+  }
+  static bool read(packet_reader &r, link_status_packet_t &p) {
+    p.uptimeMs = r.u32();
+    p.numLinks = r.u8();
+    if (p.numLinks > PROTOCOL_MAX_LINKS) return false;
+    for (uint8_t i = 0; i < p.numLinks; i++) {
+      link_status_t &l = p.links[i];
+      r.bytes(l.ip, 4);
+      l.successes = r.u32();
+      l.failures = r.u32();
+      l.consecutiveFailures = r.u16();
+      l.backoffMs = r.u16();
+      l.lastSuccessAgeMs = r.u32();
+      l.latencyAvgUs = r.u16();
+      l.latencyMaxUs = r.u16();
+    }
+    return true;
+  }
+};
+
+template <> struct packet_schema<audio_features_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_AUDIO_FEATURES;
+  static constexpr size_t max_len = 2 * 2 + 2 * PROTOCOL_FEATURE_BANDS + 2 + 2;
+  static size_t len(const audio_features_packet_t &) { return max_len; }
+  static void write(const audio_features_packet_t &p, packet_writer &w) {
+    w.u16(p.rms);
+    w.u16(p.peak);
+    for (int i = 0; i < PROTOCOL_FEATURE_BANDS; i++)
+      w.u16(p.bands[i]);
+    w.u16(p.centroidHz);
+    w.u8(p.flags);
+    w.u8(p.beats);
+  }
+  static bool read(packet_reader &r, audio_features_packet_t &p) {
+    p.rms = r.u16();
+    p.peak = r.u16();
+    for (int i = 0; i < PROTOCOL_FEATURE_BANDS; i++)
+      p.bands[i] = r.u16();
+    p.centroidHz = r.u16();
+    p.flags = r.u8();
+    p.beats = r.u8();
+    return true;
+  }
+};
+
+template <> struct packet_schema<audio_spectrum_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_AUDIO_SPECTRUM;
+  static constexpr size_t max_len = 2 * PROTOCOL_SPECTRUM_BANDS;
+  static size_t len(const audio_spectrum_packet_t &) { return max_len; }
+  static void write(const audio_spectrum_packet_t &p, packet_writer &w) {
+    for (int i = 0; i < PROTOCOL_SPECTRUM_BANDS; i++)
+      w.u16(p.bands[i]);
+  }
+  static bool read(packet_reader &r, audio_spectrum_packet_t &p) {
+    for (int i = 0; i < PROTOCOL_SPECTRUM_BANDS; i++)
+      p.bands[i] = r.u16();
+    return true;
+  }
+};
+
+template <> struct packet_schema<audio_beat_packet_t> {
+  static constexpr uint8_t id = PACKET_ID_AUDIO_BEAT;
+  static constexpr size_t max_len = 2 + 2 + 2 + 1;
+  static size_t len(const audio_beat_packet_t &) { return max_len; }
+  static void write(const audio_beat_packet_t &p, packet_writer &w) {
+    w.u16(p.nextBeatMs);
+    w.u16(p.beatPeriodMs);
+    w.u16(p.beatIndex);
+    w.u8(p.level);
+  }
+  static bool read(packet_reader &r, audio_beat_packet_t &p) {
+    p.nextBeatMs = r.u16();
+    p.beatPeriodMs = r.u16();
+    p.beatIndex = r.u16();
+    p.level = r.u8();
+    return true;
+  }
+};
+
+// Largest framed packet for a type, for sizing send buffers
+#define PACKET_MAX_LEN(T) PACKET_LEN(packet_schema<T>::max_len)
+
+/////////////////////////////////////////////////////////////////////
+
+// Frames p into buf and returns the packet length, or 0 if it does not fit
+template <typename T>
+size_t packet_encode(const T &p, uint8_t *buf, size_t cap) {
+  size_t len = packet_schema<T>::len(p);
+  if (len > packet_schema<T>::max_len || PACKET_LEN(len) > cap) return 0;
+
+  packet_writer w(buf);
+  w.u8(packet_schema<T>::id);
+  w.u8(PROTOCOL_VERSION);
+  packet_schema<T>::write(p, w);
+  w.u16(packet_crc(buf, w.pos()));
+  return w.pos();
+}
+
+// Validates the framing and CRC of a received packet and returns its id,
+// or -1 if it is not a well formed packet
+inline int packet_check(const uint8_t *buf, size_t len) {
+  if (len < PACKET_OVERHEAD || buf[1] == 0) return -1;
+  uint16_t crc = (uint16_t)buf[len - 2] << 8 | buf[len - 1];
+  if (packet_crc(buf, len - PACKET_CRC_LEN) != crc) return -1;
+  return buf[0];
+}
+
+// Decodes a packet that has passed packet_check(). A packet from the same
+// protocol version must match the schema exactly; a newer one may carry
+// extra trailing fields.
+template <typename T>
+bool packet_decode(const uint8_t *buf, size_t len, T *p) {
+  if (len < PACKET_OVERHEAD || buf[0] != packet_schema<T>::id) return false;
+  packet_reader r(buf + PACKET_HEADER_LEN, len - PACKET_OVERHEAD);
+  if (!packet_schema<T>::read(r, *p) || r.overrun()) return false;
+  return buf[1] > PROTOCOL_VERSION || r.remaining() == 0;
+}
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef _LINK_HEALTH_
+#define _LINK_HEALTH_
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include "JukeboxProtocol.h"
+
+// Send health of one UDP destination. Failed sends back off exponentially
+// from backoffMinMs up to backoffMaxMs, and the link is retried at that
+// interval for as long as it stays down, so a projector or node that comes
+// back late is picked up again without a reset.
+//
+// link_send() covers the common case of a complete packet. Packets that are
+// streamed into the socket over several calls time just the endPacket():
+//
+//   unsigned long start = micros();
+//   bool ok = udp.endPacket() == 1;
+//   link.record(ok, micros() - start);
+
+#define LINK_STATUS_PERIOD_MS 2000
+
+class LinkHealth {
+  public:
+    IPAddress ip;
+    uint32_t successes = 0;
+    uint32_t failures = 0;
+    uint16_t consecutiveFailures = 0;
+    unsigned long backoffMs = 0;
+    unsigned long lastSuccessMs = 0;
+    bool everSucceeded = false;
+    uint32_t latencyAvgUs = 0;
+    uint32_t latencyMaxUs = 0;
+
+    LinkHealth(IPAddress ip, unsigned long backoffMinMs, unsigned long backoffMaxMs)
+      : ip(ip), _backoffMinMs(backoffMinMs), _backoffMaxMs(backoffMaxMs) {}
+
+    // False while the link is backing off after a failure
+    bool ready() const {
+      return consecutiveFailures == 0 || millis() - _lastAttemptMs >= backoffMs;
+    }
+
+    void record(bool ok, uint32_t latencyUs) {
+      _lastAttemptMs = millis();
+      if (ok) {
+        successes++;
+        consecutiveFailures = 0;
+        backoffMs = 0;
+        lastSuccessMs = _lastAttemptMs;
+        everSucceeded = true;
+      } else {
+        failures++;
+        if (consecutiveFailures < UINT16_MAX) consecutiveFailures++;
+        backoffMs = backoffMs == 0 ? _backoffMinMs : min(backoffMs * 2, _backoffMaxMs);
+      }
+
+      // Running average over roughly the last 8 sends
+      latencyAvgUs = latencyAvgUs == 0 ? latencyUs : latencyAvgUs + ((int32_t)(latencyUs - latencyAvgUs) >> 3);
+      if (latencyUs > latencyMaxUs) latencyMaxUs = latencyUs;
+    }
+
+    // Fills one entry of a link status packet. The latency maximum is per
+    // report and starts over afterwards.
+    void report(link_status_t *status) {
+      for (int i = 0; i < 4; i++)
+        status->ip[i] = ip[i];
+      status->successes = successes;
+      status->failures = failures;
+      status->consecutiveFailures = consecutiveFailures;
+      status->backoffMs = (uint16_t)min(backoffMs, 0xffffUL);
+      status->lastSuccessAgeMs = everSucceeded ? (uint32_t)(millis() - lastSuccessMs) : PROTOCOL_LINK_NEVER;
+      status->latencyAvgUs = (uint16_t)min(latencyAvgUs, (uint32_t)0xffff);
+      status->latencyMaxUs = (uint16_t)min(latencyMaxUs, (uint32_t)0xffff);
+      latencyMaxUs = 0;
+    }
+
+  private:
+    unsigned long _backoffMinMs;
+    unsigned long _backoffMaxMs;
+    unsigned long _lastAttemptMs = 0;
+};
+
+// Sends buf to the link's address unless it is backing off, and records
+// the result. Works with any UDP class that has the Arduino UDP interface.
+template <typename UDP>
+bool link_send(LinkHealth &link, UDP &udp, uint16_t port, const uint8_t *buf, size_t len) {
+  if (!link.ready()) return false;
+  unsigned long start = micros();
+  bool ok = udp.beginPacket(link.ip, port) == 1;
+  if (ok) {
+    udp.write(buf, len);
+    ok = udp.endPacket() == 1;
+  }
+  link.record(ok, micros() - start);
+  return ok;
+}
+
+#endif
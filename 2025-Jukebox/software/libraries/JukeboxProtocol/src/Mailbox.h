@@ -0,0 +1,65 @@
+#ifndef _MAILBOX_
+#define _MAILBOX_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Latest value of a struct handed from one core to the other without a
+// lock. One side calls write(), the other read(); neither ever waits on the
+// other.
+//
+// The value is double buffered. write() fills the slot the reader is not
+// using and then publishes it by bumping the version, whose low bit picks
+// the slot. read() copies the published slot and checks that the version
+// did not move while it was copying. If it did, the writer may already be
+// refilling that slot, so the copy is thrown away and taken again. A
+// reader is only retried when a write completes during its copy, not every
+// time the two overlap.
+//
+// The version starts at 0 with an all-zero value and goes up by one per
+// write, so the consumer can skip the copy when nothing changed:
+//
+//   if (audioMailbox.version() != audioVersion)
+//     audioVersion = audioMailbox.read(&samples);
+template <typename T>
+class Mailbox {
+  public:
+    Mailbox() {
+      memset(_slots, 0, sizeof(_slots));
+    }
+
+    // Producer side
+    void write(const T &value) {
+      uint32_t seq = __atomic_load_n(&_seq, __ATOMIC_RELAXED);
+      // The slot being filled was the published one until the last write
+      // bumped _seq, keep that store ahead of the ones below
+      __atomic_thread_fence(__ATOMIC_RELEASE);
+      memcpy(&_slots[(seq + 1) & 1], &value, sizeof(T));
+      __atomic_store_n(&_seq, seq + 1, __ATOMIC_RELEASE);
+    }
+
+    // Consumer side. Copies the latest value to out and returns its version.
+    uint32_t read(T *out) {
+      while (true) {
+        uint32_t seq = __atomic_load_n(&_seq, __ATOMIC_ACQUIRE);
+        memcpy(out, &_slots[seq & 1], sizeof(T));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&_seq, __ATOMIC_RELAXED) == seq) return seq;
+        retries++;
+      }
+    }
+
+    uint32_t version() const {
+      return __atomic_load_n(&_seq, __ATOMIC_ACQUIRE);
+    }
+
+    // Copies read() threw away, only touched by the consumer
+    uint32_t retries = 0;
+
+  private:
+    uint32_t _seq = 0;
+    T _slots[2];
+};
+
+#endif
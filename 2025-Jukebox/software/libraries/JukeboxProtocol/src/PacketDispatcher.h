@@ -0,0 +1,103 @@
+#ifndef _PACKET_DISPATCHER_
+#define _PACKET_DISPATCHER_
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include "JukeboxProtocol.h"
+#include "PacketRing.h"
+#include "WizInterrupt.h"
+
+// Receive side shared by all nodes. Each poll() drains the socket into a
+// ring once the W5500 signals, then runs the handler registered for each
+// packet's id, and stops either step when the pass has used budgetUs. A
+// socket that still had data when the budget ran out is picked up again on
+// the next pass without waiting for another interrupt.
+//
+//   rx.on(PACKET_ID_WAND_DATA, handleWandData);
+//   ...
+//   rx.poll(udp, wizInt, RX_BUDGET_US);
+//
+// Handlers get a packet that has already passed packet_check() and return
+// false if packet_decode() rejects it.
+
+#define DISPATCH_MAX_ID 32
+
+typedef bool (*packet_handler_t)(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort);
+
+template <size_t SLOTS, size_t SIZE>
+class PacketDispatcher {
+  public:
+    typedef PacketRing<SLOTS, SIZE> ring_t;
+
+    uint32_t received = 0;   // datagrams read from the socket
+    uint32_t handled = 0;    // accepted by their handler
+    uint32_t dropped = 0;    // bad CRC, no handler, or rejected by the handler
+    uint32_t truncated = 0;  // longer than a slot, discarded unread
+    uint32_t deferred = 0;   // passes that ran out of budget with work left
+
+    void on(uint8_t id, packet_handler_t handler) {
+      if (id < DISPATCH_MAX_ID) _handlers[id] = handler;
+    }
+
+    template <typename UDP>
+    void poll(UDP &udp, WizInterrupt &wiz, unsigned long budgetUs) {
+      unsigned long start = micros();
+
+      if (_backlog || wiz.pending()) {
+        wiz.acknowledge();
+        _backlog = false;
+        while (true) {
+          if (micros() - start >= budgetUs) {
+            _backlog = true;
+            break;
+          }
+          typename ring_t::slot_t *slot = _ring.reserve();
+          if (!slot) {
+            // Leave the rest in the W5500 until the ring has room
+            _backlog = true;
+            break;
+          }
+          int size = udp.parsePacket();
+          if (size <= 0) break;
+          received++;
+          if (size > (int)SIZE) {
+            truncated++;
+            continue;
+          }
+          int len = udp.read(slot->data, SIZE);
+          if (len <= 0) continue;
+          slot->len = len;
+          slot->remoteIP = (uint32_t)udp.remoteIP();
+          slot->remotePort = udp.remotePort();
+          _ring.commit();
+        }
+      }
+
+      typename ring_t::slot_t *slot;
+      while ((slot = _ring.peek()) != NULL) {
+        if (micros() - start >= budgetUs) {
+          deferred++;
+          return;
+        }
+        dispatch(slot);
+        _ring.pop();
+      }
+      if (_backlog) deferred++;
+    }
+
+  private:
+    ring_t _ring;
+    packet_handler_t _handlers[DISPATCH_MAX_ID] = {};
+    bool _backlog = false;
+
+    void dispatch(typename ring_t::slot_t *slot) {
+      int id = packet_check(slot->data, slot->len);
+      packet_handler_t handler = id >= 0 && id < DISPATCH_MAX_ID ? _handlers[id] : NULL;
+      if (handler && handler(slot->data, slot->len, IPAddress(slot->remoteIP), slot->remotePort))
+        handled++;
+      else
+        dropped++;
+    }
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef _PACKET_RING_
+#define _PACKET_RING_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Single producer, single consumer ring of received datagrams. The producer
+// fills a slot from reserve() and publishes it with commit(); the consumer
+// reads it from peek() and frees it with pop(). Head and tail are each
+// written by one side only, so no lock is needed, and the two sides may run
+// in different contexts or on different cores.
+template <size_t SLOTS, size_t SIZE>
+class PacketRing {
+  static_assert((SLOTS & (SLOTS - 1)) == 0, "slot count must be a power of two");
+
+  public:
+    typedef struct {
+      uint16_t len;
+      uint32_t remoteIP;
+      uint16_t remotePort;
+      uint8_t data[SIZE];
+    } slot_t;
+
+    // Producer side. Returns NULL when the ring is full.
+    slot_t *reserve() {
+      uint32_t head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+      uint32_t tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+      if (head - tail >= SLOTS) return NULL;
+      return &_slots[head & (SLOTS - 1)];
+    }
+
+    void commit() {
+      __atomic_store_n(&_head, _head + 1, __ATOMIC_RELEASE);
+    }
+
+    // Consumer side. Returns NULL when the ring is empty.
+    slot_t *peek() {
+      uint32_t tail = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+      uint32_t head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+      if (head == tail) return NULL;
+      return &_slots[tail & (SLOTS - 1)];
+    }
+
+    void pop() {
+      __atomic_store_n(&_tail, _tail + 1, __ATOMIC_RELEASE);
+    }
+
+    size_t size() const {
+      return __atomic_load_n(&_head, __ATOMIC_ACQUIRE) - __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+    }
+
+  private:
+    uint32_t _head = 0;
+    uint32_t _tail = 0;
+    slot_t _slots[SLOTS];
+};
+
+#endif
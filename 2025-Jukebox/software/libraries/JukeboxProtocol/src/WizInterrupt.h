@@ -0,0 +1,85 @@
+#ifndef _WIZ_INTERRUPT_
+#define _WIZ_INTERRUPT_
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Ethernet.h>
+#include <utility/w5100.h>
+
+// Receive notification from the W5500 INT pin, so a node only talks to the
+// chip over SPI when a datagram has actually arrived instead of calling
+// parsePacket() on every loop. Only RECV interrupts are enabled. INT stays
+// low until the socket's RECV flag is cleared, so acknowledge() has to come
+// before the socket is drained; a datagram that lands during the drain then
+// raises INT again instead of being missed.
+//
+//   if (wizInt.pending()) {
+//     wizInt.acknowledge();
+//     while (udp.parsePacket() > 0) ...
+//   }
+//
+// The pin is also polled now and then in case an edge is lost or INT is not
+// wired on a board.
+
+#define W5500_SIR            0x0017
+#define W5500_SIMR           0x0018
+#define W5500_SN_IMR         0x002c
+#define W5500_SN_IR_RECV     0x04
+#define W5500_SOCKETS        8
+#define WIZ_POLL_FALLBACK_MS 100
+
+class WizInterrupt {
+  public:
+    uint32_t interrupts = 0;
+    uint32_t fallbackPolls = 0;
+
+    // Call after Ethernet.begin(), from the core that receives
+    void begin(uint8_t pin) {
+      _pin = pin;
+      pinMode(pin, INPUT_PULLUP);
+
+      SPI.beginTransaction(SPI_ETHERNET_SETTINGS);
+      for (uint8_t s = 0; s < W5500_SOCKETS; s++) {
+        W5100.writeSn(s, W5500_SN_IMR, W5500_SN_IR_RECV);
+        W5100.writeSnIR(s, W5500_SN_IR_RECV);
+      }
+      W5100.write(W5500_SIMR, (uint8_t)0xff);
+      SPI.endTransaction();
+
+      attachInterrupt(digitalPinToInterrupt(pin), isr, FALLING);
+    }
+
+    // True when a socket may have data. Costs a GPIO read, no SPI.
+    bool pending() {
+      if (_flag || digitalRead(_pin) == LOW) return true;
+      if (millis() - _lastAckMs >= WIZ_POLL_FALLBACK_MS) {
+        fallbackPolls++;
+        return true;
+      }
+      return false;
+    }
+
+    // Clears the RECV flag of every socket that raised one
+    void acknowledge() {
+      if (_flag) interrupts++;
+      _flag = false;
+      _lastAckMs = millis();
+
+      SPI.beginTransaction(SPI_ETHERNET_SETTINGS);
+      uint8_t sir = W5100.read(W5500_SIR);
+      for (uint8_t s = 0; s < W5500_SOCKETS; s++)
+        if (sir & (1 << s)) W5100.writeSnIR(s, W5500_SN_IR_RECV);
+      SPI.endTransaction();
+    }
+
+  private:
+    static inline volatile bool _flag = false;
+    uint8_t _pin = 0;
+    unsigned long _lastAckMs = 0;
+
+    static void isr() {
+      _flag = true;
+    }
+};
+
+#endif
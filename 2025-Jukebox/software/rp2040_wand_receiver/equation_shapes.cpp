@@ -0,0 +1,1916 @@
+// Generated by host/equation_gen, do not edit
+
+#include "equation_shapes.h"
+
+static constexpr uint32_t EQN_01_POINTS[285] = {
+  0x002a002, 0x102b008, 0x102d00e, 0x102d012, 0x102c016, 0x102901b, 0x102301f, 0x101f020,
+  0x101a021, 0x1014021, 0x100e020, 0x100a020, 0x1006020, 0x1000021, 0x000601f, 0x100501a,
+  0x1003014, 0x100300f, 0x100200a, 0x1004003, 0x100a000, 0x1011002, 0x1014008, 0x101600d,
+  0x1017012, 0x1017019, 0x101701f, 0x001f022, 0x0027025, 0x002e028, 0x003502b, 0x003d02e,
+  0x0045031, 0x004c034, 0x0054037, 0x005c039, 0x105e03d, 0x105f044, 0x105c04b, 0x105904e,
+  0x105504f, 0x105004e, 0x104c04d, 0x104804b, 0x1044047, 0x103f043, 0x103903d, 0x103403c,
+  0x1034040, 0x1034044, 0x1034048, 0x103404c, 0x1034050, 0x1034054, 0x003205c, 0x0031064,
+  0x003006b, 0x002f073, 0x002e07b, 0x002c082, 0x002b08a, 0x002a092, 0x0028099, 0x1022099,
+  0x101c099, 0x1018099, 0x1013099, 0x100e099, 0x1009099, 0x1003099, 0x0009093, 0x000e08d,
+  0x0013086, 0x101308c, 0x1013091, 0x1013095, 0x1013099, 0x10130a0, 0x10130a5, 0x10130aa,
+  0x001a0b2, 0x00210ba, 0x00280c2, 0x002f0c9, 0x00360d1, 0x003d0d9, 0x00440e0, 0x103d0e0,
+  0x10360e0, 0x10300e0, 0x102a0e0, 0x10230e0, 0x101e0e0, 0x10180e0, 0x10120df, 0x100c0df,
+  0x10080e1, 0x10040e2, 0x10020e5, 0x10010ec, 0x10010f3, 0x10030f8, 0x10060fc, 0x1009100,
+  0x100e102, 0x1014103, 0x1019103, 0x101e103, 0x1022102, 0x10280ff, 0x102a0fa, 0x102a0f6,
+  0x102a0f2, 0x10290ed, 0x10260e8, 0x10230e2, 0x002a0e9, 0x00300f0, 0x00370f7, 0x003e0fe,
+  0x0045105, 0x004c10c, 0x0053113, 0x005a11a, 0x105e11f, 0x105f125, 0x105e12a, 0x105912f,
+  0x1053130, 0x104c12d, 0x1045128, 0x103f123, 0x103a120, 0x103411e, 0x1034123, 0x1034129,
+  0x103412e, 0x1034134, 0x003113b, 0x002f142, 0x002d14a, 0x002a151, 0x0028158, 0x0025160,
+  0x0023167, 0x002016f, 0x1020175, 0x102017b, 0x1020181, 0x1020187, 0x102018d, 0x1020194,
+  0x001c18c, 0x0017185, 0x001317e, 0x000e177, 0x0009170, 0x1009175, 0x100917b, 0x1009181,
+  0x1009187, 0x100918d, 0x1009193, 0x000919a, 0x00091a2, 0x00081a9, 0x00081b1, 0x00071b8,
+  0x00071c0, 0x00061c7, 0x00061cf, 0x00051d6, 0x00051de, 0x00041e5, 0x00041ed, 0x00031f5,
+  0x10021f0, 0x10011ec, 0x10001e8, 0x10011e3, 0x10021df, 0x10071d8, 0x100d1d4, 0x10121d3,
+  0x10161d2, 0x101b1d3, 0x10201d5, 0x10271da, 0x102b1e1, 0x102b1e4, 0x102b1e8, 0x102b1ec,
+  0x102a1f3, 0x00311f6, 0x00381f9, 0x003f1fd, 0x0046200, 0x004d204, 0x0054207, 0x005c20b,
+  0x105e211, 0x105e215, 0x105e219, 0x105a21e, 0x1053220, 0x104f21f, 0x104b21e, 0x104521a,
+  0x1040216, 0x103c213, 0x1038211, 0x103420f, 0x1034214, 0x103421a, 0x1034220, 0x1034226,
+  0x003321e, 0x0033216, 0x003320e, 0x0033206, 0x00331fe, 0x00331f6, 0x00321ee, 0x00321e6,
+  0x00321de, 0x00321d6, 0x00321ce, 0x00321c6, 0x00321be, 0x00311b6, 0x00311ae, 0x00311a6,
+  0x003119e, 0x0031197, 0x003118f, 0x0031187, 0x003017f, 0x0030177, 0x003016f, 0x0030167,
+  0x003015f, 0x0030157, 0x003014f, 0x002f147, 0x002f13f, 0x002f137, 0x002f12f, 0x002f127,
+  0x002f11f, 0x002f117, 0x002f111, 0x002f109, 0x002f101, 0x002f0f9, 0x002f0f1, 0x002f0e9,
+  0x002f0e1, 0x002e0d9, 0x002e0d1, 0x002e0c9, 0x002e0c1, 0x002e0b9, 0x002e0b1, 0x002e0a9,
+  0x002d0a1, 0x002d099, 0x002d091, 0x002d08a, 0x002d082, 0x002d07a, 0x002d072, 0x002c06a,
+  0x002c062, 0x002c05a, 0x002c052, 0x002c04a, 0x002c042, 0x002c03a, 0x002b032, 0x002b02a,
+  0x002b022, 0x002b01a, 0x002b012, 0x002b00a, 0x002a002,
+};
+
+static constexpr uint32_t EQN_02_POINTS[279] = {
+  0x002b00e, 0x102a013, 0x1029017, 0x102301c, 0x101e01e, 0x101801f, 0x101101e, 0x100d01d,
+  0x100801b, 0x1002014, 0x100100e, 0x1002008, 0x1008003, 0x100f000, 0x1014000, 0x1019000,
+  0x101e001, 0x1022002, 0x1028008, 0x102a00e, 0x0027016, 0x002401d, 0x0022024, 0x001f02b,
+  0x001d033, 0x001a03a, 0x0017041, 0x0014048, 0x101404d, 0x1014051, 0x1014056, 0x101405a,
+  0x101405f, 0x1014064, 0x001105d, 0x000e056, 0x000b04f, 0x0007048, 0x100704c, 0x1007050,
+  0x1007057, 0x100705e, 0x1007064, 0x000b06b, 0x000e072, 0x0012079, 0x0015080, 0x0019087,
+  0x001c08e, 0x001f094, 0x102009b, 0x101f0a0, 0x101d0a3, 0x10180a6, 0x10110a6, 0x100b0a6,
+  0x10070a6, 0x10000a6, 0x00050a4, 0x100309e, 0x1001097, 0x1002093, 0x1004091, 0x1009090,
+  0x100d093, 0x100f095, 0x101109b, 0x10110a1, 0x10100a5, 0x00140ab, 0x00180b1, 0x001c0b7,
+  0x00200bd, 0x101c0c0, 0x10180c3, 0x10120c8, 0x100b0cd, 0x10060d1, 0x10000d5, 0x00000cf,
+  0x00000c9, 0x00000c3, 0x00000bc, 0x10060c0, 0x100b0c4, 0x10120c9, 0x10180ce, 0x101c0d1,
+  0x10200d4, 0x00260d8, 0x002d0dc, 0x00340e0, 0x003b0e4, 0x00420e7, 0x10430ea, 0x10440ef,
+  0x10410f4, 0x103c0f5, 0x10350f3, 0x10300f0, 0x102c0ed, 0x10260e9, 0x10260ed, 0x10260f1,
+  0x10260f8, 0x0024100, 0x0022108, 0x002210f, 0x0020116, 0x001f11d, 0x001d125, 0x001b12d,
+  0x101612d, 0x101112d, 0x100b12d, 0x100412d, 0x000a126, 0x000f120, 0x100f126, 0x100f12d,
+  0x100f134, 0x100f13b, 0x0016142, 0x001d149, 0x0022151, 0x0029158, 0x0030160, 0x102a15f,
+  0x102415f, 0x101f15f, 0x101915e, 0x101215e, 0x100d15e, 0x100715f, 0x1004161, 0x1001165,
+  0x100116c, 0x1002171, 0x1006177, 0x100b178, 0x101017a, 0x101617a, 0x101c178, 0x101e176,
+  0x1020172, 0x102016b, 0x101d165, 0x1017160, 0x0019167, 0x001a16f, 0x001b177, 0x001c17f,
+  0x001e187, 0x001f18f, 0x0020197, 0x002119f, 0x00221a7, 0x101d1a3, 0x10181a0, 0x101219b,
+  0x100d197, 0x1008193, 0x100418f, 0x100018c, 0x000718c, 0x000d18c, 0x001418c, 0x001a18c,
+  0x002018d, 0x101b191, 0x1015196, 0x100f19a, 0x100919f, 0x10051a2, 0x10001a5, 0x00041ac,
+  0x00081b3, 0x000c1bb, 0x00101c2, 0x00141ca, 0x00181d1, 0x001b1d9, 0x10151d9, 0x100f1d9,
+  0x10091d9, 0x10031d9, 0x00091d2, 0x000f1cb, 0x100f1d2, 0x100f1d9, 0x100f1e0, 0x100f1e7,
+  0x000e1ee, 0x000c1f6, 0x000b1fe, 0x0009206, 0x000720e, 0x0006216, 0x000421e, 0x0002226,
+  0x100121f, 0x100121a, 0x1004215, 0x1007211, 0x100c20e, 0x101220e, 0x101720f, 0x101c214,
+  0x101f218, 0x102021f, 0x1020226, 0x002121e, 0x0021216, 0x002120e, 0x0021206, 0x00211fe,
+  0x00211f6, 0x00221ee, 0x00221e6, 0x00221df, 0x00221d7, 0x00221cf, 0x00221c7, 0x00221bf,
+  0x00221b7, 0x00221af, 0x00221a7, 0x00221a0, 0x0022198, 0x0023190, 0x0023188, 0x0023180,
+  0x0023178, 0x0023170, 0x0023168, 0x0024160, 0x0024159, 0x0024151, 0x0024149, 0x0024141,
+  0x0024139, 0x0025131, 0x0025129, 0x0025121, 0x002511a, 0x0025113, 0x002510b, 0x0025103,
+  0x00260fb, 0x00260f3, 0x00260eb, 0x00260e3, 0x00260db, 0x00260d4, 0x00270cc, 0x00270c4,
+  0x00270bc, 0x00270b4, 0x00270ac, 0x00270a4, 0x002809c, 0x0028094, 0x002808d, 0x0028085,
+  0x002807d, 0x0028075, 0x002906d, 0x0029065, 0x002905d, 0x0029055, 0x002904e, 0x0029046,
+  0x002a03e, 0x002a036, 0x002a02e, 0x002a026, 0x002a01e, 0x002a016, 0x002b00e,
+};
+
+static constexpr uint32_t EQN_03_POINTS[489] = {
+  0x0048000, 0x1043004, 0x103e007, 0x103b00a, 0x103700d, 0x1031013, 0x0039013, 0x0041012,
+  0x0048011, 0x104200c, 0x103b008, 0x1035004, 0x1031000, 0x0034008, 0x003600f, 0x0038016,
+  0x003a01d, 0x003c024, 0x003e02b, 0x0040032, 0x1040038, 0x104003d, 0x1040042, 0x1040047,
+  0x003d040, 0x0039039, 0x0035032, 0x1035038, 0x103503d, 0x1035042, 0x1035047, 0x003d04e,
+  0x0044054, 0x004c05a, 0x0052060, 0x005a066, 0x006106c, 0x0069072, 0x1069077, 0x106907c,
+  0x1069082, 0x1069087, 0x006f08c, 0x0075091, 0x007b096, 0x008109a, 0x107c09a, 0x107809a,
+  0x107109a, 0x106a09a, 0x106509b, 0x106109b, 0x105e0a0, 0x10610a7, 0x10680ac, 0x106c0ac,
+  0x10700ac, 0x10740a9, 0x10750a2, 0x107109c, 0x00710a4, 0x00720ac, 0x00730b4, 0x00730bb,
+  0x00740c3, 0x00750cb, 0x00760d2, 0x10720d2, 0x106e0d2, 0x10680d2, 0x10640d2, 0x00690ce,
+  0x006e0c9, 0x106d0ce, 0x106d0d5, 0x106e0db, 0x00680d5, 0x00630cf, 0x005e0c8, 0x105e0cd,
+  0x105e0d2, 0x105e0d7, 0x105e0db, 0x00610e3, 0x00650ea, 0x00690f2, 0x006d0f9, 0x0071100,
+  0x1073105, 0x1076109, 0x106e10d, 0x1067110, 0x1061113, 0x105b114, 0x1055117, 0x105b119,
+  0x106011a, 0x106511c, 0x106b11d, 0x107111e, 0x1077120, 0x107c121, 0x1082122, 0x1088123,
+  0x108d124, 0x1093126, 0x1098128, 0x109e12b, 0x109e132, 0x109e13a, 0x109e141, 0x109e148,
+  0x109e150, 0x109e157, 0x109e15f, 0x109e165, 0x109e16c, 0x109e173, 0x109e17a, 0x109e181,
+  0x109e188, 0x109e190, 0x109e197, 0x109e19f, 0x109e1a6, 0x109e1ae, 0x109e1b5, 0x109e1bd,
+  0x109e1c4, 0x109e1cc, 0x109e1d3, 0x109e1db, 0x109e1e3, 0x109e1e9, 0x109e1ef, 0x109e1f5,
+  0x109e1f9, 0x109e1fd, 0x109e203, 0x109e20a, 0x109e210, 0x109e217, 0x109e21e, 0x009d216,
+  0x009c20e, 0x009b206, 0x009a1fe, 0x00991f6, 0x00981ee, 0x00971e6, 0x00961de, 0x00951d6,
+  0x00941ce, 0x00931c6, 0x00921be, 0x00911b6, 0x00901ae, 0x008f1a6, 0x008e19e, 0x008d196,
+  0x008c18e, 0x008b186, 0x008a17e, 0x0089176, 0x008816e, 0x0087166, 0x008615e, 0x0085156,
+  0x008414e, 0x0083146, 0x008213e, 0x0081137, 0x107c137, 0x1077137, 0x1071137, 0x106a137,
+  0x1065137, 0x1061138, 0x105e13b, 0x105e141, 0x1061147, 0x106814a, 0x106d14a, 0x1074147,
+  0x1075143, 0x107513f, 0x1071138, 0x007613f, 0x007c147, 0x008214e, 0x0088156, 0x108a15b,
+  0x108a15e, 0x1086161, 0x1082161, 0x107d15e, 0x107a15a, 0x1074157, 0x107515e, 0x1074164,
+  0x007116a, 0x006e171, 0x006b178, 0x006917f, 0x1069184, 0x106918a, 0x106918f, 0x1069195,
+  0x006819c, 0x00681a3, 0x00671aa, 0x00671b1, 0x00661b8, 0x00661bf, 0x00661c6, 0x10661bf,
+  0x10661b8, 0x10661b4, 0x10661b0, 0x106d1b3, 0x10711b5, 0x10751b7, 0x10781bb, 0x107c1bf,
+  0x10751bf, 0x10711bf, 0x106d1bf, 0x10671bf, 0x10601bf, 0x00641c5, 0x00681cc, 0x006c1d3,
+  0x00701da, 0x00751e1, 0x10761e8, 0x10741ee, 0x10701f2, 0x106c1f3, 0x10651f3, 0x105f1f2,
+  0x00621f1, 0x105f1ea, 0x105e1e6, 0x105f1e3, 0x10631e1, 0x10671e2, 0x10691e5, 0x106a1eb,
+  0x106a1f1, 0x00671f7, 0x00651fe, 0x0063205, 0x006120c, 0x005f213, 0x105f20d, 0x1060207,
+  0x1064204, 0x106a202, 0x106e203, 0x1072206, 0x107520b, 0x107520f, 0x1075213, 0x007420b,
+  0x0073203, 0x00721fb, 0x00711f3, 0x00701eb, 0x006f1e3, 0x006e1db, 0x006d1d3, 0x006c1cb,
+  0x006b1c3, 0x006a1bb, 0x00691b3, 0x00681ab, 0x00671a3, 0x006619b, 0x0065193, 0x006418b,
+  0x0063183, 0x006217b, 0x0061173, 0x006016b, 0x005f163, 0x005e15b, 0x005d153, 0x005c14b,
+  0x005b143, 0x005b13c, 0x005a134, 0x005912c, 0x0058124, 0x005711c, 0x0056114, 0x005510d,
+  0x0054105, 0x00530fd, 0x00520f5, 0x00510ed, 0x00500e5, 0x004f0dd, 0x004f0d5, 0x004e0cd,
+  0x004d0c5, 0x004c0bd, 0x004b0b5, 0x004a0ad, 0x00490a5, 0x004809d, 0x0047095, 0x004608d,
+  0x0045085, 0x004407d, 0x0043075, 0x004206d, 0x1042075, 0x104207c, 0x1042084, 0x104208b,
+  0x1042093, 0x104209a, 0x10420a2, 0x10420a9, 0x10420b1, 0x10420b8, 0x10420c0, 0x10420c7,
+  0x10420cf, 0x10420d6, 0x10420dd, 0x10420e5, 0x10420ed, 0x10420f5, 0x10420fd, 0x1042105,
+  0x104210d, 0x1042114, 0x104211c, 0x1042124, 0x104212c, 0x1042134, 0x104213c, 0x1042143,
+  0x104214b, 0x1042152, 0x104215a, 0x1042161, 0x1042169, 0x1042170, 0x1042178, 0x104217f,
+  0x1042187, 0x104218e, 0x1042196, 0x104219d, 0x10421a4, 0x10421ab, 0x10421b2, 0x10421b9,
+  0x10421c0, 0x10421c8, 0x10421cf, 0x10421d6, 0x10421dd, 0x10421e4, 0x10421ec, 0x10421f3,
+  0x10421fa, 0x1042201, 0x1042209, 0x1042210, 0x1042217, 0x104221e, 0x1042226, 0x004121e,
+  0x0040216, 0x003f20e, 0x003e206, 0x003d1fe, 0x003c1f6, 0x003b1ee, 0x00391e6, 0x00381de,
+  0x00371d6, 0x00361ce, 0x00351c6, 0x00341be, 0x00331b6, 0x00321ae, 0x00301a7, 0x002f19f,
+  0x002e197, 0x002d18f, 0x002c187, 0x002b17f, 0x002a177, 0x002916f, 0x0027167, 0x002615f,
+  0x0025157, 0x002414f, 0x0023147, 0x002213f, 0x0021137, 0x002012f, 0x001e128, 0x101f12d,
+  0x101f133, 0x101d138, 0x1018139, 0x1011136, 0x100c132, 0x100612d, 0x100012a, 0x100012e,
+  0x1000132, 0x1000137, 0x100013c, 0x0006143, 0x000c14b, 0x0012152, 0x001715a, 0x101715e,
+  0x1017162, 0x1016166, 0x1014168, 0x101216a, 0x100e16a, 0x100b16b, 0x100816b, 0x100316b,
+  0x100016b, 0x000616a, 0x1002166, 0x1001162, 0x100115d, 0x100215b, 0x1005159, 0x100915a,
+  0x100c15e, 0x100d163, 0x100c16a, 0x000e162, 0x000f15a, 0x0010152, 0x001214a, 0x0013142,
+  0x001413a, 0x0016132, 0x001712b, 0x0018123, 0x001a11b, 0x001b113, 0x001c10c, 0x001d104,
+  0x001f0fc, 0x00200f4, 0x00210ed, 0x00230e5, 0x00240dd, 0x00250d5, 0x00270cd, 0x00280c5,
+  0x00290bd, 0x002a0b5, 0x002c0ae, 0x002d0a6, 0x002e09e, 0x0030096, 0x003108e, 0x0032086,
+  0x003407e, 0x0035077, 0x003606f, 0x0038067, 0x003905f, 0x003a057, 0x003b04f, 0x003d047,
+  0x003e03f, 0x003f038, 0x0041030, 0x0042028, 0x0043020, 0x0045018, 0x0046010, 0x0047008,
+  0x0048000,
+};
+
+static constexpr uint32_t EQN_04_POINTS[324] = {
+  0x0016001, 0x1016006, 0x101600b, 0x101700f, 0x101a010, 0x101f00d, 0x1021009, 0x1020004,
+  0x101c000, 0x1015000, 0x1010001, 0x100d004, 0x100c00a, 0x100d010, 0x0014013, 0x001b016,
+  0x0022018, 0x002901b, 0x003001d, 0x1030022, 0x102c022, 0x1028022, 0x1023022, 0x002201d,
+  0x1022022, 0x1022028, 0x002902d, 0x0031031, 0x102d034, 0x1026039, 0x102103d, 0x002603e,
+  0x002b03e, 0x003103e, 0x102d03a, 0x1026034, 0x1021031, 0x001f038, 0x001d03e, 0x001b045,
+  0x001a04b, 0x101a050, 0x101a054, 0x101a05a, 0x101a05f, 0x0017059, 0x0014052, 0x001004b,
+  0x1010050, 0x1010055, 0x101005a, 0x101005f, 0x0010067, 0x000f06e, 0x000e076, 0x000d07d,
+  0x100d079, 0x100d075, 0x1010070, 0x101306d, 0x101906b, 0x101f06c, 0x102406f, 0x1026074,
+  0x1026078, 0x102707c, 0x0024083, 0x0022089, 0x002008f, 0x1021093, 0x1020097, 0x101d09b,
+  0x101909c, 0x101409c, 0x101009a, 0x100d096, 0x100c092, 0x100d08d, 0x101008b, 0x1014089,
+  0x1016089, 0x101a08a, 0x101e08c, 0x101f08e, 0x001a095, 0x001709c, 0x00130a3, 0x000e0aa,
+  0x100c0b0, 0x100e0b6, 0x10130b6, 0x10150b5, 0x10170b1, 0x10180ad, 0x101b0a9, 0x101f0ab,
+  0x10210b0, 0x101f0b5, 0x00200bc, 0x00220c3, 0x00240ca, 0x00260d1, 0x00280d7, 0x10230d5,
+  0x101e0d2, 0x10190d1, 0x10140d0, 0x100d0d1, 0x10070d4, 0x10010d7, 0x00080db, 0x000f0de,
+  0x00150e1, 0x001b0e4, 0x00220e7, 0x101c0ec, 0x10160f0, 0x10110f4, 0x100b0f8, 0x000b0f3,
+  0x000b0ed, 0x000b0e7, 0x100f0ea, 0x10130ed, 0x10180f1, 0x101c0f4, 0x10220f8, 0x00230fe,
+  0x0025103, 0x0027108, 0x102210b, 0x101d10d, 0x101810e, 0x101410f, 0x100f10e, 0x100a10c,
+  0x100610a, 0x1001108, 0x000610f, 0x000b115, 0x001011c, 0x0015122, 0x0019129, 0x001e130,
+  0x1019130, 0x1015130, 0x1011130, 0x100d130, 0x001112b, 0x0015126, 0x101512a, 0x101512f,
+  0x1015134, 0x1015139, 0x001b140, 0x0021148, 0x102114c, 0x1021150, 0x101c150, 0x1016150,
+  0x1011150, 0x100c150, 0x000c14b, 0x000c146, 0x100c14d, 0x100c152, 0x100c157, 0x000d15e,
+  0x000d166, 0x000d16d, 0x000d175, 0x000d17c, 0x000d184, 0x100c189, 0x100d18e, 0x100e192,
+  0x1013194, 0x1016192, 0x101918e, 0x101b189, 0x101d186, 0x1021184, 0x1027186, 0x102818b,
+  0x1027190, 0x0025196, 0x002319c, 0x00211a2, 0x10211a9, 0x101d1a9, 0x10191a9, 0x10151a9,
+  0x10111a9, 0x100c1a9, 0x000c1a5, 0x000c1a1, 0x100c1a7, 0x100c1ab, 0x100c1b1, 0x00131b5,
+  0x001a1ba, 0x00211bf, 0x101c1bf, 0x10151bf, 0x10111bf, 0x100d1bf, 0x00131bf, 0x00181bf,
+  0x001d1bf, 0x101f1c4, 0x10201ca, 0x101e1ce, 0x101b1cf, 0x10151cf, 0x10111cf, 0x100d1cf,
+  0x00141d6, 0x001a1de, 0x00201e5, 0x00271ed, 0x10221ea, 0x101e1e8, 0x10191e7, 0x10151e6,
+  0x10111e7, 0x100d1e8, 0x10071eb, 0x10001ee, 0x00071f1, 0x000e1f4, 0x00151f7, 0x001b1fa,
+  0x00221fe, 0x101e200, 0x101a203, 0x1016206, 0x101220a, 0x100b20f, 0x000b209, 0x000b203,
+  0x000b1fe, 0x100f201, 0x1013204, 0x101a209, 0x101e20c, 0x102220f, 0x0023214, 0x0025219,
+  0x002721f, 0x1022222, 0x101d224, 0x1018225, 0x1013226, 0x100d224, 0x1007222, 0x100021e,
+  0x0001216, 0x000120e, 0x0001206, 0x00021fe, 0x00021f6, 0x00021ee, 0x00031e6, 0x00031de,
+  0x00031d6, 0x00041ce, 0x00041c6, 0x00041be, 0x00051b6, 0x00051ae, 0x00051a6, 0x000619e,
+  0x0006196, 0x000618e, 0x0007186, 0x000717e, 0x0007176, 0x000816e, 0x0008167, 0x000815f,
+  0x0009157, 0x000914f, 0x0009147, 0x000a13f, 0x000a137, 0x000a12f, 0x000b127, 0x000b11f,
+  0x000b117, 0x000b110, 0x000c108, 0x000c100, 0x000c0f8, 0x000d0f0, 0x000d0e8, 0x000d0e0,
+  0x000e0d8, 0x000e0d0, 0x000e0c8, 0x000f0c0, 0x000f0b8, 0x000f0b1, 0x00100a9, 0x00100a1,
+  0x0010099, 0x0011091, 0x0011089, 0x0011081, 0x0012079, 0x0012071, 0x0012069, 0x0013061,
+  0x0013059, 0x0013051, 0x0014049, 0x0014041, 0x0014039, 0x0015031, 0x0015029, 0x0015021,
+  0x0016019, 0x0016011, 0x0016009, 0x0016001,
+};
+
+static constexpr uint32_t EQN_05_POINTS[279] = {
+  0x0018001, 0x1018007, 0x101800d, 0x1018012, 0x1018016, 0x101901d, 0x101a023, 0x101e024,
+  0x1022025, 0x1028022, 0x102d01f, 0x102e019, 0x1030012, 0x102c00b, 0x1028003, 0x1021002,
+  0x1019000, 0x1015001, 0x1010001, 0x100c003, 0x1007005, 0x100200b, 0x1002010, 0x1001014,
+  0x100201b, 0x1002022, 0x000902a, 0x0010031, 0x0017038, 0x001e03f, 0x0025047, 0x002c04e,
+  0x0032055, 0x003905c, 0x1039057, 0x1039052, 0x103904c, 0x1039045, 0x103903d, 0x003f03d,
+  0x004503d, 0x004c03d, 0x005203d, 0x005903d, 0x1059043, 0x1059048, 0x105904d, 0x105304e,
+  0x104d04e, 0x104804e, 0x104304d, 0x103e04d, 0x103904d, 0x0040055, 0x004705c, 0x004e064,
+  0x005606b, 0x1056072, 0x1056079, 0x1056080, 0x1056086, 0x105608c, 0x1056092, 0x1056098,
+  0x0055092, 0x005508c, 0x0055086, 0x1051088, 0x104b089, 0x104608a, 0x104208a, 0x103d08c,
+  0x103908d, 0x0040088, 0x0047083, 0x004e07e, 0x0055079, 0x104e078, 0x1048076, 0x1044074,
+  0x1040071, 0x103906b, 0x0037073, 0x003607b, 0x0035082, 0x003408a, 0x0033092, 0x0032099,
+  0x00310a1, 0x00300a9, 0x002f0b0, 0x002e0b8, 0x002d0c0, 0x002c0c7, 0x002c0cf, 0x002b0d7,
+  0x00290de, 0x10230de, 0x101c0de, 0x10160de, 0x100f0de, 0x10090de, 0x10020de, 0x00090d9,
+  0x000f0d3, 0x00150cd, 0x10150d2, 0x10150d6, 0x10150db, 0x10150df, 0x10150e7, 0x10150ee,
+  0x00190f6, 0x001d0fe, 0x0020105, 0x002410d, 0x0028114, 0x002b11b, 0x002e123, 0x003212b,
+  0x1034130, 0x1037135, 0x103913a, 0x103c13f, 0x103713f, 0x1033140, 0x102c140, 0x1024140,
+  0x101c140, 0x1016140, 0x1010140, 0x100913f, 0x100113f, 0x0001145, 0x000114b, 0x0000151,
+  0x100114a, 0x1001144, 0x100113e, 0x1001137, 0x1001131, 0x100112b, 0x0004132, 0x000613a,
+  0x0009142, 0x000b14a, 0x000d152, 0x001015a, 0x0012162, 0x001516a, 0x0017172, 0x001917a,
+  0x001c182, 0x001e18a, 0x0020192, 0x1021198, 0x102119e, 0x10211a5, 0x10211ab, 0x10211b1,
+  0x10201b8, 0x001c1b0, 0x00171a9, 0x00131a1, 0x000e19a, 0x0009193, 0x1009199, 0x100919f,
+  0x10091a5, 0x10091ab, 0x10091b1, 0x10091b8, 0x000f1bf, 0x00141c7, 0x001a1cf, 0x001f1d7,
+  0x00241df, 0x002a1e7, 0x002e1ef, 0x00341f7, 0x00391ff, 0x003f207, 0x104020b, 0x104120f,
+  0x1040213, 0x1040217, 0x103d21b, 0x103a21f, 0x1035222, 0x102f223, 0x102a225, 0x1025225,
+  0x1020226, 0x101c225, 0x1017225, 0x1012223, 0x100c221, 0x100721c, 0x1002217, 0x1001212,
+  0x100020d, 0x1002208, 0x1003204, 0x10091ff, 0x100e1fc, 0x10121fa, 0x10181f9, 0x101e1f8,
+  0x10241f8, 0x10291f8, 0x102f1fa, 0x10361fd, 0x103a202, 0x103f207, 0x003e1ff, 0x003d1f7,
+  0x003d1ef, 0x003c1e7, 0x003c1df, 0x003b1d7, 0x003a1cf, 0x003a1c7, 0x00391bf, 0x00391b7,
+  0x00381af, 0x00371a7, 0x003719f, 0x0036197, 0x003618f, 0x0035187, 0x003417f, 0x0034177,
+  0x003316f, 0x0033167, 0x003215f, 0x0031157, 0x003114f, 0x0030147, 0x003013f, 0x002f137,
+  0x002e12f, 0x002e127, 0x002d11f, 0x002d117, 0x002c110, 0x002c108, 0x002c101, 0x002b0f9,
+  0x002a0f1, 0x002a0e9, 0x00290e1, 0x00290d9, 0x00280d1, 0x00270c9, 0x00270c1, 0x00260b9,
+  0x00260b1, 0x00250a9, 0x00240a1, 0x0024099, 0x0023091, 0x0023089, 0x0022081, 0x0021079,
+  0x0021071, 0x0020069, 0x0020061, 0x001f059, 0x001e051, 0x001e049, 0x001d041, 0x001d039,
+  0x001c031, 0x001b029, 0x001b021, 0x001a019, 0x001a011, 0x0019009, 0x0018001,
+};
+
+static constexpr uint32_t EQN_06_POINTS[279] = {
+  0x0038001, 0x1038007, 0x103800d, 0x1038012, 0x1038019, 0x1038020, 0x1038027, 0x103802e,
+  0x1038035, 0x103803b, 0x0032034, 0x002c02d, 0x0025025, 0x001f01e, 0x0019017, 0x001200f,
+  0x000c008, 0x0005000, 0x100c000, 0x1013000, 0x101a000, 0x1021000, 0x1028000, 0x102e000,
+  0x1034000, 0x103a000, 0x1041000, 0x1049000, 0x1051000, 0x1056000, 0x105b000, 0x1061000,
+  0x1066000, 0x106c000, 0x1072000, 0x1072006, 0x107200b, 0x1072010, 0x1072018, 0x107201f,
+  0x1072026, 0x107202d, 0x1072034, 0x107203b, 0x006e043, 0x006a04b, 0x0067052, 0x006305a,
+  0x005f061, 0x005c069, 0x0058070, 0x0055078, 0x0051080, 0x004d087, 0x004a08f, 0x0046096,
+  0x004209e, 0x003f0a5, 0x003b0ad, 0x00380b4, 0x10380bb, 0x10380c1, 0x10380c8, 0x10380ce,
+  0x10380d4, 0x10380dc, 0x10380e4, 0x10380ec, 0x10380f3, 0x00340ec, 0x002f0e4, 0x002a0dc,
+  0x00250d4, 0x00200cc, 0x001b0c4, 0x00160bc, 0x00110b4, 0x10110bb, 0x10110c1, 0x10110c8,
+  0x10110ce, 0x10110d4, 0x10110dc, 0x10110e4, 0x10110ec, 0x10110f3, 0x00100fb, 0x000f103,
+  0x000e10a, 0x000d112, 0x000c119, 0x000b120, 0x000a128, 0x000812f, 0x0007137, 0x000613f,
+  0x0005146, 0x000414e, 0x0003155, 0x000215d, 0x0000165, 0x1007165, 0x100e165, 0x1015165,
+  0x101c165, 0x1023165, 0x102b165, 0x1032165, 0x1039165, 0x103f165, 0x1047166, 0x104e16a,
+  0x1054171, 0x1054177, 0x105517e, 0x1053182, 0x1052187, 0x104e189, 0x104a18c, 0x104318c,
+  0x103d18d, 0x103718e, 0x103018e, 0x102918e, 0x102118e, 0x101b18e, 0x101518e, 0x100e18e,
+  0x100818e, 0x100118e, 0x000918d, 0x001118d, 0x001918d, 0x002118d, 0x002818d, 0x003018d,
+  0x003818d, 0x003f18d, 0x004718d, 0x104b190, 0x1050194, 0x1052199, 0x105419f, 0x10541a5,
+  0x10541ab, 0x10511b0, 0x104f1b6, 0x10491b7, 0x10441b8, 0x103d1b8, 0x10371b8, 0x10301b8,
+  0x10291b8, 0x10221b8, 0x101a1b8, 0x10141b8, 0x100e1b8, 0x10081b8, 0x10021b8, 0x000a1bc,
+  0x00121c0, 0x001a1c4, 0x00221c9, 0x002a1cd, 0x00321d1, 0x00391d6, 0x00411da, 0x00491de,
+  0x00511e3, 0x10521ea, 0x10531f1, 0x10531f8, 0x10541ff, 0x1055207, 0x105320e, 0x1051216,
+  0x104f21e, 0x1048220, 0x1041222, 0x103b224, 0x1035224, 0x102e225, 0x1027225, 0x1020226,
+  0x101a225, 0x1013224, 0x100d223, 0x1006222, 0x100421a, 0x1001213, 0x100120c, 0x1001205,
+  0x10001fe, 0x10031f6, 0x10061ef, 0x10091e8, 0x100f1e6, 0x10141e5, 0x10191e4, 0x101f1e6,
+  0x10241e9, 0x10271ef, 0x102a1f6, 0x102b1fd, 0x102b205, 0x102b20c, 0x102b214, 0x102b219,
+  0x102a21e, 0x1029224, 0x002a21c, 0x002a214, 0x002a20c, 0x002a204, 0x002b1fc, 0x002b1f4,
+  0x002b1ec, 0x002b1e4, 0x002b1dc, 0x002c1d4, 0x002c1cc, 0x002c1c4, 0x002c1bc, 0x002d1b5,
+  0x002d1ad, 0x002d1a5, 0x002d19d, 0x002d195, 0x002e18d, 0x002e185, 0x002e17d, 0x002e175,
+  0x002e16d, 0x002f165, 0x002f15d, 0x002f155, 0x002f14d, 0x0030146, 0x003013e, 0x0030136,
+  0x003012e, 0x0030126, 0x003111e, 0x0031116, 0x003110f, 0x0031107, 0x00320ff, 0x00320f7,
+  0x00320ef, 0x00320e7, 0x00320df, 0x00330d8, 0x00330d0, 0x00330c8, 0x00330c0, 0x00330b8,
+  0x00340b0, 0x00340a8, 0x00340a0, 0x0034098, 0x0035090, 0x0035088, 0x0035080, 0x0035078,
+  0x0035070, 0x0036069, 0x0036061, 0x0036059, 0x0036051, 0x0037049, 0x0037041, 0x0037039,
+  0x0037031, 0x0037029, 0x0038021, 0x0038019, 0x0038011, 0x0038009, 0x0038001,
+};
+
+static constexpr uint32_t EQN_07_POINTS[479] = {
+  0x0055040, 0x1055046, 0x105404a, 0x105204c, 0x104d04c, 0x104904c, 0x104704b, 0x1046048,
+  0x1045045, 0x1047041, 0x104a041, 0x104c043, 0x104d046, 0x104d04b, 0x004a044, 0x004703c,
+  0x0045035, 0x004202d, 0x0040026, 0x003d01e, 0x003a017, 0x003800f, 0x0035008, 0x0033000,
+  0x1033008, 0x103300f, 0x1033017, 0x103301e, 0x1033025, 0x103302d, 0x1033034, 0x103303b,
+  0x1033043, 0x103304a, 0x1033051, 0x1033058, 0x1033060, 0x1033067, 0x103306e, 0x1033076,
+  0x103307d, 0x1033084, 0x103308b, 0x0030084, 0x002e07c, 0x002c075, 0x002a06d, 0x0028065,
+  0x002505e, 0x0023056, 0x002104f, 0x001e047, 0x001c03f, 0x001a038, 0x0017030, 0x0015029,
+  0x0013021, 0x0010019, 0x000e012, 0x000c00a, 0x0009002, 0x1008006, 0x100800b, 0x100a00d,
+  0x100c00e, 0x100e00b, 0x1010008, 0x1013004, 0x1016005, 0x1017009, 0x101700d, 0x0017013,
+  0x0017019, 0x1017020, 0x1013020, 0x100f020, 0x1008020, 0x0008019, 0x100801f, 0x1008026,
+  0x000f02b, 0x001602f, 0x1017033, 0x1017036, 0x1016039, 0x101403b, 0x100f03b, 0x100803b,
+  0x000e037, 0x0013033, 0x001802f, 0x101202f, 0x100d02f, 0x100802f, 0x000c036, 0x000f03d,
+  0x0012044, 0x001604b, 0x0019052, 0x001c059, 0x1018058, 0x1014056, 0x100f055, 0x1009056,
+  0x1005058, 0x100005a, 0x000805e, 0x0010062, 0x0017066, 0x101806b, 0x1016070, 0x1013072,
+  0x100e072, 0x100a071, 0x100806f, 0x100806b, 0x1009067, 0x100c066, 0x100f068, 0x101006c,
+  0x1010071, 0x0017077, 0x001d07d, 0x1018080, 0x1014081, 0x1010082, 0x100a081, 0x1006080,
+  0x100107e, 0x0009084, 0x001008a, 0x0017090, 0x001e095, 0x002509b, 0x002c0a1, 0x00330a6,
+  0x10330ac, 0x10330b2, 0x002f0ac, 0x002c0a6, 0x102c0ac, 0x102c0b2, 0x00300ba, 0x00340c2,
+  0x00380c9, 0x003c0d1, 0x00400d8, 0x00440e0, 0x00480e8, 0x004c0ef, 0x00500f7, 0x00540fe,
+  0x0058106, 0x005d10d, 0x105810d, 0x105310d, 0x104d10d, 0x104710e, 0x1045111, 0x1047116,
+  0x104b119, 0x1050119, 0x1054116, 0x1054111, 0x105310e, 0x004f107, 0x004b100, 0x00480f9,
+  0x00440f2, 0x00410ea, 0x003d0e3, 0x003a0dc, 0x00360d5, 0x00330cd, 0x10330d5, 0x10330dd,
+  0x10330e4, 0x10330ec, 0x10330f4, 0x10330fb, 0x1033102, 0x1033109, 0x1033110, 0x1033116,
+  0x103311d, 0x1033124, 0x103312b, 0x1033132, 0x103313a, 0x1033142, 0x1033149, 0x1033151,
+  0x1033159, 0x0030151, 0x002e149, 0x002d142, 0x002a13a, 0x0028132, 0x002612b, 0x0024123,
+  0x002111b, 0x001f114, 0x001d10d, 0x001a105, 0x00180fd, 0x00160f6, 0x00140ee, 0x00110e6,
+  0x000f0df, 0x000d0d7, 0x000a0cf, 0x100a0d3, 0x100a0d7, 0x100c0d9, 0x100e0da, 0x10100d7,
+  0x10120d4, 0x10140d0, 0x10170d1, 0x10190d6, 0x10190d9, 0x00190df, 0x00190e5, 0x10190ec,
+  0x10150ec, 0x10110ec, 0x100a0ec, 0x000a0e5, 0x100a0ec, 0x100a0f2, 0x00110f7, 0x00170fc,
+  0x10180ff, 0x1019102, 0x1018105, 0x1015107, 0x1010108, 0x100a108, 0x0012102, 0x00190fb,
+  0x10140fb, 0x100f0fb, 0x100a0fb, 0x000e103, 0x001110a, 0x0014111, 0x0017117, 0x001a11e,
+  0x001d126, 0x1016122, 0x1010121, 0x100a123, 0x1006124, 0x1002126, 0x0009129, 0x001012c,
+  0x001712f, 0x001d132, 0x1018132, 0x1013132, 0x100d132, 0x1007133, 0x1005136, 0x100713b,
+  0x100b13e, 0x101013e, 0x101413c, 0x1014136, 0x1013133, 0x0017139, 0x001b140, 0x001f147,
+  0x101a14a, 0x101614b, 0x101214c, 0x100c14c, 0x100814a, 0x1003148, 0x000a14e, 0x0011154,
+  0x001815a, 0x001f160, 0x0026166, 0x002d16c, 0x0034173, 0x1034179, 0x103417f, 0x0030179,
+  0x002d173, 0x102d179, 0x102d17f, 0x002f186, 0x003118e, 0x0033196, 0x003519e, 0x00371a6,
+  0x00391ae, 0x003b1b6, 0x003d1be, 0x003f1c6, 0x00411ce, 0x00431d6, 0x00451de, 0x00471e6,
+  0x10461e1, 0x10481dc, 0x104d1da, 0x10521db, 0x10541dd, 0x10551e1, 0x10541e6, 0x00501de,
+  0x004d1d6, 0x004a1cf, 0x00461c7, 0x00431c0, 0x00401b8, 0x003c1b0, 0x00391a9, 0x00361a1,
+  0x003319a, 0x10331a1, 0x10331a8, 0x10331af, 0x10331b6, 0x10331bd, 0x10331c5, 0x10331cc,
+  0x10331d4, 0x10331db, 0x10331e3, 0x10331ea, 0x10331f2, 0x10331fa, 0x1033201, 0x1033208,
+  0x1033210, 0x1033217, 0x103321e, 0x1033226, 0x003021e, 0x002e216, 0x002d20f, 0x002a207,
+  0x0028200, 0x00261f8, 0x00241f1, 0x00211e9, 0x001f1e2, 0x001d1da, 0x001a1d2, 0x00181cb,
+  0x00161c3, 0x00141bc, 0x00111b4, 0x000f1ad, 0x000d1a5, 0x000a19e, 0x100a1a2, 0x100a1a7,
+  0x100c1a9, 0x100e1aa, 0x10101a7, 0x10111a4, 0x10141a0, 0x10171a1, 0x10191a5, 0x10191a9,
+  0x00191af, 0x00191b5, 0x10191bc, 0x10151bc, 0x10111bc, 0x100a1bc, 0x000a1b5, 0x100a1bc,
+  0x100a1c2, 0x00111c6, 0x00171cb, 0x10181cf, 0x10191d2, 0x10181d5, 0x10151d7, 0x10101d7,
+  0x100a1d7, 0x00121d1, 0x00191cb, 0x10141cb, 0x100f1cb, 0x100a1cb, 0x000e1d2, 0x00111d9,
+  0x00141e0, 0x00171e7, 0x001a1ee, 0x001d1f5, 0x10191f3, 0x10151f2, 0x10101f1, 0x100a1f2,
+  0x10061f4, 0x10021f6, 0x00051fd, 0x0007204, 0x000920b, 0x1008206, 0x1009201, 0x100f1ff,
+  0x1013200, 0x1016202, 0x1017206, 0x101520b, 0x001a20e, 0x001e212, 0x101a215, 0x1016216,
+  0x1011217, 0x100b217, 0x1007215, 0x1002213, 0x000420b, 0x0005203, 0x00071fb, 0x00081f3,
+  0x000a1eb, 0x000b1e3, 0x000c1db, 0x000e1d3, 0x000f1cb, 0x00111c3, 0x00121bb, 0x00131b4,
+  0x00151ac, 0x00161a4, 0x001819c, 0x0019194, 0x001a18c, 0x001c184, 0x001d17c, 0x001f174,
+  0x002016c, 0x0021164, 0x002315c, 0x0024155, 0x002614d, 0x0027145, 0x002813d, 0x002a135,
+  0x002b12d, 0x002d125, 0x002e11d, 0x002f115, 0x003010e, 0x0031106, 0x00330fe, 0x00340f7,
+  0x00360ef, 0x00370e7, 0x00380df, 0x003a0d7, 0x003b0cf, 0x003d0c7, 0x003e0bf, 0x003f0b7,
+  0x00410af, 0x00420a7, 0x004409f, 0x0045098, 0x0046090, 0x0048088, 0x0049080, 0x004b078,
+  0x004c070, 0x004d068, 0x004f060, 0x0050058, 0x0052050, 0x0053048, 0x0055040,
+};
+
+static constexpr uint32_t EQN_08_POINTS[298] = {
+  0x000500c, 0x1004007, 0x1005002, 0x100b000, 0x1010000, 0x1013003, 0x1014007, 0x101200c,
+  0x001900e, 0x0020010, 0x0027012, 0x002e013, 0x102e018, 0x102c01b, 0x102901c, 0x1023019,
+  0x1020016, 0x101d014, 0x101d019, 0x101d01d, 0x001a024, 0x001802b, 0x0016032, 0x0014039,
+  0x001103f, 0x1011046, 0x101104c, 0x000e046, 0x000a03f, 0x100a046, 0x100a04c, 0x000e053,
+  0x0012059, 0x001605f, 0x1017065, 0x1016069, 0x101306b, 0x100d06c, 0x100906c, 0x100706b,
+  0x1006067, 0x1005064, 0x1008060, 0x100b060, 0x100d061, 0x100e065, 0x100e06b, 0x001506d,
+  0x001b06f, 0x0021071, 0x0028073, 0x002f075, 0x102f07a, 0x102d07d, 0x102a07f, 0x102407b,
+  0x1021078, 0x101e076, 0x101e07b, 0x101e080, 0x001b087, 0x001908e, 0x0017094, 0x001609b,
+  0x00130a1, 0x100d0a1, 0x100a0a1, 0x000f09b, 0x100f0a0, 0x100f0a7, 0x00140af, 0x00170b6,
+  0x001b0be, 0x00200c5, 0x101a0c5, 0x10150c5, 0x100e0c5, 0x10070c5, 0x10060c9, 0x10080cf,
+  0x100c0d2, 0x10120d2, 0x10160cf, 0x10160c9, 0x10150c5, 0x001b0ca, 0x00220ce, 0x00280d2,
+  0x002f0d6, 0x102f0db, 0x102d0dd, 0x102a0df, 0x10240dc, 0x10210d9, 0x101e0d7, 0x101e0dc,
+  0x101e0e0, 0x001a0e7, 0x00170ee, 0x00130f5, 0x000f0fb, 0x100f100, 0x100f104, 0x100f108,
+  0x100f10c, 0x0016113, 0x001d11a, 0x0024122, 0x1023127, 0x102312c, 0x1020130, 0x101b133,
+  0x1017130, 0x101212d, 0x100e128, 0x1009124, 0x1009128, 0x100912d, 0x1009131, 0x1009135,
+  0x000f139, 0x001413d, 0x0019142, 0x101a149, 0x101914d, 0x101614f, 0x101114f, 0x100c14f,
+  0x100a14e, 0x100914b, 0x1009147, 0x100b143, 0x100e143, 0x1010145, 0x1011148, 0x101114e,
+  0x0017154, 0x001b15b, 0x0021162, 0x101b162, 0x1016162, 0x1010162, 0x1009163, 0x1007167,
+  0x100916c, 0x100d16f, 0x101316f, 0x101716c, 0x1017167, 0x1016163, 0x001416a, 0x0012172,
+  0x0010179, 0x000e181, 0x000c188, 0x000a190, 0x0008198, 0x1007193, 0x100918e, 0x100f18c,
+  0x101418c, 0x101618f, 0x1018193, 0x1016198, 0x001719e, 0x00171a5, 0x10181aa, 0x10171af,
+  0x10111b1, 0x100c1b1, 0x100a1ad, 0x10071a9, 0x100b1a3, 0x10101a2, 0x10171a5, 0x00131ac,
+  0x000e1b3, 0x00091bb, 0x10081c0, 0x10081c4, 0x100a1c7, 0x100c1c8, 0x100e1c5, 0x10101c1,
+  0x10131bd, 0x10171be, 0x10181c3, 0x10191c7, 0x001a1ce, 0x001b1d5, 0x001c1dc, 0x001d1e3,
+  0x001e1ea, 0x001f1f2, 0x101b1f0, 0x10171ee, 0x10111ed, 0x100a1ef, 0x10061f1, 0x10011f3,
+  0x00081f8, 0x000f1fd, 0x0016202, 0x001d208, 0x101b20c, 0x1019210, 0x1015210, 0x1011211,
+  0x100d20f, 0x100820e, 0x1006208, 0x1009201, 0x100d200, 0x10111ff, 0x1015200, 0x1019201,
+  0x101d208, 0x0017203, 0x00121ff, 0x1012203, 0x1012208, 0x101220c, 0x1012211, 0x0018218,
+  0x001e220, 0x1019223, 0x1015224, 0x1010226, 0x1009225, 0x1005223, 0x1000221, 0x0001219,
+  0x0001211, 0x0001209, 0x0001201, 0x00011f9, 0x00011f1, 0x00011e9, 0x00011e1, 0x00011d9,
+  0x00011d1, 0x00011c9, 0x00011c1, 0x00011b9, 0x00021b1, 0x00021a9, 0x00021a1, 0x0002199,
+  0x0002191, 0x0002189, 0x0002181, 0x0002179, 0x0002171, 0x000216a, 0x0002162, 0x000215a,
+  0x0002152, 0x000314a, 0x0003142, 0x000313a, 0x0003132, 0x000312a, 0x0003122, 0x000311a,
+  0x0003113, 0x000310b, 0x0003103, 0x00030fb, 0x00030f3, 0x00030eb, 0x00030e3, 0x00040db,
+  0x00040d3, 0x00040cb, 0x00040c3, 0x00040bc, 0x00040b4, 0x00040ac, 0x00040a4, 0x000409c,
+  0x0004094, 0x000408c, 0x0004084, 0x000407c, 0x0005074, 0x000506c, 0x0005064, 0x000505c,
+  0x0005054, 0x000504c, 0x0005044, 0x000503c, 0x0005034, 0x000502c, 0x0005024, 0x000501c,
+  0x0005014, 0x000500c,
+};
+
+static constexpr uint32_t EQN_09_POINTS[292] = {
+  0x000600f, 0x1005008, 0x1007002, 0x100e000, 0x1014000, 0x1017003, 0x1019009, 0x101600e,
+  0x0017016, 0x001801d, 0x1019024, 0x1017029, 0x101102c, 0x100b02b, 0x1008027, 0x1005022,
+  0x100a01c, 0x101001a, 0x101701d, 0x0013024, 0x000f02b, 0x000b032, 0x0007038, 0x100603d,
+  0x1006042, 0x1008046, 0x100b046, 0x100e043, 0x101003f, 0x101403a, 0x101703b, 0x101a040,
+  0x101a045, 0x0021049, 0x002804d, 0x002f050, 0x102f056, 0x102d059, 0x102905b, 0x1023057,
+  0x1020054, 0x101c051, 0x101c057, 0x101c05c, 0x001d063, 0x001e06a, 0x001f071, 0x0021077,
+  0x101c075, 0x1018073, 0x1012072, 0x100e073, 0x100a073, 0x1005076, 0x1000078, 0x000707f,
+  0x000e085, 0x001508b, 0x001b091, 0x101408d, 0x101008a, 0x100c086, 0x1006081, 0x000d081,
+  0x0014081, 0x001b081, 0x1014086, 0x101008a, 0x100c08d, 0x1006091, 0x000e094, 0x0015096,
+  0x001b098, 0x002309a, 0x101d09e, 0x10180a0, 0x10130a1, 0x100f0a1, 0x100b0a0, 0x100609e,
+  0x100009c, 0x00030a4, 0x00060ab, 0x00090b2, 0x000c0b9, 0x000f0c0, 0x00120c7, 0x00150ce,
+  0x00170d5, 0x10100d5, 0x100d0d5, 0x00100d1, 0x00120cd, 0x10120d3, 0x10120d7, 0x10120db,
+  0x00110e2, 0x000f0e9, 0x000d0ef, 0x000b0f6, 0x00090fc, 0x1008101, 0x1008106, 0x100a109,
+  0x100d10a, 0x100f107, 0x1011103, 0x10150fe, 0x10180ff, 0x101a105, 0x101b109, 0x001b110,
+  0x001b117, 0x101a11b, 0x101a120, 0x1015120, 0x1010120, 0x100c120, 0x1008120, 0x000811b,
+  0x0008117, 0x100811b, 0x1008120, 0x1008124, 0x1008128, 0x000e12b, 0x001412f, 0x0019133,
+  0x101a137, 0x101a13b, 0x101913f, 0x1016141, 0x1010142, 0x100c142, 0x1008142, 0x000f13d,
+  0x0015138, 0x001b133, 0x1014133, 0x100e133, 0x1008133, 0x0010137, 0x001713c, 0x001d141,
+  0x0024146, 0x002b14b, 0x0033150, 0x1033155, 0x1031158, 0x102d15a, 0x1027156, 0x1024153,
+  0x101f151, 0x101f156, 0x101f15b, 0x001f161, 0x0020168, 0x002116e, 0x0022175, 0x002317c,
+  0x101e17a, 0x101a178, 0x1013177, 0x100c179, 0x100717b, 0x100217d, 0x0009183, 0x000f18a,
+  0x0016190, 0x001c197, 0x1016192, 0x101218f, 0x100e18c, 0x1008187, 0x000f187, 0x0016187,
+  0x001c187, 0x101618c, 0x101218f, 0x100e192, 0x1008197, 0x000f199, 0x001619b, 0x001d19d,
+  0x00241a0, 0x101f1a3, 0x101a1a4, 0x10151a6, 0x10111a5, 0x100d1a5, 0x10081a3, 0x10021a1,
+  0x00051a8, 0x00081b0, 0x000a1b7, 0x000d1bf, 0x00101c7, 0x00121ce, 0x00151d6, 0x00171de,
+  0x10171e2, 0x10171e6, 0x10171ed, 0x00131e5, 0x000e1de, 0x100e1e2, 0x100e1e6, 0x100e1ed,
+  0x00111f3, 0x00141fa, 0x0016200, 0x0019207, 0x001b20e, 0x101f214, 0x102321a, 0x101b21a,
+  0x101421a, 0x100e21a, 0x100821a, 0x0008213, 0x000820d, 0x1008213, 0x100821a, 0x1008220,
+  0x1008226, 0x000821e, 0x0008216, 0x000820e, 0x0008206, 0x00081fe, 0x00081f6, 0x00081ee,
+  0x00081e6, 0x00081de, 0x00081d6, 0x00081ce, 0x00081c6, 0x00081be, 0x00081b6, 0x00081ae,
+  0x00081a6, 0x000819e, 0x0008196, 0x000818e, 0x0008186, 0x000817e, 0x0008176, 0x000816e,
+  0x0008166, 0x000815e, 0x0008156, 0x000814e, 0x0008146, 0x000813e, 0x0008136, 0x000812e,
+  0x0008126, 0x000811e, 0x0007116, 0x000710f, 0x0007107, 0x00070ff, 0x00070f7, 0x00070ef,
+  0x00070e7, 0x00070df, 0x00070d7, 0x00070cf, 0x00070c7, 0x00070bf, 0x00070b7, 0x00070af,
+  0x00070a7, 0x000709f, 0x0007097, 0x000708f, 0x0007087, 0x000707f, 0x0007077, 0x000706f,
+  0x0007067, 0x000705f, 0x0007057, 0x000704f, 0x0007047, 0x000703f, 0x0007037, 0x000702f,
+  0x0007027, 0x000701f, 0x0007017, 0x000600f,
+};
+
+static constexpr uint32_t EQN_10_POINTS[335] = {
+  0x000a000, 0x1009006, 0x100a00c, 0x1010011, 0x1014012, 0x1018012, 0x1020012, 0x1027012,
+  0x102e012, 0x1035012, 0x103c012, 0x1044012, 0x104b012, 0x1052012, 0x1059012, 0x105d014,
+  0x1062016, 0x106501c, 0x1063020, 0x1062024, 0x0068029, 0x006e02d, 0x106702d, 0x106202d,
+  0x105d02e, 0x105c030, 0x105d034, 0x1060036, 0x1064036, 0x1067034, 0x1067030, 0x106702e,
+  0x005f02d, 0x005702b, 0x005002a, 0x0048028, 0x0040027, 0x0039025, 0x0032023, 0x002a022,
+  0x0022020, 0x001b01f, 0x001301d, 0x000b01b, 0x100c01f, 0x100b022, 0x1009024, 0x1005024,
+  0x1001023, 0x1000022, 0x100001e, 0x100101c, 0x100301b, 0x100501c, 0x100601f, 0x1006023,
+  0x000d027, 0x001402b, 0x001b02e, 0x0022032, 0x0029036, 0x0030039, 0x003703d, 0x003e040,
+  0x103e045, 0x103e049, 0x103e04f, 0x0043050, 0x0049050, 0x104804c, 0x1047049, 0x1044048,
+  0x103d047, 0x1036047, 0x1030047, 0x003604e, 0x003a055, 0x003f05b, 0x0044062, 0x004a068,
+  0x1045066, 0x1041064, 0x103b063, 0x1037064, 0x1033065, 0x102e067, 0x1029069, 0x0030070,
+  0x0036076, 0x003c07c, 0x0043082, 0x103d07d, 0x103907a, 0x1035077, 0x102f072, 0x0036072,
+  0x003c072, 0x0043072, 0x103d077, 0x103907a, 0x103507d, 0x102f082, 0x0036084, 0x003d086,
+  0x0044088, 0x004b08a, 0x104608e, 0x1041090, 0x103c091, 0x1038091, 0x1034090, 0x102f08e,
+  0x102a08c, 0x002e094, 0x003109c, 0x00340a3, 0x00370ab, 0x003a0b2, 0x003d0ba, 0x00400c1,
+  0x00430c9, 0x00470d0, 0x10400d0, 0x10390d0, 0x10320ce, 0x10300c9, 0x10320c3, 0x10380c1,
+  0x103e0c3, 0x10400ca, 0x10400cf, 0x00400d6, 0x00410dc, 0x00420e2, 0x00430e8, 0x103d0e3,
+  0x10390e0, 0x10350dd, 0x102f0d8, 0x00360d8, 0x003c0d8, 0x00430d8, 0x103d0dd, 0x10390e0,
+  0x10350e3, 0x102f0e8, 0x00330ee, 0x00360f4, 0x00380fa, 0x003c100, 0x103c107, 0x103c10b,
+  0x103c10f, 0x0038108, 0x0034100, 0x1034107, 0x103410b, 0x103410f, 0x0034115, 0x003311c,
+  0x0032123, 0x003112a, 0x103812a, 0x103f12a, 0x104612b, 0x1046130, 0x1046136, 0x0040130,
+  0x003a12b, 0x103a130, 0x103a137, 0x003e13d, 0x0042143, 0x0046149, 0x004a150, 0x104514e,
+  0x104114c, 0x103b14b, 0x103414c, 0x102f14e, 0x102a151, 0x0031153, 0x0037156, 0x003d159,
+  0x004315c, 0x004a15f, 0x104415f, 0x103e15f, 0x103715f, 0x103315f, 0x102f160, 0x102d164,
+  0x102f16a, 0x103416d, 0x103a16e, 0x103f16b, 0x103f164, 0x103e160, 0x0041166, 0x004516c,
+  0x0048172, 0x004c178, 0x104717b, 0x104217c, 0x103d17e, 0x103917d, 0x103517d, 0x103017b,
+  0x102b17a, 0x002e180, 0x0031187, 0x003318e, 0x0036195, 0x003819c, 0x003b1a3, 0x103b1a7,
+  0x103b1ab, 0x103b1b1, 0x00381b8, 0x00371bf, 0x00351c6, 0x00321ce, 0x10391ce, 0x10401cf,
+  0x10471cf, 0x10471d4, 0x10471da, 0x00411d4, 0x003b1cf, 0x103b1d4, 0x103b1db, 0x003f1e1,
+  0x00431e8, 0x00471ee, 0x004b1f5, 0x10461f3, 0x10421f1, 0x103c1f0, 0x10351f1, 0x10301f3,
+  0x102b1f6, 0x00321f9, 0x00381fd, 0x003e200, 0x0045204, 0x104720a, 0x1045210, 0x1041212,
+  0x103b212, 0x1036211, 0x103420f, 0x103420a, 0x1035206, 0x1039204, 0x103c206, 0x103d20b,
+  0x103d211, 0x0042215, 0x004721a, 0x004d21f, 0x1047223, 0x1042224, 0x103d226, 0x1036225,
+  0x1031223, 0x102c221, 0x002c219, 0x002c211, 0x002b209, 0x002b201, 0x002a1f9, 0x002a1f1,
+  0x00291e9, 0x00291e1, 0x00281d9, 0x00281d2, 0x00271ca, 0x00271c2, 0x00261ba, 0x00261b2,
+  0x00251aa, 0x00251a2, 0x002419a, 0x0024192, 0x002318a, 0x0023183, 0x002217b, 0x0022173,
+  0x002116b, 0x0021163, 0x002015b, 0x0020153, 0x001f14b, 0x001f143, 0x001e13b, 0x001e134,
+  0x001d12c, 0x001d124, 0x001c11c, 0x001c114, 0x001b10d, 0x001b105, 0x001a0fd, 0x001a0f5,
+  0x00190ed, 0x00190e6, 0x00180de, 0x00180d6, 0x00170ce, 0x00170c6, 0x00160be, 0x00160b6,
+  0x00150ae, 0x00150a6, 0x001409e, 0x0014097, 0x001308f, 0x0013087, 0x001207f, 0x0012077,
+  0x001106f, 0x0011067, 0x001005f, 0x0010057, 0x000f04f, 0x000f048, 0x000e040, 0x000e038,
+  0x000d030, 0x000d028, 0x000c020, 0x000c018, 0x000b010, 0x000b008, 0x000a000,
+};
+
+static constexpr uint32_t EQN_11_POINTS[271] = {
+  0x000102f, 0x1001028, 0x1001021, 0x100101a, 0x1000012, 0x100000c, 0x1000006, 0x1000000,
+  0x1006000, 0x100c000, 0x1012000, 0x1019000, 0x101f000, 0x1025000, 0x102c000, 0x1033000,
+  0x103a000, 0x1040000, 0x1048000, 0x104f000, 0x1057000, 0x105e000, 0x105e006, 0x105e00b,
+  0x105e010, 0x105e018, 0x105e020, 0x105e028, 0x105e02f, 0x0057028, 0x0050020, 0x0048019,
+  0x0041011, 0x003a00a, 0x0032002, 0x1032009, 0x1032010, 0x1032017, 0x103201d, 0x1032023,
+  0x1032029, 0x103202f, 0x0033037, 0x003303f, 0x0034047, 0x003404f, 0x0035057, 0x003505e,
+  0x0036066, 0x003606e, 0x0037076, 0x003707e, 0x0038086, 0x003808d, 0x1038095, 0x103809c,
+  0x10380a4, 0x10380ab, 0x10380b3, 0x10380ba, 0x10380c1, 0x10380c8, 0x00340c1, 0x00300ba,
+  0x002c0b3, 0x00280ab, 0x00240a4, 0x002009d, 0x001c096, 0x001708e, 0x1017096, 0x101709d,
+  0x10170a4, 0x10170ab, 0x10170b3, 0x10170ba, 0x10170c1, 0x10170c8, 0x00160d0, 0x00140d8,
+  0x00130df, 0x00110e7, 0x00100ef, 0x000e0f6, 0x000c0fe, 0x000b106, 0x000910d, 0x0008114,
+  0x000611c, 0x0004124, 0x100c124, 0x1013124, 0x101a124, 0x1021124, 0x1027124, 0x102d124,
+  0x1034124, 0x103b125, 0x1041128, 0x104312e, 0x1044135, 0x104513c, 0x1041141, 0x103d146,
+  0x1038146, 0x1033146, 0x102d146, 0x1027146, 0x1020146, 0x1019146, 0x1012146, 0x100b146,
+  0x1004146, 0x000c146, 0x0014146, 0x001b146, 0x0023146, 0x002a146, 0x0032146, 0x0039147,
+  0x103d14c, 0x1041152, 0x1043157, 0x104515d, 0x1043161, 0x1041165, 0x103b166, 0x1034168,
+  0x102f168, 0x1029168, 0x1023168, 0x101c168, 0x1014168, 0x100c168, 0x1004168, 0x000516f,
+  0x0005177, 0x000517f, 0x0006186, 0x000618e, 0x0006196, 0x000719e, 0x00071a5, 0x00071ad,
+  0x00081b5, 0x00081bd, 0x00081c4, 0x00091cc, 0x00091d4, 0x00091dc, 0x10081d4, 0x10071cc,
+  0x10061c5, 0x10081bd, 0x100a1b6, 0x100c1af, 0x10131ac, 0x10191aa, 0x10201a7, 0x10261a5,
+  0x102e1a6, 0x10351a7, 0x103c1a8, 0x10411ad, 0x10461b2, 0x10491b8, 0x104b1bf, 0x104d1c6,
+  0x104b1cd, 0x10481d4, 0x10451dc, 0x004d1de, 0x00551e0, 0x005d1e2, 0x00641e4, 0x006c1e6,
+  0x00741e8, 0x007c1ea, 0x00841ec, 0x008c1ee, 0x00941f0, 0x009c1f2, 0x00a41f4, 0x00ac1f6,
+  0x00b41f8, 0x00bc1fa, 0x10bc201, 0x10bc208, 0x10bc210, 0x10b7215, 0x10b321b, 0x10ac21e,
+  0x10a5222, 0x109e21e, 0x109821a, 0x1092216, 0x108c213, 0x108620c, 0x1081206, 0x107b203,
+  0x1076200, 0x10711fe, 0x1071205, 0x107120c, 0x1071214, 0x107121a, 0x1071220, 0x1071226,
+  0x006f21e, 0x006d216, 0x006b20e, 0x0069206, 0x00681fe, 0x00661f6, 0x00641ee, 0x00621e6,
+  0x00611de, 0x005f1d6, 0x005e1ce, 0x005c1c6, 0x005a1be, 0x00591b6, 0x00571ae, 0x00551a6,
+  0x005319e, 0x0051196, 0x005018e, 0x004e186, 0x004c17e, 0x004a176, 0x004916e, 0x0047166,
+  0x004515e, 0x0043156, 0x004114e, 0x0040146, 0x003e13e, 0x003c136, 0x003a12e, 0x0039126,
+  0x003711e, 0x0035116, 0x003310f, 0x0031107, 0x00300ff, 0x002e0f7, 0x002c0ef, 0x002a0e7,
+  0x00290df, 0x00270d7, 0x00250cf, 0x00230c7, 0x00210bf, 0x00200b7, 0x001e0af, 0x001c0a7,
+  0x001a09f, 0x0019097, 0x001708f, 0x0015087, 0x001307f, 0x0011077, 0x001006f, 0x000e067,
+  0x000c05f, 0x000a057, 0x000904f, 0x0007047, 0x000503f, 0x0003037, 0x000102f,
+};
+
+static constexpr uint32_t EQN_12_POINTS[401] = {
+  0x006b000, 0x1072000, 0x1078000, 0x107e000, 0x1085000, 0x108c000, 0x1093000, 0x1099000,
+  0x109f000, 0x10a5000, 0x10a5008, 0x10a600f, 0x10a6015, 0x10a601b, 0x10a6021, 0x009f01b,
+  0x0098014, 0x009100e, 0x008a007, 0x0083000, 0x1084006, 0x108400b, 0x1084010, 0x1084016,
+  0x108401c, 0x1084021, 0x0085029, 0x0086031, 0x0088039, 0x0089041, 0x008a049, 0x008c051,
+  0x008d059, 0x008e061, 0x0090068, 0x109006f, 0x1090076, 0x109007d, 0x1090084, 0x109008b,
+  0x1090092, 0x008c08b, 0x0088084, 0x008407d, 0x0081076, 0x007d06f, 0x0079068, 0x107906f,
+  0x1079076, 0x107907d, 0x1079084, 0x107908b, 0x1079092, 0x008109a, 0x00870a2, 0x008e0aa,
+  0x00950b1, 0x009d0b9, 0x00a40c1, 0x00ab0c8, 0x00b20d0, 0x00ba0d8, 0x00c10e0, 0x00c80e7,
+  0x00cf0ef, 0x00d70f7, 0x00de0fe, 0x00e5106, 0x00ec10e, 0x00f4115, 0x10ef110, 0x10eb10a,
+  0x10e7104, 0x10e20fd, 0x10dd0f6, 0x10d60fe, 0x10d0105, 0x10ca10d, 0x10c4114, 0x00cb111,
+  0x00d310d, 0x00da10a, 0x00e2106, 0x00e9103, 0x00f10ff, 0x00f80fc, 0x01000f8, 0x01080f4,
+  0x11010f4, 0x10fa0f4, 0x10f30f4, 0x10ec0f4, 0x10e40f5, 0x10dd0f5, 0x10d60f5, 0x10d00f5,
+  0x10ca0f5, 0x10c40f4, 0x00c40fc, 0x00c4103, 0x00c510b, 0x00c5112, 0x00c5119, 0x00c6120,
+  0x00c6128, 0x00c712f, 0x00c7137, 0x00c713e, 0x00c8146, 0x00c814d, 0x00c9155, 0x10c714d,
+  0x10c6146, 0x10c713f, 0x10c8138, 0x10cf135, 0x10d7132, 0x10df130, 0x10e4134, 0x10ea138,
+  0x10f013c, 0x10f1143, 0x10f214b, 0x10f114f, 0x10f0154, 0x10e9154, 0x10e3155, 0x10dc155,
+  0x10d6156, 0x10d0156, 0x10cb156, 0x10c5156, 0x10bf156, 0x10b9156, 0x10b3156, 0x00b715d,
+  0x00bb165, 0x00bf16c, 0x00c3174, 0x10c7179, 0x10cb17f, 0x10cf185, 0x10c8185, 0x10c1185,
+  0x10ba185, 0x10b4185, 0x10ae185, 0x10a9186, 0x00a817f, 0x00a8179, 0x00a8173, 0x10a8179,
+  0x10a817f, 0x10a9185, 0x10a818a, 0x10a818f, 0x10a8195, 0x00ab19c, 0x00ae1a4, 0x00b21ac,
+  0x00b51b3, 0x00b91bb, 0x00bc1c3, 0x00bf1ca, 0x00c31d2, 0x00c61da, 0x00ca1e2, 0x10c81da,
+  0x10c71d3, 0x10c81cc, 0x10c91c5, 0x10d01c2, 0x10d81c0, 0x10e01be, 0x10e51c1, 0x10eb1c5,
+  0x10f11c9, 0x10f21d0, 0x10f31d8, 0x10f21dd, 0x10f11e2, 0x10ea1e2, 0x10e41e3, 0x10dd1e3,
+  0x10d71e4, 0x10d11e4, 0x10cc1e4, 0x10c61e4, 0x10c01e4, 0x10ba1e4, 0x10b41e4, 0x00bb1ea,
+  0x00c31f1, 0x00cb1f8, 0x00d31ff, 0x10d3205, 0x10d320b, 0x10ce211, 0x10ca213, 0x10c6215,
+  0x10bf211, 0x10b920d, 0x10b3206, 0x10ae203, 0x10aa201, 0x10aa207, 0x10aa20d, 0x10aa212,
+  0x10aa217, 0x00a920f, 0x00a8207, 0x00a71ff, 0x00a61f7, 0x00a61ef, 0x00a51e7, 0x00a41df,
+  0x00a31d7, 0x00a21cf, 0x00a21c7, 0x00a11bf, 0x00a01b7, 0x009f1b0, 0x009e1a8, 0x009e1a0,
+  0x009d198, 0x009c190, 0x009b188, 0x009b180, 0x009a178, 0x0099170, 0x0098168, 0x0097160,
+  0x0097158, 0x0096150, 0x0095149, 0x0094141, 0x0093139, 0x0093131, 0x0092129, 0x0091121,
+  0x0090119, 0x008f112, 0x008f10a, 0x008e102, 0x008d0fa, 0x008c0f2, 0x008c0ea, 0x108c0f2,
+  0x108c0fa, 0x108c102, 0x108c10a, 0x108c112, 0x108c119, 0x108c121, 0x108c128, 0x108c130,
+  0x108c138, 0x108c140, 0x108c148, 0x108c150, 0x108c158, 0x108c15f, 0x108c167, 0x108c16f,
+  0x108c176, 0x108c17e, 0x108c186, 0x108c18e, 0x108c195, 0x108c19d, 0x108c1a5, 0x108c1ac,
+  0x108c1b4, 0x108c1bc, 0x108c1c4, 0x108c1cb, 0x108c1d3, 0x108c1da, 0x108c1e2, 0x108c1e9,
+  0x108c1f1, 0x108c1f8, 0x108c200, 0x108c207, 0x108c20f, 0x108c216, 0x108c21e, 0x108c226,
+  0x008621e, 0x0082216, 0x007c20e, 0x0077207, 0x00721ff, 0x006c1f7, 0x00671ef, 0x00611e8,
+  0x005c1e0, 0x00571d8, 0x00511d0, 0x004c1c9, 0x00461c1, 0x00411b9, 0x003c1b2, 0x00361aa,
+  0x00311a2, 0x002c19a, 0x0026193, 0x002118b, 0x001b183, 0x001617b, 0x0011174, 0x000b16c,
+  0x0006164, 0x000015d, 0x100815d, 0x100f15d, 0x101515d, 0x101b15d, 0x102115d, 0x102515d,
+  0x001f15d, 0x1022162, 0x1025167, 0x102716d, 0x1026173, 0x102517a, 0x101e181, 0x0026184,
+  0x002e188, 0x003618c, 0x003e190, 0x0046194, 0x004d198, 0x104d19d, 0x104d1a3, 0x10491a9,
+  0x10451ab, 0x10411ad, 0x103b1a9, 0x10341a5, 0x102f19e, 0x102b19c, 0x102619a, 0x102619f,
+  0x10261a5, 0x10261aa, 0x10261af, 0x00281a7, 0x002919f, 0x002a197, 0x002c18f, 0x002d187,
+  0x002e17f, 0x002f177, 0x003116f, 0x0032167, 0x003315f, 0x0035157, 0x003614f, 0x0037147,
+  0x003813f, 0x003a137, 0x003b12f, 0x003c127, 0x003d11f, 0x003f117, 0x0040110, 0x0041108,
+  0x0043100, 0x00440f8, 0x00450f0, 0x00460e8, 0x00480e0, 0x00490d8, 0x004a0d0, 0x004c0c8,
+  0x004d0c0, 0x004e0b8, 0x004f0b0, 0x00510a8, 0x00520a0, 0x0053098, 0x0054090, 0x0056088,
+  0x0057080, 0x0058078, 0x005a070, 0x005b068, 0x005c060, 0x005d058, 0x005f050, 0x0060048,
+  0x0061040, 0x0063038, 0x0064030, 0x0065028, 0x0066020, 0x0068018, 0x0069010, 0x006a008,
+  0x006b000,
+};
+
+static constexpr uint32_t EQN_13_POINTS[401] = {
+  0x004c000, 0x1053000, 0x105a000, 0x1060000, 0x1067000, 0x106e000, 0x1075000, 0x107b000,
+  0x1081000, 0x1087000, 0x1087008, 0x108800f, 0x1088015, 0x108801b, 0x1088021, 0x008101b,
+  0x007a014, 0x007300e, 0x006c007, 0x0065000, 0x1066006, 0x106600b, 0x1066010, 0x1066016,
+  0x106601c, 0x1066021, 0x0068029, 0x0069031, 0x006a039, 0x006c041, 0x006d049, 0x006e051,
+  0x006f059, 0x0070061, 0x0072068, 0x107206f, 0x1072076, 0x107207d, 0x1072084, 0x107208b,
+  0x1072092, 0x006f08b, 0x006b084, 0x006707d, 0x0063076, 0x005f06f, 0x005b068, 0x105b06f,
+  0x105b076, 0x105b07d, 0x105b084, 0x105b08b, 0x105b092, 0x006309a, 0x006b0a2, 0x00720aa,
+  0x007a0b2, 0x00820ba, 0x008a0c2, 0x00910c9, 0x00990d1, 0x00a10d9, 0x00a90e1, 0x00b10e9,
+  0x00b90f1, 0x00c10f8, 0x10c10fe, 0x10c1104, 0x10c110a, 0x10bb10a, 0x10b610a, 0x10b1109,
+  0x10ab107, 0x10a5105, 0x10a20ff, 0x109f0f8, 0x10a00f2, 0x10a10eb, 0x10a80e6, 0x10af0e0,
+  0x10b50e0, 0x10bb0df, 0x10c10de, 0x10c80e1, 0x10cf0e4, 0x10d70e7, 0x10da0ee, 0x10de0f5,
+  0x10dd0fb, 0x10dc100, 0x10db105, 0x00d310b, 0x00cb111, 0x00c3116, 0x00bb11c, 0x00b3122,
+  0x00ab128, 0x00a412e, 0x10a912e, 0x10ae12e, 0x10b412e, 0x10ba12e, 0x10c112e, 0x10c612e,
+  0x10cb12e, 0x10d0131, 0x10d1138, 0x10d213f, 0x10cd146, 0x10c7146, 0x10c1146, 0x10b9146,
+  0x10b2146, 0x10ab146, 0x10a4146, 0x00ab146, 0x00b3146, 0x00ba146, 0x00c2146, 0x00ca147,
+  0x10d014e, 0x10d1152, 0x10d2156, 0x10d015c, 0x10cb15d, 0x10c715e, 0x10c115e, 0x10bb15e,
+  0x10b315e, 0x10ac15e, 0x10a515e, 0x00a5165, 0x00a516c, 0x00a5174, 0x10a9179, 0x10ad17f,
+  0x10b1185, 0x10aa185, 0x10a3185, 0x109c185, 0x1096185, 0x1090185, 0x108b186, 0x008a17f,
+  0x008a179, 0x008a173, 0x108a179, 0x108a17f, 0x108a185, 0x108a18a, 0x108a18f, 0x108a195,
+  0x009119b, 0x00981a1, 0x009f1a7, 0x00a61ad, 0x10ad1ad, 0x10b51ad, 0x10bc1ad, 0x10c31ad,
+  0x10c71ad, 0x10cc1ae, 0x10d11b0, 0x10d21b7, 0x10d41be, 0x10ce1c5, 0x10c81c5, 0x10c31c5,
+  0x10bb1c5, 0x10b41c5, 0x10ad1c5, 0x10a61c5, 0x00ad1c5, 0x00b41c5, 0x00bc1c5, 0x00c31c5,
+  0x00cb1c6, 0x10d11cd, 0x10d21d1, 0x10d41d5, 0x10d11db, 0x10cc1dc, 0x10c81dd, 0x10c21dd,
+  0x10bc1dd, 0x10b41dd, 0x10ad1dd, 0x10a61dd, 0x00a91e3, 0x00ac1ea, 0x00af1f1, 0x00b21f8,
+  0x00b51ff, 0x10b5205, 0x10b520b, 0x10b0211, 0x10ac213, 0x10a8215, 0x10a1211, 0x109b20d,
+  0x1095206, 0x1090203, 0x108c201, 0x108c207, 0x108c20d, 0x108c212, 0x108c217, 0x008b20f,
+  0x008a207, 0x00891ff, 0x00881f7, 0x00881ef, 0x00871e7, 0x00861df, 0x00851d7, 0x00841cf,
+  0x00841c7, 0x00831bf, 0x00821b7, 0x00811b0, 0x00801a8, 0x00801a0, 0x007f198, 0x007e190,
+  0x007d188, 0x007d180, 0x007c178, 0x007b170, 0x007a168, 0x0079160, 0x0079158, 0x0078150,
+  0x0077149, 0x0076141, 0x0075139, 0x0075131, 0x0074129, 0x0073121, 0x0072119, 0x0071112,
+  0x007110a, 0x0070102, 0x006f0fa, 0x006f0f2, 0x006e0ea, 0x106e0f2, 0x106e0fa, 0x106e102,
+  0x106e10a, 0x106e112, 0x106e119, 0x106e121, 0x106e128, 0x106e130, 0x106e138, 0x106e140,
+  0x106e148, 0x106e150, 0x106e158, 0x106e15f, 0x106e167, 0x106e16f, 0x106e176, 0x106e17e,
+  0x106e186, 0x106e18e, 0x106e195, 0x106e19d, 0x106e1a5, 0x106e1ac, 0x106e1b4, 0x106e1bc,
+  0x106e1c4, 0x106e1cb, 0x106e1d3, 0x106e1da, 0x106e1e2, 0x106e1e9, 0x106e1f1, 0x106e1f8,
+  0x106e200, 0x106e207, 0x106e20f, 0x106e216, 0x106e21e, 0x106e226, 0x006a21e, 0x0066216,
+  0x006120e, 0x005d206, 0x00581fe, 0x00541f6, 0x00501ee, 0x004b1e6, 0x00471de, 0x00421d6,
+  0x003e1ce, 0x003a1c6, 0x00351be, 0x00311b6, 0x002c1ae, 0x00281a6, 0x002419e, 0x001f196,
+  0x001b18e, 0x0016186, 0x001217e, 0x000e176, 0x000916e, 0x0005166, 0x000015f, 0x100815f,
+  0x100f15f, 0x101515f, 0x101b15f, 0x102015f, 0x102415f, 0x001f15f, 0x1022164, 0x1025169,
+  0x102616f, 0x1025175, 0x102417b, 0x102117f, 0x101d183, 0x0024186, 0x002b189, 0x003218c,
+  0x0039190, 0x0040193, 0x0047196, 0x004d19a, 0x104d19f, 0x104c1a5, 0x10481ab, 0x10441ad,
+  0x10401af, 0x103a1ab, 0x10341a7, 0x102e1a0, 0x102a19e, 0x102619c, 0x10261a1, 0x10261a7,
+  0x10261ab, 0x10261b0, 0x00271a8, 0x00281a0, 0x0029198, 0x0029190, 0x002a188, 0x002b180,
+  0x002b179, 0x002c171, 0x002d169, 0x002d161, 0x002e159, 0x002f151, 0x002f149, 0x0030142,
+  0x003113a, 0x0032132, 0x003212a, 0x0033122, 0x003411a, 0x0034113, 0x003510c, 0x0036104,
+  0x00360fc, 0x00370f4, 0x00380ec, 0x00380e4, 0x00390dc, 0x003a0d5, 0x003b0cd, 0x003b0c5,
+  0x003c0bd, 0x003d0b5, 0x003d0ad, 0x003e0a5, 0x003f09e, 0x003f096, 0x004008e, 0x0041086,
+  0x004107e, 0x0042076, 0x004306e, 0x0044067, 0x004405f, 0x0045057, 0x004604f, 0x0046047,
+  0x004703f, 0x0048037, 0x0048030, 0x0049028, 0x004a020, 0x004a018, 0x004b010, 0x004c008,
+  0x004c000,
+};
+
+static constexpr uint32_t EQN_14_POINTS[318] = {
+  0x0000000, 0x1007000, 0x100d000, 0x1014000, 0x101a000, 0x1020000, 0x1026000, 0x1026005,
+  0x102600a, 0x1026010, 0x1026015, 0x001e00e, 0x0018007, 0x0010000, 0x1010005, 0x101000a,
+  0x1010010, 0x1010015, 0x001201d, 0x0013024, 0x001502c, 0x0016033, 0x001703a, 0x1017041,
+  0x1017047, 0x101704e, 0x1017054, 0x001404e, 0x0010047, 0x000d041, 0x000903a, 0x1009041,
+  0x1009047, 0x100904e, 0x1009054, 0x000805b, 0x0007061, 0x0005068, 0x000406e, 0x0002074,
+  0x1007074, 0x100c074, 0x1011074, 0x1015074, 0x101b074, 0x101e076, 0x101e07b, 0x101f07f,
+  0x101c083, 0x1015083, 0x100f083, 0x1009083, 0x1002083, 0x0008084, 0x000e084, 0x0014084,
+  0x001a084, 0x101e088, 0x102008d, 0x101e091, 0x1018092, 0x1014092, 0x1010092, 0x100a092,
+  0x1003092, 0x000809a, 0x000d0a2, 0x00110aa, 0x00160b2, 0x00190ba, 0x001e0c2, 0x00230c9,
+  0x101e0c6, 0x10190c2, 0x10130bd, 0x100d0b8, 0x10080b4, 0x10030b0, 0x000a0b1, 0x00100b1,
+  0x00170b1, 0x001c0b1, 0x00230b1, 0x101e0b5, 0x101a0b9, 0x10130be, 0x100c0c2, 0x10080c6,
+  0x10030c9, 0x000b0c6, 0x00120c3, 0x00180bf, 0x001f0bc, 0x00260b9, 0x002e0b5, 0x102e0ba,
+  0x10310ba, 0x10310b5, 0x102e0b5, 0x002e0bc, 0x002e0c3, 0x102e0c7, 0x10310c7, 0x10310c2,
+  0x102e0c3, 0x002b0cb, 0x00280d3, 0x00250db, 0x00220e3, 0x001f0eb, 0x001c0f3, 0x001a0fa,
+  0x10150fa, 0x100f0fa, 0x10080fa, 0x000d0f4, 0x00120ee, 0x10120f4, 0x10120f9, 0x1012100,
+  0x1012106, 0x001110e, 0x000f115, 0x000d11d, 0x000b125, 0x000a12d, 0x0008135, 0x000613d,
+  0x0004145, 0x1004140, 0x100313b, 0x1004136, 0x1005131, 0x100b12f, 0x101112d, 0x101612d,
+  0x101a12e, 0x101f133, 0x1020137, 0x102213b, 0x1020140, 0x101e145, 0x001e14c, 0x001e153,
+  0x001f15b, 0x001f162, 0x001f169, 0x0020171, 0x0020178, 0x0021180, 0x101c17c, 0x1017179,
+  0x1011174, 0x100b16f, 0x100616b, 0x1001167, 0x0008167, 0x000e167, 0x0015167, 0x001a167,
+  0x0021167, 0x101c16b, 0x101816f, 0x1011174, 0x100a179, 0x100617c, 0x1001180, 0x000817d,
+  0x000f17b, 0x0016178, 0x001d176, 0x0024173, 0x002b171, 0x102b175, 0x102f175, 0x102f171,
+  0x102b171, 0x0029178, 0x002717f, 0x0025186, 0x002318e, 0x0022195, 0x002019c, 0x001e1a4,
+  0x001c1ab, 0x001a1b2, 0x00191ba, 0x10131ba, 0x100d1ba, 0x10071ba, 0x000c1b4, 0x00111ae,
+  0x10111b3, 0x10111b9, 0x10111bf, 0x10111c6, 0x00141cd, 0x00161d5, 0x00181dc, 0x001b1e4,
+  0x001d1eb, 0x00201f3, 0x101c1ed, 0x10181e8, 0x10151e3, 0x10121df, 0x100e1e4, 0x10091e9,
+  0x10061ed, 0x10021f2, 0x000a1ee, 0x00111eb, 0x00181e8, 0x001e1e4, 0x00251e1, 0x002d1de,
+  0x10271de, 0x10211de, 0x101b1de, 0x10161de, 0x10111df, 0x100a1de, 0x10021de, 0x00061e5,
+  0x000a1ed, 0x000d1f5, 0x00111fd, 0x0015205, 0x001820d, 0x001b215, 0x001f21d, 0x0023225,
+  0x101e221, 0x101921e, 0x1013219, 0x100c214, 0x1007210, 0x100220d, 0x000920d, 0x000f20d,
+  0x001620d, 0x001b20d, 0x002220d, 0x101d211, 0x1019215, 0x1012219, 0x100b21e, 0x1007222,
+  0x1002226, 0x000221e, 0x0002216, 0x000220e, 0x0002206, 0x00021fe, 0x00021f6, 0x00021ee,
+  0x00021e6, 0x00021de, 0x00021d6, 0x00021ce, 0x00021c6, 0x00021be, 0x00021b6, 0x00021ae,
+  0x00021a6, 0x000219e, 0x0002196, 0x000218e, 0x0002186, 0x000217e, 0x0002176, 0x000216e,
+  0x0002166, 0x000215e, 0x0002156, 0x000214e, 0x0002146, 0x000213e, 0x0002136, 0x000212e,
+  0x0002126, 0x000211e, 0x0002116, 0x0001110, 0x0001108, 0x0001100, 0x00010f8, 0x00010f0,
+  0x00010e8, 0x00010e0, 0x00010d8, 0x00010d0, 0x00010c8, 0x00010c0, 0x00010b8, 0x00010b0,
+  0x00010a8, 0x00010a0, 0x0001098, 0x0001090, 0x0001088, 0x0001080, 0x0001078, 0x0001070,
+  0x0001068, 0x0001060, 0x0001058, 0x0001050, 0x0001048, 0x0001040, 0x0001038, 0x0001030,
+  0x0001028, 0x0001020, 0x0001018, 0x0001010, 0x0001008, 0x0000000,
+};
+
+static constexpr uint32_t EQN_15_POINTS[626] = {
+  0x011700b, 0x111e00e, 0x1125011, 0x112c013, 0x1133016, 0x113a019, 0x114201c, 0x113a01f,
+  0x1133022, 0x112c025, 0x1125028, 0x111e02b, 0x111702d, 0x011c02b, 0x0121029, 0x0127026,
+  0x1127021, 0x112701c, 0x1127017, 0x1127011, 0x012a019, 0x012d021, 0x0130028, 0x0133030,
+  0x0136038, 0x013903f, 0x1131042, 0x1129044, 0x1122046, 0x111e04a, 0x111a04e, 0x111f052,
+  0x1125056, 0x112b059, 0x113205c, 0x113905e, 0x0137065, 0x013506c, 0x0133072, 0x0131079,
+  0x012f080, 0x012e086, 0x112e08c, 0x112e092, 0x112e097, 0x112e09d, 0x112e0a2, 0x112e0a7,
+  0x012a0a1, 0x012609a, 0x0123094, 0x011f08d, 0x011c086, 0x111c08c, 0x111c092, 0x111c097,
+  0x111c09d, 0x111c0a2, 0x111c0a7, 0x01210af, 0x01260b6, 0x012b0bd, 0x01300c4, 0x01350cb,
+  0x013a0d2, 0x013f0d9, 0x01440e0, 0x11420e7, 0x11410ee, 0x113c0f1, 0x11360f3, 0x112f0f4,
+  0x11280f4, 0x11210f6, 0x111b0f7, 0x11180fd, 0x1116102, 0x011d0fe, 0x01240f9, 0x012b0f4,
+  0x11240ee, 0x111f0eb, 0x111b0e8, 0x11190e3, 0x11180de, 0x011c0e6, 0x01210ed, 0x01260f4,
+  0x012a0fc, 0x012f103, 0x013410a, 0x0139111, 0x1133113, 0x112d114, 0x1127116, 0x1121118,
+  0x111d11c, 0x111a121, 0x111f124, 0x1124128, 0x112b12b, 0x113212e, 0x1139131, 0x0135129,
+  0x0132121, 0x012f119, 0x012c112, 0x012910a, 0x0125102, 0x01220fb, 0x011f0f3, 0x011c0eb,
+  0x01190e3, 0x01150db, 0x01120d3, 0x010f0cc, 0x010c0c4, 0x01090bc, 0x01060b4, 0x01020ac,
+  0x00ff0a4, 0x00fc09c, 0x00f9095, 0x00f608d, 0x00f2085, 0x00ef07d, 0x00ec075, 0x00e906d,
+  0x00e6066, 0x00e305e, 0x00df056, 0x00dc04e, 0x00d9046, 0x00d603e, 0x00d3037, 0x00cf02f,
+  0x00cc027, 0x00c901f, 0x00c6017, 0x00c300f, 0x00c0007, 0x10b9008, 0x10b3008, 0x10ac008,
+  0x10a6008, 0x10a0008, 0x1099008, 0x1091008, 0x1089008, 0x1081007, 0x008300e, 0x0085015,
+  0x008701c, 0x0089023, 0x008b02a, 0x109202d, 0x1099030, 0x10a0032, 0x10a7035, 0x10ae038,
+  0x10b603b, 0x10ae03e, 0x10a7041, 0x10a0044, 0x1099047, 0x109204a, 0x108b04d, 0x009104b,
+  0x0096048, 0x009b045, 0x109b040, 0x109b03b, 0x109b036, 0x109b030, 0x009c038, 0x009d040,
+  0x009e048, 0x009f050, 0x00a0057, 0x00a105f, 0x00a2067, 0x00a306f, 0x00a4076, 0x10a407d,
+  0x10a4084, 0x10a408a, 0x10a4090, 0x10a4096, 0x10a409c, 0x00a80a3, 0x00ad0aa, 0x00b20b1,
+  0x00b60b8, 0x00bb0bf, 0x00c00c5, 0x10be0cc, 0x10bd0d3, 0x10b80d7, 0x10b10d9, 0x10aa0da,
+  0x10a30da, 0x109d0dc, 0x10960dd, 0x10940e3, 0x10920e8, 0x00990e3, 0x00a00de, 0x00a60d9,
+  0x109f0d3, 0x109b0d0, 0x10970cd, 0x10960c9, 0x10940c4, 0x009b0cc, 0x00a20d3, 0x00a70da,
+  0x00ae0e2, 0x00b40e9, 0x00bb0f0, 0x00c20f7, 0x10c20fe, 0x10c2104, 0x10c210a, 0x10c210f,
+  0x00c110a, 0x00c1105, 0x10ba105, 0x10b3105, 0x10ad105, 0x10a8105, 0x10a3105, 0x109e105,
+  0x1098105, 0x1092105, 0x00920fe, 0x00920f7, 0x10920fe, 0x1092104, 0x109210a, 0x109210f,
+  0x0099113, 0x00a0117, 0x00a711c, 0x00ae120, 0x00b5124, 0x00bc129, 0x00c312d, 0x00ca132,
+  0x10c3132, 0x10bd132, 0x10b6132, 0x10b0132, 0x10aa133, 0x10a2132, 0x109b132, 0x1093132,
+  0x108b132, 0x008f139, 0x0092140, 0x0095148, 0x009814f, 0x009b157, 0x009e15e, 0x00a1166,
+  0x00a316d, 0x00a7175, 0x10a717a, 0x10a7180, 0x10a7186, 0x10a718b, 0x10a7190, 0x10a7196,
+  0x00a318f, 0x00a0188, 0x009d182, 0x009917b, 0x0095175, 0x109517a, 0x1095180, 0x1095186,
+  0x109518b, 0x1095190, 0x1095196, 0x009a19d, 0x009f1a4, 0x00a31ab, 0x00a81b2, 0x00ad1b9,
+  0x00b21c0, 0x00b71c7, 0x00bc1ce, 0x00c11d6, 0x10be1dc, 0x10bb1e2, 0x10b51e3, 0x10b01e5,
+  0x10ab1e7, 0x10a51e5, 0x10a11e4, 0x109b1e3, 0x10941dd, 0x10931d9, 0x10921d5, 0x10941ce,
+  0x109a1c9, 0x10a01c8, 0x10a51c7, 0x10ab1c7, 0x10b21c9, 0x10ba1cb, 0x10bd1d0, 0x10c11d6,
+  0x00be1ce, 0x00bc1c6, 0x00ba1be, 0x00b81b6, 0x00b61ae, 0x00b41a6, 0x00b219e, 0x00b0196,
+  0x00ae18e, 0x00ab186, 0x00a917e, 0x00a7177, 0x00a516f, 0x00a3167, 0x00a215f, 0x00a0157,
+  0x009e14f, 0x009c147, 0x009a13f, 0x0097137, 0x009512f, 0x0093127, 0x009111f, 0x008f118,
+  0x008d111, 0x008b109, 0x0089101, 0x00870f9, 0x00840f1, 0x00820e9, 0x00800e1, 0x007e0d9,
+  0x007c0d1, 0x007a0c9, 0x00780c2, 0x00760ba, 0x00740b2, 0x00720aa, 0x006f0a2, 0x006d09a,
+  0x006b092, 0x006908a, 0x0067082, 0x006507a, 0x0063072, 0x006106a, 0x005f063, 0x005d05b,
+  0x005a053, 0x005804b, 0x0056043, 0x005403b, 0x0052033, 0x005002b, 0x004e023, 0x004c01b,
+  0x004a013, 0x004700b, 0x1041008, 0x103a005, 0x1033002, 0x102d001, 0x1026000, 0x1021001,
+  0x101c002, 0x1016003, 0x100f007, 0x100800a, 0x100000d, 0x0005014, 0x000901b, 0x000e022,
+  0x0012028, 0x101902b, 0x102002e, 0x1026030, 0x102e034, 0x1035037, 0x103c03a, 0x103503d,
+  0x102e040, 0x1027043, 0x1020046, 0x1019049, 0x101204b, 0x0018049, 0x001d047, 0x0022044,
+  0x102203f, 0x1022039, 0x1022034, 0x102102f, 0x0022037, 0x002303f, 0x0024046, 0x002504e,
+  0x0026056, 0x002705d, 0x0028065, 0x002906d, 0x0029074, 0x102907b, 0x1029082, 0x1029089,
+  0x102908f, 0x1029095, 0x102909b, 0x002d0a3, 0x00300aa, 0x00340b2, 0x00370b9, 0x003a0c0,
+  0x10390c7, 0x10370ce, 0x10320d2, 0x102c0d4, 0x10250d5, 0x101e0d5, 0x10180d7, 0x10110d8,
+  0x100f0de, 0x100c0e3, 0x00130de, 0x001a0d9, 0x00210d4, 0x101a0ce, 0x10160cb, 0x10110c8,
+  0x10100c4, 0x100e0bf, 0x00140c6, 0x001a0cd, 0x00200d4, 0x00260db, 0x002c0e2, 0x00320e9,
+  0x00380f0, 0x003d0f7, 0x103d0fe, 0x103d104, 0x103d10a, 0x103d10f, 0x003d10a, 0x003d105,
+  0x1036105, 0x102e105, 0x1029105, 0x1024105, 0x101e105, 0x1019105, 0x1013105, 0x100d105,
+  0x000d0fe, 0x000d0f7, 0x100d0fe, 0x100d104, 0x100d10a, 0x100d10f, 0x0015113, 0x001c115,
+  0x0024119, 0x002b11c, 0x003311f, 0x003a123, 0x0042126, 0x004912a, 0x104312e, 0x103d132,
+  0x1036133, 0x102f135, 0x1027137, 0x1022136, 0x101c136, 0x1016136, 0x100f133, 0x1008130,
+  0x100012d, 0x0007134, 0x000e13c, 0x0014143, 0x001b14b, 0x0022153, 0x002815a, 0x002f162,
+  0x003516a, 0x102f16c, 0x102916e, 0x1023170, 0x101d172, 0x101a176, 0x101617a, 0x101b17d,
+  0x1020181, 0x1027184, 0x102e187, 0x103518a, 0x0034191, 0x0033199, 0x00311a0, 0x00301a8,
+  0x002e1af, 0x002d1b7, 0x002b1bf, 0x102b1c4, 0x102b1c9, 0x102b1cf, 0x102b1d4, 0x102b1da,
+  0x102b1e0, 0x00281d9, 0x00241d2, 0x00201cc, 0x001c1c5, 0x00181bf, 0x10181c4, 0x10181c9,
+  0x10181cf, 0x10181d4, 0x10181da, 0x10181e0, 0x001d1e7, 0x00221ee, 0x00271f6, 0x002c1fd,
+  0x0031205, 0x003620c, 0x003b214, 0x103821a, 0x1035220, 0x1030222, 0x102b224, 0x1025226,
+  0x1020224, 0x101b223, 0x1015222, 0x100f21b, 0x100e217, 0x100c213, 0x100f20c, 0x1015208,
+  0x101b207, 0x1020206, 0x1025205, 0x102b206, 0x1030207, 0x1035209, 0x103820e, 0x103b214,
+  0x003f20c, 0x0042204, 0x00451fc, 0x00491f4, 0x004c1ec, 0x004f1e4, 0x00531dc, 0x00561d4,
+  0x00591cc, 0x005d1c5, 0x00601bd, 0x00631b5, 0x00671ad, 0x006a1a5, 0x006d19d, 0x0071195,
+  0x007418d, 0x0077185, 0x007b17e, 0x007e176, 0x008116e, 0x0085166, 0x008815e, 0x008b156,
+  0x008f14e, 0x0092146, 0x009513e, 0x0099136, 0x009c12f, 0x009f127, 0x00a211f, 0x00a5117,
+  0x00a9110, 0x00ac108, 0x00af100, 0x00b30f8, 0x00b60f0, 0x00b90e9, 0x00bd0e1, 0x00c00d9,
+  0x00c30d1, 0x00c70c9, 0x00ca0c1, 0x00cd0b9, 0x00d10b1, 0x00d40a9, 0x00d70a1, 0x00db09a,
+  0x00de092, 0x00e108a, 0x00e5082, 0x00e807a, 0x00eb072, 0x00ef06a, 0x00f2062, 0x00f505a,
+  0x00f9053, 0x00fc04b, 0x00ff043, 0x010303b, 0x0106033, 0x010902b, 0x010d023, 0x011001b,
+  0x0113013, 0x011700b,
+};
+
+static constexpr uint32_t EQN_16_POINTS[437] = {
+  0x0030001, 0x1031007, 0x103300a, 0x103600b, 0x103c00a, 0x103e005, 0x103c000, 0x1037000,
+  0x1033000, 0x102f000, 0x1029000, 0x002d007, 0x003100e, 0x0035015, 0x003901c, 0x003d023,
+  0x0041029, 0x103d027, 0x1039025, 0x1033024, 0x102d026, 0x1029028, 0x102402a, 0x0028032,
+  0x002c039, 0x103003b, 0x103403c, 0x103803e, 0x103d040, 0x1038042, 0x1034044, 0x1030046,
+  0x102c047, 0x0032044, 0x1032040, 0x103203b, 0x0035043, 0x003804a, 0x003c052, 0x003f059,
+  0x0043060, 0x103d060, 0x1037060, 0x1031060, 0x102b060, 0x1024060, 0x101d060, 0x0024066,
+  0x002b06c, 0x0031072, 0x0037078, 0x003e07d, 0x103e082, 0x103d085, 0x103b087, 0x1038088,
+  0x1034085, 0x0039081, 0x003e07c, 0x103707c, 0x103207c, 0x102b07c, 0x102b081, 0x102b085,
+  0x102f087, 0x1032086, 0x1034085, 0x1034082, 0x103407c, 0x0037083, 0x003a089, 0x003d090,
+  0x0040096, 0x004309c, 0x103e0a0, 0x10390a1, 0x10350a2, 0x102e0a1, 0x102a0a0, 0x102509e,
+  0x00290a5, 0x002d0ac, 0x00300b3, 0x00340ba, 0x00370c1, 0x10370c8, 0x10370cf, 0x00340c8,
+  0x00300c1, 0x10300c8, 0x10300cf, 0x00360d6, 0x003c0dd, 0x00420e4, 0x00480eb, 0x004e0f2,
+  0x00550f9, 0x1056100, 0x1058103, 0x105a104, 0x1061102, 0x10630fe, 0x10610f8, 0x105c0f8,
+  0x10580f8, 0x10540f8, 0x104e0f8, 0x0052100, 0x0057108, 0x005c110, 0x0061117, 0x006611f,
+  0x106211d, 0x105e11b, 0x105811a, 0x105211c, 0x104d11e, 0x1049120, 0x004f125, 0x005512b,
+  0x005b130, 0x0061136, 0x106113b, 0x106013e, 0x105e141, 0x105b141, 0x105713f, 0x005c13a,
+  0x0061135, 0x105a135, 0x1054135, 0x104e135, 0x104e13a, 0x104f13e, 0x1052140, 0x1055140,
+  0x105713f, 0x105713b, 0x1057136, 0x005a13d, 0x005e144, 0x006114b, 0x0065152, 0x0069159,
+  0x1063159, 0x105d159, 0x1058159, 0x1051159, 0x104a159, 0x1044159, 0x004715f, 0x004a166,
+  0x004d16c, 0x0051173, 0x1055175, 0x1059177, 0x105e178, 0x106317a, 0x105e17c, 0x105a17e,
+  0x1055180, 0x1051182, 0x005817f, 0x105817a, 0x1058176, 0x005b17d, 0x005f185, 0x006318d,
+  0x0067195, 0x1063199, 0x105e19a, 0x105a19b, 0x105319b, 0x104e199, 0x104a197, 0x004c19e,
+  0x004f1a5, 0x00511ad, 0x00541b4, 0x00571bc, 0x10581c2, 0x105a1c5, 0x105c1c6, 0x10621c5,
+  0x10651c1, 0x10631bb, 0x105e1bb, 0x105a1bb, 0x10561bb, 0x104f1bb, 0x00531c1, 0x00571c8,
+  0x005c1cf, 0x00601d5, 0x00641dc, 0x00691e3, 0x10651e1, 0x10611df, 0x105c1df, 0x10551e0,
+  0x10501e2, 0x104c1e4, 0x004d1eb, 0x004f1f2, 0x00511f9, 0x10551fa, 0x10591fc, 0x105d1fe,
+  0x1062200, 0x105d202, 0x1059204, 0x1055205, 0x1051207, 0x0057204, 0x1057200, 0x10571fc,
+  0x005c202, 0x0061208, 0x006620e, 0x006b215, 0x1066218, 0x1061219, 0x105d21b, 0x105621a,
+  0x1051218, 0x104d216, 0x004c20e, 0x004b206, 0x004b1fe, 0x004a1f6, 0x004a1ee, 0x00491e6,
+  0x00491de, 0x00481d6, 0x00481ce, 0x00471c7, 0x00471bf, 0x00461b7, 0x00461af, 0x00451a7,
+  0x004519f, 0x0044197, 0x004418f, 0x0043187, 0x0043180, 0x0042178, 0x0041170, 0x0041168,
+  0x0040160, 0x0040158, 0x003f150, 0x003f148, 0x003e140, 0x003e138, 0x003d131, 0x003d129,
+  0x003c121, 0x003c119, 0x003b112, 0x003b10a, 0x003a102, 0x003a0fa, 0x00390f2, 0x00390ea,
+  0x10390f2, 0x10390fa, 0x1039101, 0x1039109, 0x1039111, 0x1039117, 0x103911f, 0x1039127,
+  0x103912e, 0x1039136, 0x103913e, 0x1039145, 0x103914c, 0x1039154, 0x103915b, 0x1039162,
+  0x103916a, 0x1039171, 0x1039179, 0x1039180, 0x1039187, 0x103918f, 0x1039196, 0x103919e,
+  0x10391a5, 0x10391ad, 0x10391b4, 0x10391bc, 0x10391c3, 0x10391cb, 0x10391d2, 0x10391da,
+  0x10391e1, 0x10391e9, 0x10391f0, 0x10391f8, 0x10391ff, 0x1039207, 0x103920f, 0x1039216,
+  0x103921e, 0x1039226, 0x003721e, 0x0035216, 0x003420e, 0x0032206, 0x00311fe, 0x002f1f6,
+  0x002d1ee, 0x002b1e6, 0x002a1de, 0x00281d6, 0x00261ce, 0x00241c6, 0x00231be, 0x00211b6,
+  0x001f1ae, 0x001d1a6, 0x001c19e, 0x001a196, 0x001818e, 0x0016186, 0x001517e, 0x0013176,
+  0x001116e, 0x000f166, 0x000d15f, 0x100d166, 0x100f169, 0x101216a, 0x1018168, 0x101b164,
+  0x101815e, 0x101415e, 0x101015e, 0x100c15e, 0x100515e, 0x000a164, 0x000f16b, 0x0014171,
+  0x0019178, 0x001d17f, 0x101917d, 0x101517b, 0x100f17a, 0x100917c, 0x100517e, 0x1000180,
+  0x0007185, 0x000e18a, 0x001518f, 0x001b194, 0x101b19a, 0x101a19d, 0x101819f, 0x101519f,
+  0x101119d, 0x0016198, 0x001b193, 0x1015193, 0x100f193, 0x1008193, 0x1008198, 0x100819d,
+  0x100c19e, 0x100f19e, 0x101119d, 0x1011199, 0x1011194, 0x001519a, 0x00181a1, 0x001c1a8,
+  0x001f1af, 0x101a1b2, 0x10161b3, 0x10111b5, 0x100a1b4, 0x10061b2, 0x10011b0, 0x00021a8,
+  0x00031a0, 0x0004198, 0x0005190, 0x0006188, 0x0007180, 0x0008178, 0x0008170, 0x0009168,
+  0x000a160, 0x000b158, 0x000c150, 0x000d148, 0x000e140, 0x000f138, 0x000f130, 0x0010128,
+  0x0011120, 0x0012118, 0x0013111, 0x0014109, 0x0015101, 0x00160f9, 0x00160f1, 0x00170e9,
+  0x00180e1, 0x00190d9, 0x001a0d1, 0x001b0c9, 0x001c0c1, 0x001c0b9, 0x001d0b1, 0x001e0a9,
+  0x001f0a1, 0x0020099, 0x0021091, 0x0022089, 0x0023081, 0x0023079, 0x0024071, 0x0025069,
+  0x0026061, 0x0027059, 0x0028051, 0x0029049, 0x002a041, 0x002a039, 0x002b031, 0x002c029,
+  0x002d021, 0x002e019, 0x002f011, 0x0030009, 0x0030001,
+};
+
+static constexpr uint32_t EQN_17_POINTS[383] = {
+  0x0014022, 0x1013027, 0x101302d, 0x1016030, 0x1018031, 0x101b02e, 0x101d029, 0x1020024,
+  0x1024026, 0x102602b, 0x1026030, 0x002402a, 0x0021023, 0x001f01c, 0x001c015, 0x001a00e,
+  0x0017007, 0x0014000, 0x1013005, 0x101200a, 0x101500f, 0x1018013, 0x101f015, 0x1025017,
+  0x102c017, 0x1033017, 0x103a017, 0x1040017, 0x1047017, 0x104d017, 0x1054017, 0x105b016,
+  0x1061017, 0x1067017, 0x106d017, 0x1073018, 0x1079019, 0x107f01a, 0x108401e, 0x1089022,
+  0x1088028, 0x108802e, 0x0080033, 0x0079038, 0x007103d, 0x006a041, 0x0062046, 0x005b04b,
+  0x005304f, 0x004c054, 0x0045059, 0x003d05d, 0x103d059, 0x103c055, 0x103c051, 0x103c04c,
+  0x104304c, 0x104a04c, 0x105004c, 0x105604c, 0x105a04c, 0x105e04c, 0x105e052, 0x105e058,
+  0x105e05e, 0x005805d, 0x005205c, 0x004c05b, 0x104c055, 0x104c051, 0x104c04d, 0x004c055,
+  0x004d05c, 0x004e063, 0x004e06b, 0x004f072, 0x0050079, 0x0051080, 0x104c083, 0x1048085,
+  0x1048080, 0x104807a, 0x104c07d, 0x1051080, 0x0053088, 0x0055090, 0x0057097, 0x005a09f,
+  0x005c0a6, 0x005e0ae, 0x00610b5, 0x105b0b5, 0x10550b5, 0x10500b5, 0x104a0b5, 0x10450b4,
+  0x10430b0, 0x10410ac, 0x10430a8, 0x10450a4, 0x104a0a3, 0x10500a2, 0x10570a9, 0x10570af,
+  0x10570b4, 0x00500b9, 0x00490be, 0x00420c2, 0x10420c6, 0x10410ca, 0x10410ce, 0x10410d2,
+  0x10440d7, 0x10480d7, 0x104c0d3, 0x104f0cc, 0x10550c5, 0x105b0c7, 0x105c0cb, 0x105e0cf,
+  0x105e0d6, 0x005a0dd, 0x00570e4, 0x00540eb, 0x00510f1, 0x10510f7, 0x10510fd, 0x1051103,
+  0x1051109, 0x004d103, 0x004a0fd, 0x00480f7, 0x00440f1, 0x10440f7, 0x10440fd, 0x1044103,
+  0x1044109, 0x004b111, 0x0052117, 0x005911e, 0x0061125, 0x006812c, 0x006f133, 0x007613a,
+  0x007e142, 0x1082147, 0x108714c, 0x108114c, 0x107c14c, 0x107714c, 0x107114c, 0x106b14c,
+  0x006b147, 0x006b142, 0x106b147, 0x106b14c, 0x106b150, 0x106b154, 0x006514c, 0x0060144,
+  0x005b13c, 0x0056134, 0x005112d, 0x1051134, 0x105113b, 0x1051142, 0x1051149, 0x1051150,
+  0x1051158, 0x105115f, 0x1051167, 0x0049163, 0x0043160, 0x003b15d, 0x0034159, 0x002d156,
+  0x0025153, 0x001e14f, 0x001714c, 0x000f149, 0x100e144, 0x100d13f, 0x100e13a, 0x1012136,
+  0x1018134, 0x101d137, 0x102013a, 0x102113e, 0x1021143, 0x1020149, 0x001d142, 0x001a13b,
+  0x0017135, 0x1017139, 0x101713d, 0x1017141, 0x1017145, 0x001714b, 0x0017152, 0x0016159,
+  0x101415e, 0x101015f, 0x100c161, 0x1008160, 0x100415f, 0x100115c, 0x1000158, 0x1001155,
+  0x1004153, 0x1008152, 0x100c151, 0x1013153, 0x1016158, 0x001815f, 0x001a167, 0x001c16f,
+  0x001e176, 0x002017e, 0x0022186, 0x002418d, 0x0026195, 0x002819d, 0x002a1a5, 0x10261a7,
+  0x10221a9, 0x101d1ab, 0x10181ad, 0x101d1af, 0x10221b1, 0x10261b3, 0x102a1b5, 0x00291ae,
+  0x00271a7, 0x00251a0, 0x0024199, 0x0022192, 0x002018b, 0x001e185, 0x101d18a, 0x101c18f,
+  0x101f194, 0x1022199, 0x102919a, 0x102f19c, 0x103619c, 0x103d19c, 0x104419c, 0x104a19c,
+  0x105019c, 0x105719c, 0x105e19c, 0x106519c, 0x106b19c, 0x107119c, 0x107719d, 0x107d19e,
+  0x108319f, 0x10891a0, 0x108e1a4, 0x10931a8, 0x10921ae, 0x10911b4, 0x00891b6, 0x00811b9,
+  0x00791bb, 0x00711be, 0x00691c1, 0x00611c3, 0x00591c6, 0x00511c8, 0x00491cb, 0x00421ce,
+  0x10411d2, 0x103f1d7, 0x10411db, 0x10431e0, 0x10491e2, 0x104f1e1, 0x10521dc, 0x10511d8,
+  0x10511d4, 0x104b1d0, 0x10461ce, 0x10411cc, 0x103d1ca, 0x10381c8, 0x003e1cf, 0x00431d7,
+  0x00491de, 0x004d1e6, 0x00521ee, 0x00581f5, 0x005d1fd, 0x0063205, 0x105d205, 0x1057205,
+  0x1052205, 0x104c204, 0x1047204, 0x1045200, 0x10431fc, 0x10461f8, 0x10481f4, 0x104d1f3,
+  0x10521f3, 0x10591f9, 0x10591fe, 0x1059204, 0x005a20b, 0x005c212, 0x1056214, 0x1051216,
+  0x104a218, 0x104321b, 0x104a21e, 0x1051221, 0x1056223, 0x105c226, 0x005a21e, 0x0059216,
+  0x005820e, 0x0057206, 0x00561fe, 0x00551f6, 0x00541ee, 0x00531e6, 0x00521de, 0x00501d6,
+  0x004f1ce, 0x004e1c6, 0x004d1be, 0x004c1b6, 0x004b1ae, 0x004a1a6, 0x004919f, 0x0049197,
+  0x004718f, 0x0046187, 0x004517f, 0x0044177, 0x004316f, 0x0042167, 0x004115f, 0x0040157,
+  0x003f14f, 0x003d147, 0x003c13f, 0x003b137, 0x003a12f, 0x0039127, 0x0038120, 0x0037118,
+  0x0036111, 0x0035109, 0x0034101, 0x00320f9, 0x00310f1, 0x00300e9, 0x002f0e1, 0x002e0d9,
+  0x002d0d1, 0x002c0c9, 0x002b0c1, 0x002a0b9, 0x00280b1, 0x00270a9, 0x00260a2, 0x002509a,
+  0x0024092, 0x002308a, 0x0022082, 0x002107a, 0x0020072, 0x001e06a, 0x001d062, 0x001c05a,
+  0x001b052, 0x001a04a, 0x0019042, 0x001803a, 0x0017032, 0x001602a, 0x0014022,
+};
+
+static constexpr uint32_t EQN_18_POINTS[296] = {
+  0x000203a, 0x100203e, 0x1001042, 0x1001047, 0x100104b, 0x1005051, 0x100a052, 0x100e04d,
+  0x1010049, 0x1011045, 0x1014041, 0x101703d, 0x101e03f, 0x1020044, 0x1021048, 0x102104c,
+  0x1021050, 0x001f049, 0x001c042, 0x001903b, 0x0017033, 0x001402c, 0x0011025, 0x000e01e,
+  0x000c016, 0x000900f, 0x0006008, 0x0003000, 0x1002006, 0x100100c, 0x1000011, 0x1004017,
+  0x100701c, 0x100a021, 0x1012023, 0x1019025, 0x1020027, 0x1028027, 0x102f027, 0x1037027,
+  0x103e027, 0x1046027, 0x104d026, 0x1055026, 0x105c026, 0x1063026, 0x106b026, 0x1072026,
+  0x107a026, 0x1081027, 0x1089027, 0x1090027, 0x1098027, 0x109f029, 0x10a702a, 0x10ae02b,
+  0x10b602c, 0x10bb031, 0x10c1036, 0x10c703a, 0x10c6041, 0x10c5048, 0x10c404e, 0x00bc056,
+  0x00b405d, 0x00ac064, 0x00a406c, 0x009d073, 0x009507a, 0x008d082, 0x0085089, 0x007e090,
+  0x107e098, 0x107e09f, 0x107c0a4, 0x107b0a8, 0x10770ab, 0x10730ae, 0x106c0b0, 0x10660ad,
+  0x10610a9, 0x00680a2, 0x006f09b, 0x0076094, 0x007e08c, 0x107708c, 0x107008c, 0x106908c,
+  0x106208c, 0x105b08c, 0x105408c, 0x104d08c, 0x104608c, 0x1046094, 0x104509b, 0x10460a2,
+  0x10460a8, 0x104c0ab, 0x10520ae, 0x10590ac, 0x105f0a8, 0x10600a3, 0x106009e, 0x1060099,
+  0x1060094, 0x106008e, 0x0061096, 0x006109e, 0x00620a6, 0x00620ae, 0x00630b6, 0x00630bd,
+  0x00630c5, 0x00640cd, 0x00640d5, 0x00650dd, 0x00650e5, 0x00660ec, 0x10610ef, 0x105b0f2,
+  0x10550f4, 0x10550ee, 0x10550e8, 0x10550e2, 0x105b0e5, 0x10600e8, 0x10650eb, 0x00670f3,
+  0x006a0fa, 0x006d102, 0x006f109, 0x0072110, 0x0075117, 0x007811e, 0x007a125, 0x007d12d,
+  0x0080134, 0x008213c, 0x107b13c, 0x107413c, 0x106d13c, 0x106613c, 0x106013b, 0x105a13b,
+  0x105413b, 0x1051134, 0x104e12e, 0x1052127, 0x1055120, 0x105b11f, 0x106111e, 0x106711d,
+  0x106c123, 0x1072129, 0x107212f, 0x1072135, 0x107313b, 0x006c140, 0x0065146, 0x005e14c,
+  0x0057152, 0x0050158, 0x104f15e, 0x104e165, 0x104f16c, 0x104f173, 0x1052177, 0x105417b,
+  0x105b17c, 0x105e178, 0x1061174, 0x106416f, 0x106716a, 0x106b163, 0x107015d, 0x107515e,
+  0x107a160, 0x107c167, 0x107f16e, 0x107f173, 0x107f179, 0x007c180, 0x007a187, 0x007718f,
+  0x0075196, 0x007219d, 0x00701a5, 0x10701ab, 0x10701b2, 0x10701b9, 0x10701bf, 0x10701c6,
+  0x10701cd, 0x006c1c6, 0x00681bf, 0x00651b9, 0x00621b2, 0x005e1ab, 0x005a1a5, 0x105a1ab,
+  0x105a1b2, 0x105a1b9, 0x105a1bf, 0x105a1c6, 0x105a1cd, 0x005f1d4, 0x00631dc, 0x00671e3,
+  0x006b1eb, 0x00701f2, 0x00741fa, 0x0079201, 0x007d209, 0x0082211, 0x107e218, 0x107b21f,
+  0x1074221, 0x106e223, 0x1068226, 0x1062224, 0x105b222, 0x1054221, 0x105021d, 0x104c219,
+  0x104b214, 0x104920f, 0x104b20b, 0x104d207, 0x1054201, 0x105b200, 0x10621ff, 0x10681fe,
+  0x106e1ff, 0x1074201, 0x107b203, 0x107e209, 0x1082210, 0x007f208, 0x007d200, 0x007b1f8,
+  0x00791f0, 0x00771e8, 0x00741e0, 0x00721d8, 0x00701d0, 0x006e1c8, 0x006c1c0, 0x006a1b8,
+  0x00671b0, 0x00651a8, 0x00631a0, 0x0062198, 0x0060190, 0x005e188, 0x005b180, 0x0059178,
+  0x0057170, 0x0055168, 0x0053160, 0x0051158, 0x004e150, 0x004c148, 0x004a140, 0x0048138,
+  0x0046130, 0x0044128, 0x0041121, 0x003f119, 0x003d112, 0x003b10a, 0x0039102, 0x00370fa,
+  0x00340f2, 0x00320ea, 0x00300e2, 0x002e0da, 0x002c0d2, 0x002a0ca, 0x00270c2, 0x00250ba,
+  0x00230b2, 0x00210aa, 0x001f0a2, 0x001d09a, 0x001a092, 0x001808a, 0x0016082, 0x001407a,
+  0x0012072, 0x001006a, 0x000d062, 0x000b05a, 0x0009052, 0x000704a, 0x0005042, 0x000203a,
+};
+
+static constexpr uint32_t EQN_19_POINTS[375] = {
+  0x0013020, 0x100f020, 0x100a020, 0x1006020, 0x1001020, 0x1001026, 0x100002c, 0x0001025,
+  0x000201e, 0x0003016, 0x000400f, 0x0005008, 0x0006000, 0x1005005, 0x1004009, 0x100700e,
+  0x100a012, 0x1010014, 0x1015015, 0x101c015, 0x1022015, 0x1029015, 0x102f015, 0x1035015,
+  0x103b015, 0x1041015, 0x1047015, 0x104c015, 0x1052015, 0x1058015, 0x105d016, 0x1063017,
+  0x1069018, 0x106d01c, 0x1072020, 0x1071026, 0x107102b, 0x006902f, 0x0061033, 0x0059037,
+  0x005103b, 0x004903f, 0x0041043, 0x003a047, 0x003204a, 0x1032043, 0x103203f, 0x103203b,
+  0x103803b, 0x103e03b, 0x104403b, 0x104a03b, 0x105103b, 0x1051040, 0x1051045, 0x105104b,
+  0x004b04a, 0x0046049, 0x0041048, 0x1041043, 0x104103c, 0x0040044, 0x004004c, 0x0040053,
+  0x004005b, 0x0040062, 0x004006a, 0x0040071, 0x103b074, 0x1037076, 0x1037071, 0x103706c,
+  0x103b06f, 0x1040071, 0x0042079, 0x0045081, 0x0047088, 0x004a090, 0x004c098, 0x004f09f,
+  0x104909f, 0x104409f, 0x103f09f, 0x103a09f, 0x103509e, 0x1032097, 0x1034093, 0x103608f,
+  0x103b08f, 0x104008e, 0x1046094, 0x1046099, 0x104609e, 0x00480a4, 0x004b0aa, 0x004e0b0,
+  0x10470b0, 0x10410b0, 0x103b0b0, 0x10340b0, 0x10340b7, 0x10340be, 0x00380c6, 0x003b0ce,
+  0x003d0d6, 0x00410dd, 0x10410e3, 0x10410e9, 0x10410ef, 0x10410f4, 0x003d0ed, 0x00390e5,
+  0x00350dd, 0x10350e3, 0x10350e9, 0x10350ef, 0x10350f4, 0x003b0fc, 0x0042103, 0x004910a,
+  0x004f111, 0x0056118, 0x005d11f, 0x0063126, 0x006a12d, 0x0071135, 0x106b135, 0x1065135,
+  0x1060135, 0x105b134, 0x1056134, 0x105312d, 0x1055129, 0x1057125, 0x105c124, 0x1061124,
+  0x106712a, 0x106712f, 0x1067134, 0x005f12c, 0x0057125, 0x005011d, 0x0048116, 0x004110f,
+  0x1041116, 0x104111d, 0x1041124, 0x104112b, 0x1041132, 0x104113a, 0x1041142, 0x104114a,
+  0x003b143, 0x003413c, 0x002d135, 0x002612e, 0x001f127, 0x101a127, 0x1015127, 0x100f127,
+  0x100a126, 0x1005126, 0x100211f, 0x100411b, 0x1006117, 0x100b116, 0x1010116, 0x101611c,
+  0x1016121, 0x1016126, 0x001912c, 0x001c133, 0x001e13a, 0x101713a, 0x101013a, 0x100c13a,
+  0x100713a, 0x100413d, 0x1004144, 0x000b13d, 0x0012136, 0x0018130, 0x1018136, 0x101813c,
+  0x1018141, 0x1018146, 0x001714d, 0x0015154, 0x001415b, 0x0012162, 0x0011169, 0x000f170,
+  0x000e177, 0x000c17e, 0x000a186, 0x100918a, 0x100a18f, 0x100c193, 0x100e193, 0x1010190,
+  0x101218c, 0x1016188, 0x1019189, 0x101b18e, 0x101b192, 0x001918a, 0x0016183, 0x001317b,
+  0x0010174, 0x000d16c, 0x000a165, 0x100a16a, 0x100916f, 0x100c173, 0x100e178, 0x1014179,
+  0x101a17b, 0x102117b, 0x102717b, 0x102d17b, 0x103317b, 0x103a17b, 0x103f17b, 0x104517b,
+  0x104c17b, 0x105117b, 0x105717b, 0x105d17b, 0x106217c, 0x106817d, 0x106e17e, 0x1072182,
+  0x1077186, 0x107618b, 0x1075191, 0x006e194, 0x0067198, 0x006119b, 0x005a19f, 0x00531a2,
+  0x004d1a6, 0x104d1aa, 0x104d1af, 0x104b1b4, 0x10471b7, 0x10431b8, 0x103d1b4, 0x00421ae,
+  0x00471a9, 0x004d1a4, 0x10451a4, 0x103d1a4, 0x10361a4, 0x102e1a4, 0x102e1a8, 0x102d1ac,
+  0x102e1b0, 0x102e1b4, 0x10341b7, 0x10381b6, 0x103c1b4, 0x103c1ae, 0x103c1a9, 0x103c1a5,
+  0x003c1ac, 0x003c1b4, 0x003d1bc, 0x003d1c4, 0x003d1cc, 0x003e1d4, 0x103a1d6, 0x10351d8,
+  0x10351d3, 0x10351ce, 0x103a1d0, 0x103e1d3, 0x00401da, 0x00431e2, 0x00451e9, 0x00481f1,
+  0x004a1f8, 0x004d200, 0x1047200, 0x1042200, 0x103d200, 0x1038200, 0x1033200, 0x10321fc,
+  0x10301f8, 0x10321f4, 0x10341f0, 0x10391ef, 0x103e1ef, 0x10441f6, 0x10441fb, 0x1044200,
+  0x003e206, 0x003a20c, 0x0034212, 0x1033219, 0x1033220, 0x1036225, 0x103a226, 0x103e221,
+  0x104121b, 0x1046214, 0x104b216, 0x104c21a, 0x104e21e, 0x104e224, 0x004d21c, 0x004c214,
+  0x004b20c, 0x004a204, 0x00491fc, 0x00481f4, 0x00471ec, 0x00461e4, 0x00451dc, 0x00441d4,
+  0x00441cc, 0x00431c4, 0x00421bc, 0x00411b4, 0x00401ac, 0x003f1a4, 0x003e19d, 0x003d195,
+  0x003c18d, 0x003b185, 0x003b17d, 0x003b175, 0x003a16d, 0x0039165, 0x003815d, 0x0037155,
+  0x003614d, 0x0035145, 0x003413d, 0x0033135, 0x003212d, 0x0031125, 0x003111e, 0x0030116,
+  0x002f10f, 0x002e107, 0x002d0ff, 0x002c0f7, 0x002b0ef, 0x002a0e7, 0x00290df, 0x00280d7,
+  0x00270cf, 0x00270c7, 0x00260bf, 0x00250b7, 0x00240af, 0x00230a7, 0x00220a0, 0x0021098,
+  0x0020090, 0x001f088, 0x001e080, 0x001d078, 0x001d070, 0x001c068, 0x001b060, 0x001a058,
+  0x0019050, 0x0018048, 0x0017040, 0x0016038, 0x0015030, 0x0014028, 0x0013020,
+};
+
+static constexpr uint32_t EQN_20_POINTS[427] = {
+  0x000e011, 0x1009011, 0x1004011, 0x1004014, 0x1004018, 0x0005012, 0x000600c, 0x0007006,
+  0x0007000, 0x1006005, 0x100900a, 0x101000b, 0x101700b, 0x101d00b, 0x102400b, 0x102b00b,
+  0x102f00b, 0x103400b, 0x103800c, 0x103d00d, 0x1042011, 0x1041017, 0x003a01b, 0x003401e,
+  0x002e021, 0x0028024, 0x1028028, 0x102702b, 0x102502d, 0x102202d, 0x101f02c, 0x0023028,
+  0x0028023, 0x1022023, 0x101d023, 0x1017023, 0x1017027, 0x101702b, 0x101a02d, 0x101d02c,
+  0x101e02b, 0x101f028, 0x101f023, 0x002002a, 0x0020031, 0x0020038, 0x002003e, 0x101b040,
+  0x101b03b, 0x102003d, 0x0022044, 0x002404b, 0x0026052, 0x0029058, 0x1024058, 0x1020058,
+  0x101b058, 0x1019054, 0x101b050, 0x102104f, 0x1024053, 0x1024058, 0x002605d, 0x0028061,
+  0x1021061, 0x101a061, 0x101a065, 0x101a069, 0x001e070, 0x0022077, 0x102207d, 0x1022083,
+  0x001f07d, 0x001b077, 0x101b07d, 0x101b083, 0x001e089, 0x002108f, 0x0023095, 0x101f094,
+  0x101b093, 0x1019093, 0x1019097, 0x101a09b, 0x101e09d, 0x102309e, 0x001f09d, 0x001b09b,
+  0x101909e, 0x001a0a3, 0x001a0a7, 0x10180a9, 0x10150ab, 0x10110aa, 0x100f0a8, 0x100f0a6,
+  0x100f0a5, 0x10110a4, 0x10150a3, 0x10180a4, 0x101a0a6, 0x00210ad, 0x00280b3, 0x00300b9,
+  0x00370bf, 0x003f0c5, 0x10390c3, 0x10340c0, 0x102d0c0, 0x10270c0, 0x10210c0, 0x101c0bf,
+  0x10150c0, 0x100d0c0, 0x10070c3, 0x10000c5, 0x00020cc, 0x00040d3, 0x00060da, 0x00070e0,
+  0x10060e3, 0x10060e5, 0x10070e7, 0x10090e7, 0x100a0e6, 0x100b0e4, 0x100d0e1, 0x100f0e2,
+  0x10100e4, 0x10100e7, 0x000e0e1, 0x000c0db, 0x000a0d5, 0x00070cf, 0x10060d4, 0x10090d9,
+  0x100f0da, 0x10160da, 0x101d0da, 0x10230da, 0x102a0da, 0x102e0da, 0x10330da, 0x10380db,
+  0x103d0dc, 0x10420e0, 0x10410e6, 0x003b0e8, 0x00350e9, 0x002f0eb, 0x00290ec, 0x10290f0,
+  0x10290f4, 0x10220f4, 0x101e0f4, 0x101b0f3, 0x101a0f0, 0x101b0ec, 0x001d0f3, 0x001e0f9,
+  0x00200ff, 0x0021105, 0x101c108, 0x101c102, 0x1021105, 0x002310c, 0x0025113, 0x0027119,
+  0x0029120, 0x1024120, 0x1020120, 0x101b120, 0x101911c, 0x101b117, 0x1021117, 0x102411a,
+  0x1024120, 0x001f123, 0x001a127, 0x101912b, 0x101a12f, 0x101b131, 0x101d132, 0x101f12f,
+  0x102112c, 0x1024128, 0x1027129, 0x102812d, 0x1028131, 0x0026138, 0x002513f, 0x0024146,
+  0x101f146, 0x101c146, 0x0020140, 0x1020145, 0x102014b, 0x0020152, 0x001f159, 0x001e160,
+  0x001d168, 0x101c163, 0x101d160, 0x101e15e, 0x102115d, 0x102415e, 0x1026160, 0x1026162,
+  0x1025167, 0x0023162, 0x002115d, 0x1021161, 0x1021165, 0x002116a, 0x002116f, 0x101f172,
+  0x101b173, 0x1017172, 0x1016171, 0x101516f, 0x101616d, 0x101716c, 0x101b16c, 0x101f16d,
+  0x102116f, 0x0025175, 0x002a17c, 0x002f183, 0x0033189, 0x0038190, 0x003d197, 0x1038197,
+  0x1034197, 0x102f197, 0x102d193, 0x102f18f, 0x103518e, 0x1038192, 0x1038197, 0x0030190,
+  0x0029189, 0x0022183, 0x102218a, 0x1022192, 0x1022197, 0x102219c, 0x10221a2, 0x001c19b,
+  0x0016194, 0x001018e, 0x100c18e, 0x100818e, 0x100218d, 0x1000189, 0x1002185, 0x1008185,
+  0x100b188, 0x100b18d, 0x000d193, 0x000f199, 0x100b199, 0x1007199, 0x100219a, 0x100119b,
+  0x100119f, 0x0007199, 0x000c194, 0x100c19a, 0x100c1a0, 0x000a1a7, 0x00081ae, 0x00061b5,
+  0x00041bc, 0x00011c4, 0x10011c6, 0x10011c9, 0x10021cb, 0x10041cb, 0x10051c9, 0x10061c7,
+  0x10081c5, 0x100a1c5, 0x100b1c8, 0x100b1ca, 0x00091c4, 0x00071be, 0x00051b8, 0x00021b2,
+  0x10011b7, 0x10041bc, 0x100a1be, 0x10111be, 0x10181be, 0x101f1be, 0x10251be, 0x10291be,
+  0x102e1be, 0x10321bf, 0x10371c0, 0x103d1c4, 0x103c1ca, 0x00341cd, 0x002d1d1, 0x00261d4,
+  0x00201d8, 0x00181dc, 0x10181d8, 0x10181d4, 0x101f1d4, 0x10251d4, 0x10291d4, 0x10291d9,
+  0x10291dd, 0x00241dc, 0x00201db, 0x10201d8, 0x10201d4, 0x00211da, 0x00211e1, 0x00211e7,
+  0x00211ee, 0x101c1f0, 0x101c1eb, 0x10211ed, 0x00231f3, 0x00251fa, 0x0027200, 0x002a207,
+  0x1025207, 0x1021207, 0x101c207, 0x101a203, 0x101c1fe, 0x10221fe, 0x1025201, 0x1025207,
+  0x002020b, 0x001b20f, 0x101b213, 0x101b217, 0x101c219, 0x101e219, 0x1020217, 0x1022214,
+  0x1025210, 0x1028211, 0x1029215, 0x1029219, 0x003021b, 0x003721d, 0x003f220, 0x1039221,
+  0x1034223, 0x102f225, 0x1027225, 0x1020225, 0x1018226, 0x1012225, 0x100c225, 0x1006222,
+  0x1000220, 0x0001218, 0x0001210, 0x0001208, 0x0001200, 0x00021f8, 0x00021f0, 0x00021e8,
+  0x00021e0, 0x00021d8, 0x00031d0, 0x00031c8, 0x00031c0, 0x00031b8, 0x00031b0, 0x00041a8,
+  0x00041a0, 0x0004198, 0x0004190, 0x0005188, 0x0005180, 0x0005178, 0x0005170, 0x0005168,
+  0x0006160, 0x0006158, 0x0006150, 0x0006148, 0x0006140, 0x0007138, 0x0007130, 0x0007128,
+  0x0007120, 0x0007118, 0x0008111, 0x0008109, 0x0008101, 0x00080f9, 0x00090f1, 0x00090e9,
+  0x00090e1, 0x00090d9, 0x00090d1, 0x000a0c9, 0x000a0c1, 0x000a0b9, 0x000a0b1, 0x000a0a9,
+  0x000b0a1, 0x000b099, 0x000b091, 0x000b089, 0x000c081, 0x000c079, 0x000c071, 0x000c069,
+  0x000c061, 0x000d059, 0x000d051, 0x000d049, 0x000d041, 0x000d039, 0x000e031, 0x000e029,
+  0x000e021, 0x000e019, 0x000e011,
+};
+
+static constexpr uint32_t EQN_21_POINTS[301] = {
+  0x0052017, 0x1059015, 0x105f012, 0x1065010, 0x106b00d, 0x107100b, 0x1077008, 0x107e006,
+  0x1084003, 0x108b000, 0x108b008, 0x108b00f, 0x108b016, 0x108b01d, 0x108b023, 0x108b02a,
+  0x108b030, 0x108302d, 0x107b02a, 0x1073027, 0x106c024, 0x1066022, 0x105f01f, 0x105801c,
+  0x1051019, 0x0054021, 0x0056029, 0x0059030, 0x005b038, 0x005d03f, 0x0060047, 0x006204e,
+  0x0064056, 0x006705e, 0x0069065, 0x006a06d, 0x006d074, 0x006f07c, 0x0072083, 0x106c087,
+  0x106608a, 0x106008d, 0x1060087, 0x1060080, 0x1060079, 0x106607d, 0x106c080, 0x1072083,
+  0x006f08b, 0x006d093, 0x006b09a, 0x00690a2, 0x00670a9, 0x00650b1, 0x00620b8, 0x00600c0,
+  0x005e0c8, 0x005c0cf, 0x00590d7, 0x00570de, 0x00550e6, 0x00520ed, 0x10520e8, 0x10520e3,
+  0x10520dd, 0x10520d6, 0x10520ce, 0x10590ce, 0x105f0ce, 0x10650ce, 0x106b0ce, 0x10720ce,
+  0x107a0ce, 0x10820ce, 0x10890ce, 0x10910ce, 0x10910d5, 0x10910dc, 0x10910e3, 0x10910e9,
+  0x10910ee, 0x008a0ed, 0x00830ec, 0x007d0eb, 0x00760ea, 0x00700e9, 0x106f0e4, 0x106f0de,
+  0x106f0d7, 0x106f0cf, 0x006f0d7, 0x006f0df, 0x00700e6, 0x00700ee, 0x00710f5, 0x00710fd,
+  0x0072104, 0x007210c, 0x0073113, 0x007311a, 0x0074121, 0x0074129, 0x0075131, 0x1075138,
+  0x1075140, 0x1075148, 0x107514f, 0x1075156, 0x107515e, 0x0070156, 0x006c14f, 0x0069147,
+  0x0065140, 0x0061138, 0x005c131, 0x105c138, 0x105c140, 0x105c148, 0x105c14f, 0x105c156,
+  0x105c15e, 0x0062165, 0x006816d, 0x006e174, 0x007417c, 0x007a183, 0x008018b, 0x0086192,
+  0x008c19a, 0x00921a1, 0x00981a9, 0x009e1b0, 0x00a41b8, 0x00aa1bf, 0x00b01c7, 0x00b61cf,
+  0x10b41d4, 0x10b21da, 0x10b11e0, 0x10b31e5, 0x10b51ea, 0x10b81f0, 0x10be1f2, 0x10c41f5,
+  0x10c91f3, 0x10cf1f2, 0x10d21ed, 0x10d51e9, 0x10d41e1, 0x10d31da, 0x10cd1d6, 0x10c81d2,
+  0x10c21cf, 0x10bc1cd, 0x10b61cb, 0x10b01c8, 0x10aa1c5, 0x10a41c3, 0x009d1be, 0x00961ba,
+  0x008f1b5, 0x00881b1, 0x00811ac, 0x007a1a8, 0x107a1af, 0x107a1b6, 0x107a1bd, 0x107a1c4,
+  0x107a1cb, 0x107a1d2, 0x107a1d9, 0x107a1e1, 0x107a1e8, 0x107a1f0, 0x107a1f8, 0x107a1ff,
+  0x107a207, 0x107a20f, 0x107a216, 0x107a21e, 0x107a226, 0x0072220, 0x006a21b, 0x0063216,
+  0x005b210, 0x005420b, 0x004c206, 0x0044200, 0x003c1fb, 0x00351f6, 0x002d1f0, 0x00251eb,
+  0x001d1e6, 0x101c1df, 0x101b1d9, 0x10191d3, 0x101a1ce, 0x101b1c9, 0x10211c2, 0x10281c0,
+  0x102e1be, 0x10331c0, 0x10371c3, 0x103d1ca, 0x103e1ce, 0x103f1d2, 0x103e1d8, 0x103d1df,
+  0x103c1e6, 0x00391de, 0x00361d6, 0x00331cf, 0x00301c7, 0x002c1c0, 0x102c1c7, 0x102c1cf,
+  0x102c1d6, 0x102c1de, 0x002c1e5, 0x002c1ec, 0x002b1f4, 0x002b1fb, 0x002a203, 0x1028208,
+  0x102520e, 0x101e210, 0x1017212, 0x1010210, 0x100820f, 0x1002209, 0x1000202, 0x10031fc,
+  0x10081f8, 0x10101f6, 0x10171f5, 0x101e1f7, 0x10251f9, 0x10281fe, 0x102a203, 0x002b1fb,
+  0x002c1f3, 0x002c1eb, 0x002d1e3, 0x002e1db, 0x002e1d3, 0x002f1cb, 0x00301c3, 0x00301bb,
+  0x00311b3, 0x00321ab, 0x00321a3, 0x003319b, 0x0034193, 0x003418b, 0x0035184, 0x003517c,
+  0x0036174, 0x003716c, 0x0037164, 0x003815c, 0x0039154, 0x003914c, 0x003a144, 0x003b13c,
+  0x003b134, 0x003c12c, 0x003d124, 0x003d11c, 0x003e114, 0x003e10d, 0x003f106, 0x00400fe,
+  0x00400f6, 0x00410ee, 0x00420e6, 0x00420de, 0x00430d6, 0x00440ce, 0x00440c6, 0x00450be,
+  0x00460b6, 0x00460ae, 0x00470a6, 0x004809e, 0x0048096, 0x004908f, 0x0049087, 0x004a07f,
+  0x004b077, 0x004b06f, 0x004c067, 0x004d05f, 0x004d057, 0x004e04f, 0x004f047, 0x004f03f,
+  0x0050037, 0x005102f, 0x0051027, 0x005201f, 0x0052017,
+};
+
+static constexpr uint32_t EQN_22_POINTS[258] = {
+  0x000601d, 0x100e01a, 0x1016017, 0x101e014, 0x1025010, 0x102b00e, 0x103200b, 0x1039008,
+  0x1040006, 0x1047003, 0x104e000, 0x104e007, 0x104e00e, 0x104e015, 0x104e01c, 0x104e023,
+  0x104e029, 0x104e030, 0x104e036, 0x104e03c, 0x104703a, 0x1040037, 0x103a035, 0x1033032,
+  0x102c030, 0x102602d, 0x102002b, 0x1019028, 0x1013026, 0x100c023, 0x1005020, 0x0009028,
+  0x000c030, 0x000f038, 0x0012040, 0x0015048, 0x001904f, 0x001c057, 0x001f05f, 0x0022067,
+  0x002506f, 0x0028076, 0x002b07e, 0x002e086, 0x003108e, 0x0034096, 0x003809d, 0x10300a1,
+  0x10280a5, 0x10210a9, 0x10210a3, 0x102109c, 0x1021096, 0x102108f, 0x1028094, 0x1030098,
+  0x103809c, 0x003a0a4, 0x003c0ab, 0x003f0b3, 0x00410ba, 0x00440c1, 0x00460c9, 0x00480d0,
+  0x004b0d8, 0x004d0df, 0x00500e6, 0x10500ee, 0x10500f5, 0x10510fc, 0x104f103, 0x104d109,
+  0x104710e, 0x1042112, 0x103d113, 0x1038114, 0x1032111, 0x102c10e, 0x102710a, 0x002e104,
+  0x00350fd, 0x003c0f6, 0x00430ef, 0x004a0e8, 0x00510e1, 0x10490e1, 0x10420e1, 0x103b0e1,
+  0x10330e1, 0x102c0e1, 0x10260e1, 0x101f0e1, 0x10170e1, 0x10100e1, 0x10090e1, 0x10010e1,
+  0x10010e8, 0x10010ef, 0x10000f6, 0x10010fd, 0x1002103, 0x1002109, 0x100810c, 0x100d10f,
+  0x1012111, 0x1017110, 0x101c10e, 0x102110c, 0x1025109, 0x1026102, 0x10270fa, 0x10270f3,
+  0x10270eb, 0x10260e3, 0x00280eb, 0x00280f3, 0x00290fa, 0x002a102, 0x002b109, 0x002c111,
+  0x002d118, 0x002e11f, 0x002f127, 0x003012e, 0x0031136, 0x003213e, 0x0033145, 0x003414d,
+  0x0035154, 0x003615c, 0x0038164, 0x103816b, 0x1038172, 0x1038179, 0x1038181, 0x1038188,
+  0x103818f, 0x1038196, 0x103819d, 0x0034196, 0x003018f, 0x002c188, 0x0028181, 0x002517a,
+  0x0021173, 0x001d16c, 0x0019165, 0x101916c, 0x1019173, 0x101917a, 0x1019181, 0x1019188,
+  0x101918f, 0x1019196, 0x101919d, 0x001d1a4, 0x00211ac, 0x00251b3, 0x00281bb, 0x002c1c2,
+  0x00301ca, 0x00341d1, 0x00381d9, 0x003c1e0, 0x00401e8, 0x00441ef, 0x00481f7, 0x004c1fe,
+  0x0050206, 0x104d20d, 0x104a215, 0x104721d, 0x103f21f, 0x1037221, 0x102f223, 0x1028226,
+  0x1022224, 0x101c222, 0x1015221, 0x1011219, 0x100c212, 0x100720b, 0x100b204, 0x100e1fe,
+  0x10111f7, 0x10141f1, 0x101c1ee, 0x10231ec, 0x102a1ea, 0x10311ec, 0x10381ee, 0x103f1f0,
+  0x10471f3, 0x104a1f9, 0x104d1ff, 0x1050205, 0x004e1fd, 0x004d1f5, 0x004c1ed, 0x004b1e5,
+  0x004a1dd, 0x00481d5, 0x00471cd, 0x00461c6, 0x00451be, 0x00441b6, 0x00421ae, 0x00411a6,
+  0x004019e, 0x003f196, 0x003e18e, 0x003c187, 0x003b17f, 0x003a177, 0x003916f, 0x0038167,
+  0x003615f, 0x0035157, 0x003414f, 0x0033148, 0x0032140, 0x0030138, 0x002f130, 0x002e128,
+  0x002d120, 0x002c118, 0x002b111, 0x002910a, 0x0028102, 0x00280fa, 0x00270f2, 0x00260ea,
+  0x00240e2, 0x00230da, 0x00220d3, 0x00210cb, 0x00200c3, 0x001e0bb, 0x001d0b3, 0x001c0ab,
+  0x001b0a3, 0x001a09b, 0x0018094, 0x001708c, 0x0016084, 0x001507c, 0x0014074, 0x001206c,
+  0x0011064, 0x001005c, 0x000f055, 0x000e04d, 0x000c045, 0x000b03d, 0x000a035, 0x000902d,
+  0x0008025, 0x000601d,
+};
+
+static constexpr uint32_t EQN_23_POINTS[343] = {
+  0x003d014, 0x1045011, 0x104c00e, 0x105300b, 0x105a009, 0x1061006, 0x1068003, 0x106f000,
+  0x106f007, 0x106f00d, 0x106f013, 0x106f01b, 0x106f023, 0x106f02a, 0x1068028, 0x1062025,
+  0x105b022, 0x105401f, 0x104d01c, 0x1045019, 0x103d016, 0x004201e, 0x0046026, 0x004a02d,
+  0x004e035, 0x005203c, 0x0056044, 0x005a04b, 0x005e053, 0x006205a, 0x105e05f, 0x1059063,
+  0x1054068, 0x104f06d, 0x1049072, 0x0050072, 0x0056072, 0x005c072, 0x0062071, 0x105e06d,
+  0x1059069, 0x1054064, 0x104f05f, 0x104905a, 0x0049062, 0x004806a, 0x0047071, 0x0046079,
+  0x0045081, 0x0044088, 0x0043090, 0x0042098, 0x004109f, 0x00400a7, 0x003f0af, 0x003e0b6,
+  0x003d0be, 0x003c0c5, 0x103c0be, 0x103b0b7, 0x103b0b0, 0x103b0a9, 0x10430a9, 0x104a0a9,
+  0x10510a9, 0x10580aa, 0x105f0aa, 0x10660aa, 0x106c0aa, 0x10720aa, 0x10720b0, 0x10720b6,
+  0x10730bc, 0x10730c1, 0x10730c6, 0x006b0c5, 0x00640c4, 0x005d0c3, 0x00550c1, 0x10550bc,
+  0x10550b7, 0x10550b1, 0x10550ab, 0x00560b3, 0x00570bb, 0x00580c3, 0x00590cb, 0x005a0d2,
+  0x005b0da, 0x005c0e2, 0x005d0ea, 0x005e0f2, 0x005f0f9, 0x105f100, 0x105f107, 0x105f10d,
+  0x105f113, 0x105f119, 0x105f120, 0x005b118, 0x0057111, 0x0053109, 0x004f101, 0x004a0f9,
+  0x104a100, 0x104a107, 0x104a10d, 0x104a113, 0x104a119, 0x104a120, 0x004c127, 0x004d12e,
+  0x004e135, 0x004f13d, 0x0050144, 0x005214b, 0x0053153, 0x005415a, 0x0055161, 0x0056169,
+  0x1056170, 0x1056177, 0x105617e, 0x1056185, 0x005e18b, 0x0066191, 0x006d197, 0x007519d,
+  0x007d1a3, 0x00851a9, 0x008d1af, 0x00941b5, 0x009c1bb, 0x00a41c1, 0x00ac1c7, 0x00b41cd,
+  0x00bc1d3, 0x00c41d9, 0x00cc1df, 0x10c41df, 0x10bd1df, 0x10b61df, 0x10af1e0, 0x10a91df,
+  0x10a31de, 0x109e1de, 0x109b1d7, 0x10981d1, 0x109b1ca, 0x109f1c3, 0x10a41c2, 0x10aa1c1,
+  0x10b01c1, 0x10b51c7, 0x10bb1cd, 0x10bb1d2, 0x10bb1d8, 0x10bc1de, 0x00c01e5, 0x00c51ed,
+  0x00c91f4, 0x00ce1fc, 0x10ce201, 0x10ce206, 0x10ce20c, 0x10cc210, 0x10cb215, 0x10c421b,
+  0x10c021b, 0x10bc21c, 0x10b6219, 0x10b1216, 0x00b820e, 0x00bf207, 0x00c6200, 0x00ce1f9,
+  0x10c61f9, 0x10be1f9, 0x10b61f9, 0x10ae1f9, 0x10a61f9, 0x109e1f9, 0x10971f9, 0x1096200,
+  0x1096208, 0x109620e, 0x1097215, 0x109c217, 0x10a221a, 0x10a6219, 0x10aa218, 0x10b0215,
+  0x10b020f, 0x10b120a, 0x10b0202, 0x10b01fb, 0x00a81f3, 0x00a01ec, 0x00991e5, 0x00911dd,
+  0x008a1d6, 0x00821cf, 0x007a1c7, 0x00731c0, 0x006b1b9, 0x00641b2, 0x10641b9, 0x10641c0,
+  0x10641c8, 0x10641cf, 0x10641d7, 0x10641de, 0x10641e6, 0x10641ed, 0x10641f4, 0x10641fb,
+  0x1064202, 0x1064209, 0x1064210, 0x1064217, 0x106421e, 0x1064226, 0x006021e, 0x005c217,
+  0x005820f, 0x0053208, 0x004f201, 0x004b1f9, 0x00471f2, 0x00421eb, 0x003e1e3, 0x003a1dc,
+  0x00351d5, 0x102e1d5, 0x10271d5, 0x10201d5, 0x10181d5, 0x10121d4, 0x100c1d3, 0x10061d3,
+  0x10031cc, 0x10001c6, 0x10041bf, 0x10071b8, 0x100d1b7, 0x10131b6, 0x10191b6, 0x101e1bc,
+  0x10231c2, 0x10241c7, 0x10241cd, 0x10241d3, 0x00261d9, 0x00281e0, 0x002a1e7, 0x002c1ed,
+  0x002e1f4, 0x00301fb, 0x102a1fa, 0x10231fa, 0x101d1fa, 0x10161fa, 0x10111fa, 0x100c1fa,
+  0x10061fb, 0x1002200, 0x1002206, 0x100120d, 0x0009205, 0x00101fe, 0x00171f7, 0x001e1f0,
+  0x00251e9, 0x10251f0, 0x10251f7, 0x10251fe, 0x1025203, 0x1025209, 0x102520f, 0x0026207,
+  0x00261ff, 0x00271f7, 0x00271ef, 0x00271e7, 0x00281df, 0x00281d7, 0x00281cf, 0x00291c7,
+  0x00291bf, 0x002a1b7, 0x002a1af, 0x002a1a8, 0x002b1a0, 0x002b198, 0x002b190, 0x002c188,
+  0x002c180, 0x002d178, 0x002d170, 0x002d168, 0x002e160, 0x002e158, 0x002e150, 0x002f148,
+  0x002f141, 0x0030139, 0x0030131, 0x0030129, 0x0031121, 0x0031119, 0x0031112, 0x003210a,
+  0x0032102, 0x00330fa, 0x00330f2, 0x00330ea, 0x00340e2, 0x00340db, 0x00340d3, 0x00350cb,
+  0x00350c3, 0x00360bb, 0x00360b3, 0x00360ab, 0x00370a3, 0x003709b, 0x0037093, 0x003808b,
+  0x0038083, 0x003907b, 0x0039074, 0x003906c, 0x003a064, 0x003a05c, 0x003a054, 0x003b04c,
+  0x003b044, 0x003c03c, 0x003c034, 0x003c02c, 0x003d024, 0x003d01c, 0x003d014,
+};
+
+static constexpr uint32_t EQN_24_POINTS[372] = {
+  0x003000a, 0x1036008, 0x103b005, 0x1042003, 0x104a000, 0x104a005, 0x104a00a, 0x104a010,
+  0x104a015, 0x1043013, 0x103c010, 0x103600e, 0x102f00b, 0x0033013, 0x003701b, 0x003b023,
+  0x003f02b, 0x0043032, 0x103e037, 0x103a03b, 0x103603f, 0x003c03f, 0x004303e, 0x103e03a,
+  0x103a036, 0x1036032, 0x003a039, 0x003c040, 0x0040047, 0x004304e, 0x0046055, 0x004a05c,
+  0x104a060, 0x104a064, 0x1049068, 0x104506b, 0x104106c, 0x103b069, 0x0042062, 0x004a05a,
+  0x104205a, 0x103b05a, 0x103505a, 0x102d05a, 0x102d061, 0x102e068, 0x103306b, 0x103706a,
+  0x103a068, 0x103b063, 0x103b05f, 0x103b05b, 0x003c063, 0x003d06a, 0x003e071, 0x003f078,
+  0x0040080, 0x0041087, 0x004208e, 0x0043095, 0x104309b, 0x10430a0, 0x10430a5, 0x10430aa,
+  0x003f0a4, 0x003b09d, 0x0038096, 0x103809b, 0x10380a0, 0x10380a5, 0x10380aa, 0x003b0b2,
+  0x003e0b9, 0x00410c0, 0x00450c7, 0x103f0c5, 0x10390c3, 0x10350c3, 0x10340c9, 0x10370d0,
+  0x103e0d3, 0x10420d4, 0x10460d5, 0x003f0d3, 0x00380d1, 0x10340d5, 0x00350dd, 0x00360e4,
+  0x10340e9, 0x102d0eb, 0x10270e9, 0x10240e7, 0x10230e3, 0x10240e1, 0x10270df, 0x102d0de,
+  0x10340df, 0x10360e4, 0x003d0ea, 0x00450f0, 0x004c0f5, 0x00540fb, 0x005b101, 0x0063106,
+  0x006a10c, 0x0072111, 0x106c10f, 0x106610d, 0x106010a, 0x105a109, 0x1054108, 0x104c108,
+  0x1045108, 0x103e108, 0x1037108, 0x1031109, 0x102a109, 0x1024109, 0x101d109, 0x101610c,
+  0x100f10f, 0x1007111, 0x000f113, 0x0016115, 0x001d117, 0x0025119, 0x002c11b, 0x003311d,
+  0x003b11f, 0x0041121, 0x0049124, 0x104912b, 0x1049132, 0x1044132, 0x103f133, 0x103b132,
+  0x1036132, 0x1033131, 0x103012b, 0x1031124, 0x003412b, 0x0036132, 0x003813a, 0x003b141,
+  0x003c149, 0x003e150, 0x0041158, 0x103c158, 0x1038158, 0x1034158, 0x0037154, 0x003a150,
+  0x103a155, 0x103a15a, 0x103a15f, 0x003a166, 0x003a16d, 0x003a174, 0x003a17b, 0x003a182,
+  0x003a189, 0x003a190, 0x003a197, 0x1039191, 0x103718c, 0x1039187, 0x103c183, 0x1043181,
+  0x1048183, 0x104b187, 0x104c18b, 0x104b190, 0x104b196, 0x004818f, 0x0045188, 0x0042182,
+  0x1042186, 0x104218a, 0x104218e, 0x1042192, 0x0041198, 0x004119f, 0x00411a6, 0x103e1ac,
+  0x103a1ad, 0x10361ae, 0x10321ad, 0x102e1ac, 0x102b1a9, 0x102a1a5, 0x102b1a2, 0x102e1a0,
+  0x103219f, 0x103619f, 0x103a1a0, 0x103e1a1, 0x10411a6, 0x00481ad, 0x004f1b5, 0x00561bd,
+  0x005d1c5, 0x00641cd, 0x006b1d5, 0x00721dd, 0x106a1dd, 0x10631dd, 0x105e1dc, 0x105a1dc,
+  0x10561d6, 0x10581d2, 0x105a1ce, 0x105e1cd, 0x10631cd, 0x10691d3, 0x10691d7, 0x10691dc,
+  0x00651e2, 0x00621e8, 0x005f1ef, 0x005c1f5, 0x00591fc, 0x10591f8, 0x10591f4, 0x10591ed,
+  0x105f1ed, 0x10651ed, 0x106a1ed, 0x106f1ed, 0x10761ed, 0x10761f2, 0x10761f7, 0x10761fc,
+  0x006e1fb, 0x00671fa, 0x10671f5, 0x10671ee, 0x005f1e6, 0x00571df, 0x00501d7, 0x00481d0,
+  0x00411c9, 0x10411d0, 0x10411d7, 0x10411de, 0x10411e5, 0x10411ec, 0x10411f4, 0x10411fc,
+  0x1041204, 0x003e1fd, 0x003c1f6, 0x003b1f0, 0x00391e9, 0x00371e2, 0x00341dc, 0x102d1dc,
+  0x10251dc, 0x10211dc, 0x101c1dc, 0x10191d5, 0x101d1ce, 0x10221cd, 0x10261cd, 0x102b1d3,
+  0x102c1d7, 0x102c1dc, 0x002e1e2, 0x00301e9, 0x00321f0, 0x102b1f0, 0x10241f0, 0x10201f0,
+  0x101c1f0, 0x101a1f3, 0x101a1fa, 0x00201f3, 0x00261ed, 0x002c1e7, 0x102c1ec, 0x102c1f2,
+  0x102c1f6, 0x102c1fb, 0x00341ff, 0x003b203, 0x0043207, 0x004b20b, 0x005320f, 0x005b213,
+  0x0063217, 0x006b21c, 0x106421e, 0x105d220, 0x1056222, 0x104f225, 0x1047225, 0x1040225,
+  0x1039225, 0x1032225, 0x102a226, 0x1023225, 0x101c224, 0x1014224, 0x100e221, 0x100721e,
+  0x100021c, 0x0001214, 0x000220c, 0x0003204, 0x00031fc, 0x00041f4, 0x00051ec, 0x00061e4,
+  0x00061dc, 0x00071d4, 0x00081cc, 0x00081c4, 0x00091bd, 0x000a1b5, 0x000b1ad, 0x000b1a5,
+  0x000c19d, 0x000d195, 0x000d18d, 0x000e185, 0x000f17d, 0x0010175, 0x001016d, 0x0011166,
+  0x001215e, 0x0012156, 0x001314e, 0x0014146, 0x001513e, 0x0015136, 0x001612e, 0x0017126,
+  0x001711e, 0x0018116, 0x0019110, 0x001a108, 0x001a100, 0x001b0f8, 0x001c0f0, 0x001c0e8,
+  0x001d0e0, 0x001e0d8, 0x001f0d0, 0x001f0c8, 0x00200c0, 0x00210b9, 0x00210b1, 0x00220a9,
+  0x00230a1, 0x0024099, 0x0024091, 0x0025089, 0x0026081, 0x0026079, 0x0027071, 0x0028069,
+  0x0029062, 0x002905a, 0x002a052, 0x002b04a, 0x002b042, 0x002c03a, 0x002d032, 0x002e02a,
+  0x002e022, 0x002f01a, 0x0030012, 0x003000a,
+};
+
+static constexpr uint32_t EQN_25_POINTS[465] = {
+  0x00c8024, 0x10c2024, 0x10bc024, 0x10b6024, 0x10b0024, 0x10a8024, 0x10a1023, 0x109e01e,
+  0x109c018, 0x109f013, 0x10a200d, 0x10a900c, 0x10b100b, 0x10b5010, 0x10ba015, 0x10ba01c,
+  0x10ba023, 0x00bc02a, 0x00be030, 0x00c0036, 0x00c203c, 0x10c2043, 0x10c2049, 0x10c204f,
+  0x10c2055, 0x10bc052, 0x10b704f, 0x10b204b, 0x10ac047, 0x10a6043, 0x10a003f, 0x10a0045,
+  0x10a004b, 0x10a0051, 0x10a1057, 0x009d050, 0x0099048, 0x0095040, 0x0092038, 0x008e030,
+  0x008a028, 0x0086020, 0x0083018, 0x007f010, 0x007b008, 0x0078000, 0x1078007, 0x107800e,
+  0x1078015, 0x107801c, 0x1078023, 0x1078029, 0x1078031, 0x1078039, 0x1078040, 0x1078048,
+  0x107804f, 0x1078057, 0x107805e, 0x0071057, 0x006b050, 0x0064048, 0x005f041, 0x005803a,
+  0x0052032, 0x004b02b, 0x0045024, 0x003e01c, 0x103801c, 0x103201c, 0x102c01c, 0x102601c,
+  0x101f01c, 0x101701b, 0x1015016, 0x1012010, 0x101500a, 0x1018004, 0x1020003, 0x1027002,
+  0x102c007, 0x103000c, 0x1030014, 0x103001b, 0x0031023, 0x003202a, 0x0033032, 0x0033039,
+  0x0034040, 0x0035048, 0x003604f, 0x0036056, 0x1031053, 0x102c04f, 0x1025049, 0x101d042,
+  0x101803e, 0x101203a, 0x001a03b, 0x002103b, 0x002803b, 0x002f03b, 0x003603b, 0x103203f,
+  0x102d043, 0x1026049, 0x101e04e, 0x1018052, 0x1012056, 0x001a05b, 0x002105f, 0x0029064,
+  0x0030068, 0x003806c, 0x003f071, 0x0047075, 0x004e07a, 0x005607e, 0x005d082, 0x0064087,
+  0x006b08b, 0x0073090, 0x007a094, 0x0082098, 0x108209e, 0x10820a4, 0x10820a9, 0x10820af,
+  0x10820b4, 0x10820b9, 0x007e0b3, 0x007a0ad, 0x00760a6, 0x00720a0, 0x006f099, 0x106f09f,
+  0x106f0a4, 0x106f0a9, 0x106f0af, 0x106f0b4, 0x106f0b9, 0x00760c1, 0x007e0c9, 0x00860d0,
+  0x008d0d8, 0x00950e0, 0x009d0e7, 0x00a50ef, 0x00ac0f7, 0x00b40fe, 0x00bc106, 0x00c410d,
+  0x10be10d, 0x10b810d, 0x10b210d, 0x10ac10d, 0x10a410d, 0x109d10c, 0x109a107, 0x1098101,
+  0x109b0fb, 0x109e0f5, 0x10a50f4, 0x10ad0f3, 0x10b10f8, 0x10b60fd, 0x10b6105, 0x10b710c,
+  0x00b8112, 0x00ba118, 0x00bc11e, 0x00be124, 0x10be12a, 0x10be131, 0x10be137, 0x10be13e,
+  0x10b6138, 0x10af133, 0x10a912f, 0x10a312b, 0x109d127, 0x109d12d, 0x109d133, 0x109d139,
+  0x109d13f, 0x0099137, 0x009612f, 0x0092128, 0x008f120, 0x008c119, 0x0088112, 0x008510b,
+  0x0082103, 0x007e0fc, 0x007b0f4, 0x00780ec, 0x10780f4, 0x10780fc, 0x1078104, 0x107810c,
+  0x1078113, 0x107811b, 0x1078122, 0x1078129, 0x1078130, 0x1078137, 0x107813e, 0x1078145,
+  0x107814d, 0x0071145, 0x006b13e, 0x0065137, 0x006012f, 0x005a128, 0x0054121, 0x004e119,
+  0x0048113, 0x004110b, 0x103b10b, 0x103510b, 0x102f10b, 0x102910b, 0x102210b, 0x101a10a,
+  0x1018105, 0x10150ff, 0x10180fa, 0x101b0f4, 0x10230f3, 0x102a0f2, 0x102e0f7, 0x10320fc,
+  0x1033103, 0x103310a, 0x0034112, 0x0034119, 0x0035121, 0x0035129, 0x0035130, 0x0036138,
+  0x0036140, 0x0036148, 0x102f144, 0x1028140, 0x102013d, 0x101a139, 0x1013136, 0x100d133,
+  0x1007131, 0x100412b, 0x1000125, 0x0008125, 0x000f125, 0x0017125, 0x001e126, 0x0026126,
+  0x002d126, 0x0034127, 0x102e12a, 0x102812d, 0x1021130, 0x101b133, 0x1014136, 0x001c13b,
+  0x0024141, 0x002b146, 0x003314c, 0x003b152, 0x0042157, 0x004a15d, 0x0052163, 0x0059168,
+  0x006116e, 0x0068174, 0x006f179, 0x007717f, 0x007f185, 0x1078188, 0x107218c, 0x1072184,
+  0x107217d, 0x1078180, 0x107f184, 0x008518b, 0x008b193, 0x009119b, 0x00971a2, 0x009d1aa,
+  0x00a41b2, 0x00aa1b9, 0x00b01c1, 0x00b61c9, 0x00bc1d0, 0x00c21d8, 0x00c91e0, 0x10c31e0,
+  0x10bd1e0, 0x10b71e0, 0x10b11e0, 0x10a91df, 0x10a21df, 0x109f1d9, 0x109d1d4, 0x10a01ce,
+  0x10a31c8, 0x10aa1c7, 0x10b21c7, 0x10b61cb, 0x10bb1d0, 0x10bb1d7, 0x10bc1df, 0x00bc1e6,
+  0x00bc1ee, 0x00bd1f5, 0x00bd1fd, 0x00bd205, 0x00be20c, 0x00be214, 0x00bf21c, 0x10b7218,
+  0x10b0215, 0x10a9212, 0x10a220e, 0x109b20b, 0x1095208, 0x108f206, 0x108c1ff, 0x10891f9,
+  0x00901f9, 0x00971f9, 0x009e1fa, 0x00a61fa, 0x00ad1fb, 0x00b41fb, 0x00bc1fc, 0x10b41ff,
+  0x10ac203, 0x10a4207, 0x109d20b, 0x0098203, 0x00941fb, 0x00901f4, 0x008c1ec, 0x00881e5,
+  0x00841dd, 0x00801d6, 0x007c1ce, 0x00781c7, 0x10781cd, 0x10781d4, 0x10781db, 0x10781e2,
+  0x10781e9, 0x10781f0, 0x10781f7, 0x10781ff, 0x1078207, 0x107820e, 0x1078216, 0x107821e,
+  0x1078226, 0x007221e, 0x006c217, 0x0066210, 0x0062209, 0x005c202, 0x00561fa, 0x00511f3,
+  0x004b1ec, 0x00451e5, 0x003f1de, 0x10391de, 0x10331de, 0x102d1de, 0x10271de, 0x10201dd,
+  0x10191dd, 0x10161d7, 0x10131d2, 0x10161cc, 0x10191c6, 0x10211c5, 0x10281c5, 0x102d1c9,
+  0x10311ce, 0x10321d5, 0x10321dd, 0x00341e3, 0x00361e9, 0x00381ef, 0x00391f5, 0x10391fb,
+  0x1039202, 0x1039208, 0x103920f, 0x1032209, 0x102a204, 0x1024200, 0x101e1fc, 0x10181f9,
+  0x1018200, 0x1018208, 0x1018210, 0x001b208, 0x001e200, 0x00211f8, 0x00241f0, 0x00271e8,
+  0x002a1e0, 0x002c1d8, 0x002f1d0, 0x00321c8, 0x00351c0, 0x00381b8, 0x003b1b0, 0x003d1a8,
+  0x00401a0, 0x0043198, 0x0046191, 0x0049189, 0x004c181, 0x004e179, 0x0051171, 0x0054169,
+  0x0057161, 0x005a159, 0x005d151, 0x005f149, 0x0062141, 0x0064139, 0x0067131, 0x006a129,
+  0x006d121, 0x007011a, 0x0072113, 0x007510b, 0x0078103, 0x007b0fb, 0x007e0f3, 0x00810eb,
+  0x00830e3, 0x00860db, 0x00890d3, 0x008c0cb, 0x008f0c3, 0x00920bb, 0x00940b3, 0x00970ab,
+  0x009a0a3, 0x009d09c, 0x00a0094, 0x00a308c, 0x00a5084, 0x00a807c, 0x00ab074, 0x00ae06c,
+  0x00b1064, 0x00b405c, 0x00b6054, 0x00b904c, 0x00bc044, 0x00bf03c, 0x00c2034, 0x00c502c,
+  0x00c8024,
+};
+
+static constexpr uint32_t EQN_26_POINTS[465] = {
+  0x001200d, 0x1014012, 0x1017016, 0x101c018, 0x1020017, 0x1024016, 0x1027011, 0x102800b,
+  0x1027006, 0x1022001, 0x101e000, 0x101a002, 0x1015003, 0x1014007, 0x101200b, 0x000d008,
+  0x0007004, 0x0001000, 0x1000004, 0x1001009, 0x100500c, 0x100b00c, 0x101000c, 0x101700c,
+  0x101e00c, 0x102400c, 0x102a00c, 0x102e00d, 0x103300d, 0x103a00f, 0x103c013, 0x103a018,
+  0x003401d, 0x002e022, 0x0028026, 0x1022024, 0x101c023, 0x1016025, 0x1012028, 0x001902d,
+  0x0020032, 0x0026037, 0x101f037, 0x1017037, 0x101703b, 0x101703f, 0x001f046, 0x002604c,
+  0x1027050, 0x1026053, 0x1021055, 0x101b053, 0x1018051, 0x101704e, 0x101904a, 0x101c049,
+  0x102004b, 0x102204f, 0x1021054, 0x002205a, 0x0023060, 0x0025066, 0x1022064, 0x101d060,
+  0x101905d, 0x001f05e, 0x002505e, 0x1022060, 0x101d064, 0x1019066, 0x001c06c, 0x001f072,
+  0x0022078, 0x101d078, 0x101b078, 0x001f074, 0x101f078, 0x101f07d, 0x001e084, 0x001c08a,
+  0x001b091, 0x0019097, 0x1020097, 0x1026097, 0x1021092, 0x102608c, 0x102008c, 0x101908c,
+  0x001d094, 0x002009b, 0x00230a3, 0x00270aa, 0x10280ae, 0x10270b1, 0x10220b3, 0x101c0b2,
+  0x10190af, 0x10180ac, 0x101a0a9, 0x101d0a8, 0x10210a9, 0x10230ad, 0x10220b3, 0x00230b9,
+  0x00240bf, 0x00260c4, 0x10220c3, 0x101e0c1, 0x101a0be, 0x10160bd, 0x10140b9, 0x001a0b9,
+  0x00200b9, 0x00250b9, 0x10200bc, 0x101b0be, 0x00220c5, 0x00280cc, 0x10220ce, 0x101e0cf,
+  0x10180ce, 0x10130cc, 0x00180d4, 0x001d0dc, 0x00210e3, 0x10210e8, 0x10210ee, 0x001e0e9,
+  0x001b0e3, 0x101b0e9, 0x101b0ee, 0x00170f5, 0x00120fc, 0x000d103, 0x100c108, 0x100f10c,
+  0x101410e, 0x101a10e, 0x102010e, 0x102610e, 0x102c10d, 0x103010e, 0x103410e, 0x103810f,
+  0x103c10f, 0x1041113, 0x1040118, 0x0038117, 0x0031116, 0x0029115, 0x0022115, 0x001b114,
+  0x0014113, 0x000c113, 0x100b117, 0x100e11c, 0x101411d, 0x101a11d, 0x102011d, 0x102611d,
+  0x102c11d, 0x103011d, 0x103411d, 0x103811e, 0x103c11f, 0x1040122, 0x1040128, 0x0038127,
+  0x0030126, 0x0028125, 0x0022125, 0x001a124, 0x0012123, 0x000a123, 0x100f123, 0x1013123,
+  0x1013127, 0x1012128, 0x100f129, 0x100c128, 0x100a127, 0x100a123, 0x0011126, 0x001812a,
+  0x001f12d, 0x0026131, 0x002d134, 0x0034138, 0x003b13b, 0x004213f, 0x103d13d, 0x103913b,
+  0x103213a, 0x102b13a, 0x102413a, 0x101d13a, 0x101613b, 0x101113d, 0x100b13f, 0x0013140,
+  0x001a142, 0x0021143, 0x0027145, 0x002e146, 0x0035148, 0x003c149, 0x004414b, 0x104514f,
+  0x1044153, 0x103f155, 0x1039153, 0x1037150, 0x103614d, 0x103714a, 0x103a149, 0x103f14b,
+  0x104014e, 0x1040154, 0x003b158, 0x003715d, 0x103d15d, 0x104415d, 0x103e162, 0x1044169,
+  0x103d169, 0x1036169, 0x0033162, 0x003015b, 0x002d154, 0x002a14d, 0x0028146, 0x102814b,
+  0x1028151, 0x1028157, 0x102815d, 0x1028163, 0x102816a, 0x0024162, 0x002015b, 0x001c153,
+  0x001814c, 0x1018150, 0x1017153, 0x1013155, 0x100d154, 0x100a151, 0x100914e, 0x100a14b,
+  0x100e14a, 0x101214b, 0x101414f, 0x1013154, 0x001415a, 0x0015160, 0x0015166, 0x1011164,
+  0x100c160, 0x100915d, 0x000f15d, 0x001515e, 0x1012160, 0x100d164, 0x1009166, 0x001016b,
+  0x0017170, 0x001e175, 0x002417b, 0x1024180, 0x1024184, 0x002a189, 0x003018e, 0x0037193,
+  0x003d198, 0x004419d, 0x10441a1, 0x10431a4, 0x103f1a6, 0x10391a5, 0x10361a2, 0x103519f,
+  0x103719c, 0x103a19b, 0x103e19c, 0x10401a0, 0x103f1a6, 0x00411aa, 0x00431af, 0x103c1af,
+  0x10351af, 0x10351b3, 0x10351b7, 0x00321b0, 0x002f1a9, 0x002d1a3, 0x002a19c, 0x0028196,
+  0x102819b, 0x10281a0, 0x10281a6, 0x10281ac, 0x10281b2, 0x10281b8, 0x00231b1, 0x00201aa,
+  0x001c1a3, 0x001719c, 0x10181a0, 0x10171a4, 0x10121a5, 0x100c1a4, 0x10091a1, 0x100819e,
+  0x100a19b, 0x100d19a, 0x101119c, 0x101319f, 0x10131a5, 0x00151aa, 0x00161af, 0x00171b5,
+  0x10101b2, 0x100c1af, 0x10081ae, 0x10061aa, 0x000c1aa, 0x00111aa, 0x00161ab, 0x10111ad,
+  0x100c1b0, 0x00141b2, 0x001c1b5, 0x00231b7, 0x002a1ba, 0x00321bc, 0x003a1bf, 0x00421c2,
+  0x103b1c4, 0x10341c6, 0x102d1c6, 0x10261c6, 0x10201c6, 0x101b1c6, 0x10151c6, 0x10101c4,
+  0x100b1c2, 0x00121c8, 0x00191ce, 0x00201d4, 0x00271da, 0x002e1e1, 0x102e1e5, 0x102d1e8,
+  0x10291ea, 0x10231e8, 0x10201e6, 0x101f1e3, 0x10201df, 0x10241de, 0x10281e0, 0x102a1e4,
+  0x10291e9, 0x002a1ee, 0x002b1f3, 0x002c1f9, 0x10291f6, 0x10241f2, 0x10201f0, 0x00261f0,
+  0x002c1f0, 0x10291f3, 0x10241f6, 0x10201f9, 0x00251fe, 0x002a204, 0x002f20a, 0x102f20e,
+  0x102e212, 0x102a214, 0x1024212, 0x1021210, 0x102020d, 0x1021209, 0x1025208, 0x102920a,
+  0x102b20d, 0x102a213, 0x002c219, 0x002e21f, 0x0030226, 0x1029222, 0x1024220, 0x102021e,
+  0x101e21a, 0x002321a, 0x002921a, 0x002f21b, 0x102a21d, 0x1025220, 0x0024218, 0x0024210,
+  0x0024208, 0x0023200, 0x00231f8, 0x00231f0, 0x00231e8, 0x00221e0, 0x00221d8, 0x00221d0,
+  0x00221c8, 0x00221c0, 0x00221b8, 0x00221b1, 0x00211a9, 0x00211a1, 0x0021199, 0x0020191,
+  0x0020189, 0x0020181, 0x0020179, 0x001f171, 0x001f169, 0x001f161, 0x001e159, 0x001e151,
+  0x001e14a, 0x001e142, 0x001d13a, 0x001d132, 0x001d12a, 0x001c122, 0x001c11a, 0x001c113,
+  0x001c10b, 0x001b103, 0x001b0fb, 0x001b0f3, 0x001a0eb, 0x001a0e3, 0x001a0dc, 0x001a0d4,
+  0x00190cc, 0x00190c4, 0x00190bc, 0x00180b4, 0x00180ac, 0x00180a4, 0x001809c, 0x0017094,
+  0x001708c, 0x0017084, 0x001607c, 0x0016075, 0x001606d, 0x0016065, 0x001505d, 0x0015055,
+  0x001504d, 0x0014045, 0x001403d, 0x0014035, 0x001402d, 0x0013025, 0x001301d, 0x0013015,
+  0x001200d,
+};
+
+static constexpr uint32_t EQN_27_POINTS[407] = {
+  0x000700a, 0x1006005, 0x1007001, 0x100c000, 0x1010000, 0x1012002, 0x1013006, 0x1012009,
+  0x001200e, 0x0012013, 0x1014017, 0x101201b, 0x100e01d, 0x100a01c, 0x1006017, 0x1009012,
+  0x100d011, 0x1012013, 0x000e019, 0x000b01f, 0x0007025, 0x1007028, 0x100702c, 0x100802e,
+  0x100a02e, 0x100c02c, 0x100d029, 0x1010026, 0x1012027, 0x101402b, 0x101402e, 0x0015034,
+  0x001603a, 0x1010038, 0x100c037, 0x1007038, 0x100003b, 0x000603e, 0x000c040, 0x0012042,
+  0x1012047, 0x101104a, 0x100f04b, 0x100b04c, 0x100804c, 0x100604b, 0x1006048, 0x1005046,
+  0x1007043, 0x1009042, 0x100b044, 0x100c046, 0x100c04b, 0x000d052, 0x000e058, 0x100a058,
+  0x1007058, 0x000b053, 0x100b057, 0x100b05d, 0x0011060, 0x0018063, 0x1014063, 0x1010063,
+  0x100b063, 0x1006064, 0x1005066, 0x100606a, 0x100906d, 0x100d06d, 0x101106b, 0x1011066,
+  0x1010064, 0x001306b, 0x0017071, 0x1014074, 0x100d076, 0x1008075, 0x1001073, 0x0007078,
+  0x000c07d, 0x0011081, 0x1011086, 0x101108b, 0x000e086, 0x000b081, 0x100b086, 0x100b08b,
+  0x000b092, 0x000a098, 0x000909e, 0x00080a4, 0x10070a0, 0x100809c, 0x100d09a, 0x101109b,
+  0x101309d, 0x10140a0, 0x10130a4, 0x00130a9, 0x00140ae, 0x10150b2, 0x10130b6, 0x100f0b8,
+  0x100b0b7, 0x10070b2, 0x100a0ad, 0x100f0ac, 0x10130ae, 0x000f0b4, 0x000c0ba, 0x00080c0,
+  0x10080c3, 0x10080c7, 0x10090c9, 0x100b0c9, 0x100d0c7, 0x100e0c4, 0x10110c1, 0x10130c2,
+  0x10150c5, 0x10150c8, 0x00160cf, 0x00180d5, 0x10110d2, 0x100d0d2, 0x10080d3, 0x10010d6,
+  0x00070d9, 0x000d0db, 0x00130dd, 0x10130e2, 0x10130e5, 0x10110e6, 0x100c0e7, 0x10090e6,
+  0x10080e6, 0x10070e3, 0x10060e1, 0x10080de, 0x100a0dd, 0x100c0df, 0x100d0e1, 0x100d0e6,
+  0x00130ea, 0x00190ed, 0x10150ef, 0x100e0f1, 0x10090f0, 0x10020ee, 0x00040f5, 0x00050fb,
+  0x0007101, 0x0008107, 0x1007102, 0x10080fe, 0x100d0fd, 0x10110fd, 0x10130ff, 0x1014103,
+  0x1012107, 0x001210c, 0x0013110, 0x1014115, 0x1013118, 0x100f11a, 0x100b11a, 0x1007114,
+  0x100a10f, 0x100e10e, 0x1013110, 0x000f116, 0x000c11c, 0x0008122, 0x1008125, 0x1008129,
+  0x100912b, 0x100b12b, 0x100d129, 0x100e127, 0x1010123, 0x1013124, 0x1014128, 0x101412b,
+  0x0015131, 0x0017138, 0x1011135, 0x100d134, 0x1008135, 0x1001138, 0x000913a, 0x001013c,
+  0x001813e, 0x101413e, 0x101013e, 0x100b13e, 0x100613f, 0x1005142, 0x1006146, 0x1009148,
+  0x100d148, 0x1010146, 0x1011142, 0x101013f, 0x0012144, 0x0015149, 0x001814f, 0x1015151,
+  0x100e153, 0x1009153, 0x1002150, 0x0008155, 0x000e15a, 0x100e15e, 0x100e162, 0x000c167,
+  0x000916d, 0x1008170, 0x1008174, 0x100a176, 0x100b176, 0x100d174, 0x100e172, 0x101116e,
+  0x101316f, 0x1014173, 0x1015176, 0x001517a, 0x001517f, 0x1014185, 0x100e185, 0x1008185,
+  0x000817f, 0x1008185, 0x100818a, 0x000d18e, 0x0013192, 0x1014194, 0x1014197, 0x101419a,
+  0x101219b, 0x100e19c, 0x100819c, 0x000e196, 0x0015191, 0x1010191, 0x100c191, 0x1008191,
+  0x000d198, 0x00131a0, 0x00191a8, 0x10131a5, 0x100f1a4, 0x100a1a5, 0x10031a8, 0x00091aa,
+  0x000e1ac, 0x00141af, 0x10151b4, 0x10141b7, 0x10121b8, 0x100e1b9, 0x100b1b9, 0x10091b8,
+  0x10081b6, 0x10081b3, 0x100a1b0, 0x100c1b0, 0x100d1b1, 0x100e1b4, 0x100e1b8, 0x00141bb,
+  0x001a1bf, 0x10161c1, 0x100f1c3, 0x100a1c3, 0x10031c0, 0x00061c6, 0x00081cc, 0x10071cf,
+  0x10081d3, 0x10091d5, 0x100b1d5, 0x100c1d3, 0x100e1d0, 0x10101cd, 0x10131ce, 0x10141d2,
+  0x10141d4, 0x00141d9, 0x00141de, 0x10141e4, 0x100d1e4, 0x10081e4, 0x00071de, 0x10081e4,
+  0x10071e9, 0x000d1ed, 0x00131f1, 0x10131f3, 0x10141f6, 0x10131f8, 0x10111fa, 0x100d1fa,
+  0x10081fa, 0x000e1f5, 0x00141f0, 0x100f1f0, 0x100c1f0, 0x10071f0, 0x000c1f6, 0x00101fd,
+  0x0014203, 0x001920a, 0x1012207, 0x100e207, 0x1009208, 0x100320b, 0x000b20d, 0x001120f,
+  0x0019211, 0x1015211, 0x1011211, 0x100c211, 0x1007211, 0x1006214, 0x1007218, 0x100a21a,
+  0x100f21b, 0x1012218, 0x1012214, 0x1011211, 0x0014216, 0x001721b, 0x001a221, 0x1016224,
+  0x100f226, 0x100a225, 0x1003222, 0x000421a, 0x0004212, 0x000420a, 0x0004202, 0x00041fa,
+  0x00041f2, 0x00041ea, 0x00041e2, 0x00041db, 0x00041d3, 0x00041cb, 0x00041c3, 0x00041bb,
+  0x00041b3, 0x00041ab, 0x00041a3, 0x000419c, 0x0005194, 0x000518c, 0x0005184, 0x000517c,
+  0x0005174, 0x000516c, 0x0005164, 0x000515c, 0x0005155, 0x000514d, 0x0005145, 0x000513d,
+  0x0005135, 0x000512d, 0x0005125, 0x000511d, 0x0005116, 0x000610f, 0x0006107, 0x00060ff,
+  0x00060f7, 0x00060ef, 0x00060e7, 0x00060df, 0x00060d7, 0x00060d0, 0x00060c8, 0x00060c0,
+  0x00060b8, 0x00060b0, 0x00060a8, 0x00060a0, 0x0006098, 0x0006090, 0x0007089, 0x0007081,
+  0x0007079, 0x0007071, 0x0007069, 0x0007061, 0x0007059, 0x0007051, 0x000704a, 0x0007042,
+  0x000703a, 0x0007032, 0x000702a, 0x0007022, 0x000701a, 0x0007012, 0x000700a,
+};
+
+static constexpr uint32_t EQN_28_POINTS[414] = {
+  0x0006000, 0x1005003, 0x1005006, 0x1007008, 0x1009009, 0x100a007, 0x100c004, 0x100e001,
+  0x1010002, 0x1012005, 0x1012008, 0x001200d, 0x0012012, 0x1012017, 0x100b017, 0x1005017,
+  0x0005012, 0x1005017, 0x100501c, 0x000b020, 0x0010024, 0x1011027, 0x1012029, 0x101102c,
+  0x100f02d, 0x100b02e, 0x100502e, 0x000c029, 0x0012024, 0x100d024, 0x1009024, 0x1005024,
+  0x000b02c, 0x0010033, 0x001603a, 0x1010037, 0x100c037, 0x1007038, 0x100003b, 0x000603d,
+  0x000c03f, 0x0012041, 0x1012046, 0x1011049, 0x100f04b, 0x100b04b, 0x100804b, 0x100604a,
+  0x1005048, 0x1005045, 0x1007042, 0x1009042, 0x100b043, 0x100b046, 0x100c04a, 0x000d051,
+  0x000e058, 0x100a058, 0x1007058, 0x000b053, 0x100b057, 0x100b05c, 0x0011060, 0x0018063,
+  0x1014063, 0x1010063, 0x100b063, 0x1006063, 0x1005066, 0x100606a, 0x100906c, 0x100d06d,
+  0x101006a, 0x1011066, 0x1010063, 0x001306a, 0x0017071, 0x1014074, 0x100d075, 0x1008075,
+  0x1001072, 0x0007077, 0x000c07c, 0x0011080, 0x1011085, 0x101108b, 0x000e086, 0x000b080,
+  0x100b085, 0x100b08b, 0x000b092, 0x000a098, 0x000909e, 0x00080a4, 0x10070a0, 0x100809c,
+  0x100d09a, 0x101109b, 0x101309d, 0x10140a0, 0x10130a4, 0x00130a9, 0x00130ae, 0x10150b2,
+  0x10130b6, 0x100f0b8, 0x100b0b7, 0x10070b1, 0x100a0ad, 0x100e0ab, 0x10130ae, 0x000f0b4,
+  0x000c0ba, 0x00080bf, 0x10080c3, 0x10080c6, 0x10090c9, 0x100b0c9, 0x100d0c7, 0x100e0c4,
+  0x10110c1, 0x10130c1, 0x10150c5, 0x10150c8, 0x00160cf, 0x00170d5, 0x10110d2, 0x100d0d2,
+  0x10080d3, 0x10010d6, 0x00080d8, 0x000d0da, 0x00130dc, 0x001a0dd, 0x10160dd, 0x10120dd,
+  0x100d0dd, 0x10080de, 0x10070e1, 0x10080e5, 0x100b0e7, 0x10100e7, 0x10130e5, 0x10130e1,
+  0x10120de, 0x00150e5, 0x00190ec, 0x10150ef, 0x100e0f1, 0x10090f0, 0x10020ed, 0x00050f4,
+  0x00080fb, 0x10080fe, 0x1008102, 0x1009104, 0x100b104, 0x100c102, 0x100e100, 0x10100fc,
+  0x10130fd, 0x1014101, 0x1014104, 0x0014109, 0x001410d, 0x1014113, 0x100d113, 0x1008113,
+  0x000710d, 0x1008113, 0x1007118, 0x000d11c, 0x0013120, 0x1013122, 0x1014125, 0x1013128,
+  0x1011129, 0x100d12a, 0x100812a, 0x000e125, 0x0014120, 0x101011f, 0x100c11f, 0x100711f,
+  0x000b125, 0x000f12b, 0x0013131, 0x0017137, 0x1011135, 0x100d134, 0x1008135, 0x1001138,
+  0x000813a, 0x000d13c, 0x001413e, 0x1014143, 0x1013146, 0x1011147, 0x100d148, 0x100a148,
+  0x1008147, 0x1007145, 0x1007142, 0x100913f, 0x100b13f, 0x100d140, 0x100d143, 0x100d147,
+  0x001214b, 0x001814f, 0x1015151, 0x100e153, 0x1008153, 0x1002150, 0x0008155, 0x000d15a,
+  0x0012160, 0x100d160, 0x1009160, 0x000e15a, 0x100e15f, 0x100e165, 0x000c16b, 0x000a172,
+  0x0008179, 0x1007175, 0x1008171, 0x100d16f, 0x1011170, 0x1013171, 0x1014175, 0x1012179,
+  0x001217e, 0x0013183, 0x1014187, 0x101318a, 0x100f18c, 0x100b18c, 0x1007186, 0x100a182,
+  0x100e180, 0x1013182, 0x000f188, 0x000c18e, 0x0008194, 0x1007198, 0x100819b, 0x100919d,
+  0x100b19e, 0x100d19c, 0x100e199, 0x1010195, 0x1013196, 0x101419a, 0x101419d, 0x00161a2,
+  0x00191a8, 0x10131a5, 0x100f1a4, 0x100a1a5, 0x10031a8, 0x00091aa, 0x000e1ac, 0x00141af,
+  0x10151b4, 0x10141b7, 0x10121b8, 0x100e1b9, 0x100a1b9, 0x10091b8, 0x10081b5, 0x10081b3,
+  0x10091b0, 0x100c1b0, 0x100d1b1, 0x100e1b4, 0x100e1b8, 0x00141bb, 0x001a1bf, 0x10161c1,
+  0x100f1c3, 0x100a1c3, 0x10031c0, 0x00061c6, 0x00081cc, 0x10071cf, 0x10081d3, 0x10091d5,
+  0x100b1d5, 0x100c1d3, 0x100e1d0, 0x10101cd, 0x10131ce, 0x10141d1, 0x10141d4, 0x00141d9,
+  0x00141de, 0x10141e4, 0x100d1e4, 0x10071e4, 0x00071de, 0x10071e4, 0x10071e9, 0x000d1ed,
+  0x00131f1, 0x10131f3, 0x10141f6, 0x10131f8, 0x10111fa, 0x100d1fa, 0x10071fa, 0x000d1f5,
+  0x00141f0, 0x100f1f0, 0x100c1f0, 0x10071f0, 0x000c1f6, 0x00101fd, 0x0014203, 0x001920a,
+  0x1012207, 0x100e207, 0x1009208, 0x100320b, 0x000b20d, 0x001120f, 0x0019211, 0x1015211,
+  0x1011211, 0x100c211, 0x1007211, 0x1006214, 0x1007218, 0x100a21a, 0x100f21b, 0x1012218,
+  0x1012214, 0x1011211, 0x0014216, 0x001721b, 0x001a221, 0x1016224, 0x100f226, 0x100a225,
+  0x1003222, 0x000421a, 0x0004212, 0x000420a, 0x0004202, 0x00041fa, 0x00041f2, 0x00041ea,
+  0x00041e2, 0x00041da, 0x00041d2, 0x00041ca, 0x00041c3, 0x00041bb, 0x00041b3, 0x00041ab,
+  0x00041a3, 0x000419b, 0x0004193, 0x000418b, 0x0004183, 0x000417b, 0x0004173, 0x000416c,
+  0x0005164, 0x000515c, 0x0005154, 0x000514c, 0x0005144, 0x000513c, 0x0005134, 0x000512c,
+  0x0005124, 0x000511c, 0x0005114, 0x000510e, 0x0005106, 0x00050fe, 0x00050f6, 0x00050ee,
+  0x00050e6, 0x00050de, 0x00050d6, 0x00050ce, 0x00050c6, 0x00050be, 0x00050b6, 0x00060af,
+  0x00060a7, 0x000609f, 0x0006097, 0x000608f, 0x0006087, 0x000607f, 0x0006077, 0x000606f,
+  0x0006067, 0x000605f, 0x0006058, 0x0006050, 0x0006048, 0x0006040, 0x0006038, 0x0006030,
+  0x0006028, 0x0006020, 0x0006018, 0x0006010, 0x0006008, 0x0006000,
+};
+
+static constexpr uint32_t EQN_29_POINTS[388] = {
+  0x0028000, 0x102e000, 0x1033000, 0x1039000, 0x103f000, 0x1044000, 0x104a000, 0x104a005,
+  0x104a009, 0x104a00e, 0x104a013, 0x004300d, 0x003c007, 0x0036000, 0x1036005, 0x1036009,
+  0x103600e, 0x1036013, 0x003c01a, 0x0042021, 0x0048028, 0x004e02f, 0x104702d, 0x104102a,
+  0x103d02a, 0x1039029, 0x103502a, 0x103002b, 0x102a02e, 0x1023030, 0x002b035, 0x0033039,
+  0x003b03d, 0x0042041, 0x103b03e, 0x103503d, 0x1030042, 0x1033046, 0x1038047, 0x103c048,
+  0x003f04d, 0x0042051, 0x103c053, 0x1038052, 0x1034051, 0x103004b, 0x1032046, 0x003a04c,
+  0x0041052, 0x0048058, 0x005005d, 0x104c060, 0x1048062, 0x1041064, 0x103b065, 0x1036065,
+  0x1031064, 0x102a062, 0x102305f, 0x002a065, 0x003106a, 0x0038070, 0x003f075, 0x103f07a,
+  0x103f07f, 0x103f084, 0x103f089, 0x003b083, 0x003807d, 0x0034076, 0x103407b, 0x1034080,
+  0x1034085, 0x1034089, 0x002d08a, 0x002608b, 0x001f08c, 0x001808d, 0x001108e, 0x000a08f,
+  0x000208f, 0x1001094, 0x1000099, 0x100309e, 0x10060a3, 0x100d0a5, 0x10130a6, 0x101a0a6,
+  0x10210a6, 0x10280a6, 0x102e0a6, 0x10350a6, 0x103b0a6, 0x10420a6, 0x10490a6, 0x104f0a6,
+  0x10550a6, 0x105b0a6, 0x10610a8, 0x10670a9, 0x106d0aa, 0x10720ae, 0x10770b2, 0x10760b8,
+  0x10750be, 0x006f0c4, 0x00690c9, 0x00640ce, 0x10690d2, 0x106d0d7, 0x106c0da, 0x10690db,
+  0x10660da, 0x10640d7, 0x10650d4, 0x10680d0, 0x106c0cc, 0x106d0c9, 0x106b0c6, 0x10660c7,
+  0x10640ca, 0x10640cd, 0x005c0cb, 0x00550c8, 0x004d0c5, 0x00460c3, 0x003f0c0, 0x00380bd,
+  0x00310bb, 0x00290b8, 0x00220b5, 0x001b0b3, 0x00130b0, 0x000c0ad, 0x00040aa, 0x10040ae,
+  0x10040b2, 0x10040b6, 0x00020bd, 0x00000c4, 0x10050c8, 0x10080ce, 0x10080d1, 0x10040d2,
+  0x10010d0, 0x10000cd, 0x10000ca, 0x10040c7, 0x10080c3, 0x10080bf, 0x10070bc, 0x10020be,
+  0x10000c0, 0x10000c4, 0x00060cc, 0x000c0d4, 0x00110db, 0x00170e3, 0x001c0ea, 0x00220f2,
+  0x00270f9, 0x102e0f9, 0x10340f9, 0x103a0fa, 0x103f0fa, 0x10450fd, 0x1046102, 0x1047106,
+  0x00420ff, 0x003e0f8, 0x003a0f1, 0x103a0f6, 0x103a0fb, 0x103a0ff, 0x103a106, 0x003e10d,
+  0x0043113, 0x004811a, 0x004d121, 0x104711e, 0x104111b, 0x103d11a, 0x103911a, 0x103411b,
+  0x102f11c, 0x102911f, 0x1022122, 0x0029126, 0x003012a, 0x003712f, 0x003d133, 0x0044138,
+  0x103e138, 0x103a138, 0x1034138, 0x1030138, 0x102b138, 0x102813b, 0x102813f, 0x1028143,
+  0x002f13b, 0x0036134, 0x003d12d, 0x103d133, 0x103d13a, 0x103d13f, 0x103d144, 0x0043147,
+  0x004914a, 0x004f14e, 0x1048153, 0x1041154, 0x103b156, 0x1036155, 0x1030155, 0x102a152,
+  0x1023150, 0x0026157, 0x002915e, 0x002c166, 0x002f16d, 0x0032174, 0x003517c, 0x1036180,
+  0x1036184, 0x1036189, 0x103618e, 0x103c18d, 0x1041188, 0x1040181, 0x103c17c, 0x103517c,
+  0x102f17e, 0x102b185, 0x102d18a, 0x102e18f, 0x003618e, 0x003c18e, 0x004418e, 0x004b18d,
+  0x005218d, 0x005a18d, 0x105a194, 0x105a199, 0x005c19f, 0x005e1a5, 0x00611ac, 0x105c1ac,
+  0x10561ac, 0x10531ab, 0x10511a7, 0x10551a3, 0x00581aa, 0x005c1b2, 0x00601ba, 0x105b1b8,
+  0x10561b8, 0x10521bb, 0x10551be, 0x105c1c0, 0x00601c7, 0x105b1c8, 0x10561c7, 0x10521c2,
+  0x10541be, 0x00591c4, 0x005e1cb, 0x00631d2, 0x00681d9, 0x10621d9, 0x105c1d9, 0x10551d9,
+  0x10531db, 0x10531e1, 0x00581db, 0x005d1d5, 0x00631d0, 0x10631d5, 0x10631da, 0x10631de,
+  0x10631e2, 0x005e1e8, 0x005a1ee, 0x00561f5, 0x00521fb, 0x004e202, 0x1048202, 0x1042202,
+  0x103c202, 0x1037201, 0x1032201, 0x10301fd, 0x102e1f9, 0x10301f5, 0x10321f1, 0x10381f0,
+  0x103d1f0, 0x10431f7, 0x10431fc, 0x1044201, 0x0045207, 0x004720d, 0x0049213, 0x004b219,
+  0x1045219, 0x1040219, 0x103b219, 0x1037219, 0x1032219, 0x102f21c, 0x102f220, 0x102f224,
+  0x003621c, 0x003d215, 0x004420e, 0x1044214, 0x104421b, 0x1044220, 0x1044226, 0x004321e,
+  0x0043216, 0x004220e, 0x0042206, 0x00411fe, 0x00411f6, 0x00411ee, 0x00401e6, 0x00401de,
+  0x003f1d6, 0x003f1ce, 0x003f1c6, 0x003e1be, 0x003e1b6, 0x003d1ae, 0x003d1a6, 0x003d19e,
+  0x003c196, 0x003c18e, 0x003b186, 0x003b17e, 0x003b176, 0x003b16e, 0x003b166, 0x003a15e,
+  0x003a156, 0x003a14e, 0x0039146, 0x003913e, 0x0038136, 0x003812e, 0x0038126, 0x003711e,
+  0x0037116, 0x0036110, 0x0036108, 0x0035100, 0x00350f8, 0x00350f0, 0x00340e8, 0x00340e0,
+  0x00330d8, 0x00330d0, 0x00330c8, 0x00320c0, 0x00320b8, 0x00310b0, 0x00310a8, 0x00310a0,
+  0x0030098, 0x0030090, 0x002f088, 0x002f080, 0x002f078, 0x002e070, 0x002e068, 0x002d060,
+  0x002d058, 0x002d050, 0x002c048, 0x002c040, 0x002b038, 0x002b030, 0x002b028, 0x002a020,
+  0x002a018, 0x0029010, 0x0029008, 0x0028000,
+};
+
+static constexpr uint32_t EQN_30_POINTS[290] = {
+  0x0050000, 0x1050007, 0x105000e, 0x1050015, 0x105001b, 0x1050021, 0x1050026, 0x1049022,
+  0x104201d, 0x103b018, 0x1034013, 0x102e00f, 0x102800a, 0x1022006, 0x101b001, 0x101c007,
+  0x101c00d, 0x101c013, 0x101c01a, 0x101c021, 0x101b027, 0x001c02e, 0x001d035, 0x001e03c,
+  0x001e042, 0x1020047, 0x102104d, 0x101f053, 0x101b056, 0x1017057, 0x1012057, 0x100c057,
+  0x1006057, 0x000d052, 0x001404c, 0x001b047, 0x0021041, 0x101c041, 0x1017041, 0x1013041,
+  0x100f041, 0x100b041, 0x1006041, 0x000a049, 0x000d051, 0x0010059, 0x0014061, 0x0017069,
+  0x001a070, 0x1014070, 0x100d070, 0x1007070, 0x000c06a, 0x0011063, 0x1011069, 0x101106e,
+  0x1011075, 0x101107c, 0x0015082, 0x0019088, 0x001d08e, 0x1022096, 0x102709d, 0x102109d,
+  0x101b09d, 0x101509d, 0x100e09d, 0x100609d, 0x0006098, 0x0006093, 0x000508d, 0x1006095,
+  0x100609c, 0x10060a3, 0x10050aa, 0x000d0b0, 0x00140b6, 0x001c0bc, 0x00230c2, 0x002b0c8,
+  0x00310ce, 0x00390d4, 0x10390dc, 0x10390e3, 0x10390ea, 0x10390f1, 0x00350ea, 0x00310e3,
+  0x002d0dc, 0x00290d4, 0x10290dc, 0x10290e3, 0x10290ea, 0x10290f1, 0x002f0f9, 0x0034101,
+  0x003a109, 0x0040111, 0x0046118, 0x004c120, 0x104c127, 0x104c12e, 0x104c136, 0x104c13b,
+  0x104c140, 0x104c146, 0x1045141, 0x103e13c, 0x1037137, 0x1030133, 0x102a12e, 0x102412a,
+  0x101e125, 0x1017121, 0x1017127, 0x101712d, 0x1017134, 0x101713a, 0x1017141, 0x1017148,
+  0x001f14a, 0x002614d, 0x002e14f, 0x0035152, 0x003c154, 0x0044157, 0x004b159, 0x005315c,
+  0x005a15e, 0x0062161, 0x1062166, 0x106216b, 0x105e170, 0x1058173, 0x105216f, 0x104d16c,
+  0x1048166, 0x1041163, 0x1041167, 0x104116c, 0x1040170, 0x1040174, 0x003816f, 0x003116b,
+  0x0029166, 0x0021162, 0x001915e, 0x101a164, 0x101b169, 0x101a16f, 0x1015172, 0x1011173,
+  0x100c174, 0x1006174, 0x1000174, 0x000716e, 0x000e168, 0x0015162, 0x001c15d, 0x101715d,
+  0x101215d, 0x100e15d, 0x100915d, 0x100515d, 0x100015d, 0x0005164, 0x000a16c, 0x000f174,
+  0x001417c, 0x0019184, 0x001e18c, 0x0023193, 0x002819b, 0x002d1a3, 0x00321ab, 0x00371b3,
+  0x003c1bb, 0x10341bb, 0x102d1bb, 0x10291bb, 0x10241bb, 0x00291b5, 0x002d1b0, 0x00311ab,
+  0x10311b2, 0x10311b9, 0x10311be, 0x10311c4, 0x10311ca, 0x002f1d1, 0x002d1d9, 0x002a1e1,
+  0x00281e8, 0x00261f0, 0x00231f8, 0x00211ff, 0x001f207, 0x001c20f, 0x001a216, 0x001821e,
+  0x0015226, 0x101421f, 0x1013218, 0x1012211, 0x101420a, 0x1016204, 0x10171fe, 0x101f1fb,
+  0x10261f8, 0x102d1f6, 0x10331f7, 0x10391f8, 0x10401f9, 0x10441fd, 0x1049201, 0x104b206,
+  0x104d20c, 0x104f212, 0x104c218, 0x104a21e, 0x1048225, 0x004821d, 0x0048215, 0x004820d,
+  0x0048205, 0x00481fd, 0x00481f5, 0x00481ed, 0x00481e5, 0x00491dd, 0x00491d5, 0x00491cd,
+  0x00491c5, 0x00491bd, 0x00491b5, 0x00491ad, 0x00491a5, 0x004919d, 0x004a195, 0x004a18d,
+  0x004a185, 0x004a17d, 0x004a175, 0x004a16e, 0x004a166, 0x004a15e, 0x004b156, 0x004b14e,
+  0x004b146, 0x004b13e, 0x004b136, 0x004b12e, 0x004b126, 0x004b11e, 0x004b116, 0x004c10f,
+  0x004c107, 0x004c0ff, 0x004c0f7, 0x004c0ef, 0x004c0e7, 0x004c0df, 0x004c0d7, 0x004c0cf,
+  0x004d0c7, 0x004d0bf, 0x004d0b7, 0x004d0b0, 0x004d0a8, 0x004d0a0, 0x004d098, 0x004d090,
+  0x004e088, 0x004e080, 0x004e078, 0x004e070, 0x004e068, 0x004e060, 0x004e058, 0x004e050,
+  0x004e048, 0x004f040, 0x004f038, 0x004f030, 0x004f028, 0x004f020, 0x004f018, 0x004f010,
+  0x004f008, 0x0050000,
+};
+
+static constexpr uint32_t EQN_31_POINTS[260] = {
+  0x0025005, 0x102600d, 0x1027015, 0x102801d, 0x1028024, 0x102d02c, 0x1032033, 0x1038036,
+  0x103f038, 0x1046036, 0x104e034, 0x1055032, 0x105d030, 0x106002a, 0x1064023, 0x106801c,
+  0x1065015, 0x106300e, 0x1060007, 0x105e000, 0x1058000, 0x1052000, 0x104c000, 0x1046000,
+  0x103e000, 0x1036000, 0x102f000, 0x1027000, 0x101f000, 0x1018000, 0x1010000, 0x1008000,
+  0x1000000, 0x0004008, 0x0008010, 0x000c017, 0x000f01f, 0x0013026, 0x001702e, 0x001a035,
+  0x001e03d, 0x0022044, 0x002604c, 0x0029053, 0x002d05b, 0x0031062, 0x003406a, 0x0037071,
+  0x003b079, 0x003f080, 0x103f087, 0x103f08e, 0x103f095, 0x103f09b, 0x103f0a2, 0x103f0a9,
+  0x103f0b0, 0x103f0b7, 0x003a0b0, 0x00360a8, 0x00320a0, 0x002e098, 0x0029090, 0x0025088,
+  0x0020080, 0x1020087, 0x102008e, 0x1020095, 0x102009c, 0x10200a3, 0x10200aa, 0x10200b1,
+  0x10200b7, 0x00270bf, 0x002e0c6, 0x00340ce, 0x003b0d5, 0x00420dd, 0x00490e4, 0x00500ec,
+  0x00570f3, 0x005e0fb, 0x0065102, 0x1064109, 0x1064110, 0x1064115, 0x106411c, 0x1064123,
+  0x1060128, 0x105d12e, 0x105a134, 0x1053137, 0x104d13b, 0x104713f, 0x103f139, 0x1037133,
+  0x103012d, 0x1028128, 0x1023121, 0x101e11b, 0x1019115, 0x1013111, 0x100c10d, 0x1005109,
+  0x1005110, 0x1005115, 0x100511c, 0x1005122, 0x1005129, 0x100512f, 0x1005136, 0x100513d,
+  0x1005144, 0x000d149, 0x001414e, 0x001c154, 0x0023159, 0x002a15e, 0x0032164, 0x0038169,
+  0x004016f, 0x103f176, 0x103f17e, 0x103f185, 0x103f18d, 0x103f194, 0x103f19c, 0x103f1a3,
+  0x103f1aa, 0x103f1b1, 0x103f1b8, 0x10401c0, 0x003f1b9, 0x003f1b2, 0x003f1ab, 0x003e1a4,
+  0x003e19d, 0x003e196, 0x003e18f, 0x103618c, 0x1030189, 0x1029186, 0x1022183, 0x101b180,
+  0x101317e, 0x1010177, 0x100c171, 0x0012178, 0x001817f, 0x001e186, 0x002418e, 0x002a195,
+  0x003019c, 0x00361a3, 0x003c1ab, 0x10351aa, 0x102f1a9, 0x10281a9, 0x10221a8, 0x101b1a7,
+  0x10141a7, 0x10101a9, 0x100b1ac, 0x000b1b3, 0x000b1ba, 0x000a1c1, 0x000a1c8, 0x000a1cf,
+  0x00091d6, 0x00091dd, 0x00091e4, 0x00081ec, 0x10101ec, 0x10181ec, 0x101f1ec, 0x10261ec,
+  0x102d1ec, 0x10341ec, 0x103b1ec, 0x10411ec, 0x003d1ec, 0x00391ed, 0x103d1f4, 0x10421fc,
+  0x1043200, 0x1045205, 0x104420b, 0x1043212, 0x1042219, 0x103c21f, 0x1037226, 0x003621e,
+  0x0036216, 0x003620e, 0x0035206, 0x00351fe, 0x00351f6, 0x00351ee, 0x00341e6, 0x00341de,
+  0x00341d7, 0x00341cf, 0x00341c7, 0x00341bf, 0x00341b7, 0x00341af, 0x00331a7, 0x003319f,
+  0x0033197, 0x003318f, 0x0032188, 0x0032180, 0x0032178, 0x0031170, 0x0031168, 0x0031160,
+  0x0031158, 0x0030150, 0x0030148, 0x0030140, 0x0030139, 0x002f131, 0x002f129, 0x002f121,
+  0x002f119, 0x002e112, 0x002e10a, 0x002e102, 0x002e0fa, 0x002d0f2, 0x002d0eb, 0x002d0e3,
+  0x002d0db, 0x002c0d3, 0x002c0cb, 0x002c0c3, 0x002b0bb, 0x002b0b3, 0x002b0ab, 0x002b0a3,
+  0x002a09c, 0x002a094, 0x002a08c, 0x002a084, 0x002907c, 0x0029074, 0x002906c, 0x0029064,
+  0x002805c, 0x0028054, 0x002804d, 0x0028045, 0x002703d, 0x0027035, 0x002702d, 0x0027025,
+  0x002601d, 0x0026015, 0x002600d, 0x0025005,
+};
+
+static constexpr uint32_t EQN_32_POINTS[302] = {
+  0x005e00b, 0x105f012, 0x1060019, 0x1062020, 0x1060026, 0x105e02c, 0x105c031, 0x1054034,
+  0x104c037, 0x104503a, 0x103e038, 0x1036036, 0x102f034, 0x1027032, 0x102002c, 0x1019026,
+  0x101701f, 0x1014017, 0x1017011, 0x101a00b, 0x101c005, 0x1022004, 0x1028002, 0x102d000,
+  0x1034003, 0x103b006, 0x1041008, 0x104400e, 0x1047014, 0x104b01a, 0x104a021, 0x1049028,
+  0x104802f, 0x1047036, 0x004203e, 0x003d045, 0x003804d, 0x0033054, 0x002e05c, 0x0028063,
+  0x102305f, 0x101d05b, 0x1017057, 0x1011052, 0x100b04d, 0x1006049, 0x1000044, 0x0007045,
+  0x000e045, 0x0014045, 0x001b045, 0x0022045, 0x0028045, 0x1023049, 0x101d04d, 0x1018052,
+  0x1013056, 0x100d05a, 0x100705f, 0x1000063, 0x000806a, 0x000f070, 0x0017076, 0x001e07c,
+  0x0025082, 0x002d088, 0x003408e, 0x003b094, 0x103b09b, 0x103b0a2, 0x103b0a9, 0x103b0af,
+  0x103c0b7, 0x103c0bf, 0x103c0c7, 0x103c0ce, 0x10430cd, 0x104a0cc, 0x10510cb, 0x10560c6,
+  0x105b0c0, 0x10600ba, 0x105f0b3, 0x105e0ac, 0x105e0a4, 0x105709d, 0x1050095, 0x1048094,
+  0x1041093, 0x1039092, 0x1033095, 0x102c097, 0x1025099, 0x10230a0, 0x10200a6, 0x101d0ac,
+  0x101a0b2, 0x101d0ba, 0x101f0c1, 0x10220c9, 0x10240d0, 0x002c0d5, 0x00340d9, 0x003b0de,
+  0x00430e2, 0x004a0e7, 0x00510eb, 0x00590f0, 0x00600f4, 0x00680f9, 0x00700fd, 0x0077102,
+  0x007f106, 0x008710a, 0x1081106, 0x107c101, 0x10760fd, 0x10700f8, 0x106a0f3, 0x10640ef,
+  0x105f0ea, 0x00650eb, 0x006c0eb, 0x00730eb, 0x00790ec, 0x00800ec, 0x00870ec, 0x10810f0,
+  0x107c0f4, 0x10760f9, 0x10710fd, 0x106c101, 0x1065105, 0x105f109, 0x005b111, 0x0058118,
+  0x0055120, 0x0051127, 0x004e12f, 0x004b137, 0x004813f, 0x1048146, 0x104814e, 0x1048156,
+  0x104815d, 0x1048164, 0x104816c, 0x0043164, 0x004015d, 0x003c156, 0x003814e, 0x0034147,
+  0x002f140, 0x102f147, 0x102f14e, 0x102f156, 0x102f15d, 0x102f164, 0x102f16c, 0x0031173,
+  0x003217b, 0x0033182, 0x003418a, 0x0036191, 0x0037199, 0x00381a0, 0x00391a8, 0x003a1b0,
+  0x103a1b6, 0x103a1bd, 0x103a1c4, 0x103a1cb, 0x103b1d2, 0x103b1da, 0x103b1e2, 0x103b1ea,
+  0x10421e8, 0x10491e7, 0x10501e6, 0x10551e0, 0x105a1db, 0x105f1d6, 0x105e1ce, 0x105d1c7,
+  0x105d1c0, 0x10561b8, 0x104f1b1, 0x10471b0, 0x10401af, 0x10381ae, 0x10321b0, 0x102b1b2,
+  0x10241b5, 0x10221bb, 0x101f1c1, 0x101c1c7, 0x10191ce, 0x101c1d5, 0x101e1dd, 0x10201e4,
+  0x10221ec, 0x002a1f0, 0x00321f4, 0x003a1f9, 0x00411fd, 0x0048202, 0x0050206, 0x005720b,
+  0x005f20f, 0x0067214, 0x006e218, 0x007621d, 0x007e221, 0x0086226, 0x1080221, 0x107b21d,
+  0x1075218, 0x106f213, 0x106920f, 0x106320a, 0x105e206, 0x0064206, 0x006b206, 0x0072206,
+  0x0078206, 0x007f206, 0x0086207, 0x108020b, 0x107b210, 0x1075214, 0x1070218, 0x106b21d,
+  0x1064221, 0x105e225, 0x005e21d, 0x005e215, 0x005e20d, 0x005e205, 0x005e1fd, 0x005e1f5,
+  0x005e1ed, 0x005e1e5, 0x005e1dd, 0x005e1d5, 0x005e1cd, 0x005e1c6, 0x005e1be, 0x005e1b6,
+  0x005e1ae, 0x005e1a6, 0x005e19e, 0x005e196, 0x005e18e, 0x005e186, 0x005e17e, 0x005e176,
+  0x005e16f, 0x005e167, 0x005e15f, 0x005e157, 0x005e14f, 0x005e147, 0x005e13f, 0x005e137,
+  0x005e12f, 0x005e127, 0x005e11f, 0x005e118, 0x005e111, 0x005e109, 0x005e101, 0x005e0f9,
+  0x005e0f1, 0x005e0e9, 0x005e0e1, 0x005e0d9, 0x005e0d1, 0x005e0c9, 0x005e0c1, 0x005e0ba,
+  0x005e0b2, 0x005e0aa, 0x005e0a2, 0x005e09a, 0x005e092, 0x005e08a, 0x005e082, 0x005e07a,
+  0x005e072, 0x005e06a, 0x005e063, 0x005e05b, 0x005e053, 0x005e04b, 0x005e043, 0x005e03b,
+  0x005e033, 0x005e02b, 0x005e023, 0x005e01b, 0x005e013, 0x005e00b,
+};
+
+static constexpr uint32_t EQN_33_POINTS[337] = {
+  0x0003000, 0x1002005, 0x100100a, 0x100400f, 0x1007014, 0x100e016, 0x1015018, 0x101c018,
+  0x1023018, 0x102a018, 0x1031018, 0x1038018, 0x103e018, 0x1045018, 0x104c017, 0x1052018,
+  0x1058018, 0x105f018, 0x1065019, 0x106b01a, 0x107101b, 0x1076020, 0x107c024, 0x107b02a,
+  0x107a030, 0x0077037, 0x007403e, 0x0071045, 0x006e04c, 0x006b053, 0x006805a, 0x0065060,
+  0x1069065, 0x106e06a, 0x106806a, 0x106306a, 0x105e06a, 0x105706a, 0x105106a, 0x0051065,
+  0x0051060, 0x1051065, 0x105106a, 0x105106f, 0x1051073, 0x004c06d, 0x0048066, 0x004305f,
+  0x003f058, 0x003b051, 0x003604a, 0x1036052, 0x1036059, 0x1036060, 0x1036067, 0x103606f,
+  0x1036077, 0x103607f, 0x1036086, 0x002f081, 0x002807b, 0x0021075, 0x101c072, 0x101706e,
+  0x1011069, 0x100a064, 0x1005060, 0x100005b, 0x000705c, 0x000e05c, 0x001405c, 0x001b05c,
+  0x002105c, 0x101c060, 0x1017064, 0x1011069, 0x100a06e, 0x1005072, 0x1000075, 0x000807d,
+  0x000f084, 0x001608c, 0x001d093, 0x002409a, 0x002b0a2, 0x00320a9, 0x00390b0, 0x003f0b8,
+  0x00460bf, 0x004e0c6, 0x10480c6, 0x10430c5, 0x103d0c6, 0x10360c6, 0x10310c4, 0x102c0c2,
+  0x10280bb, 0x102a0b6, 0x102b0b1, 0x10300af, 0x10350ad, 0x103a0af, 0x103e0b1, 0x10400b7,
+  0x10430bc, 0x10430c0, 0x10430c4, 0x00430cb, 0x00440d2, 0x00450d9, 0x00460e0, 0x00470e7,
+  0x00480ed, 0x10430e9, 0x103e0e5, 0x10380e0, 0x10310db, 0x102c0d7, 0x10270d3, 0x002e0d3,
+  0x00350d3, 0x003b0d3, 0x00410d3, 0x00480d3, 0x10430d8, 0x103e0dc, 0x10370e1, 0x10300e5,
+  0x102c0e9, 0x10270ed, 0x002b0f5, 0x002f0fc, 0x0033103, 0x003710b, 0x003b112, 0x003e118,
+  0x0042120, 0x1042125, 0x104212a, 0x104212f, 0x1042134, 0x003e12d, 0x003b126, 0x0037120,
+  0x1037125, 0x103712a, 0x103712f, 0x1037134, 0x003e139, 0x004613e, 0x004d143, 0x0055148,
+  0x005c14d, 0x0064153, 0x105d153, 0x1056153, 0x1050153, 0x1049153, 0x1043153, 0x103d153,
+  0x1037153, 0x1031153, 0x102b153, 0x102b159, 0x102b15f, 0x102b166, 0x102b16c, 0x102b173,
+  0x0032176, 0x0039179, 0x003f17c, 0x0046180, 0x1047185, 0x104918b, 0x104718f, 0x1046193,
+  0x1041195, 0x103c198, 0x1037197, 0x1031197, 0x102d190, 0x1029189, 0x102d183, 0x103017e,
+  0x103517c, 0x103a17a, 0x104017d, 0x1046180, 0x0043187, 0x004118f, 0x003f196, 0x003e19e,
+  0x003c1a5, 0x003a1ad, 0x00381b4, 0x00361bc, 0x00331c4, 0x10311bd, 0x102e1b7, 0x10311b0,
+  0x10331aa, 0x103b1aa, 0x10421ab, 0x10461b1, 0x104a1b8, 0x10461be, 0x10421c5, 0x103c1c6,
+  0x10351c7, 0x10301c7, 0x102b1c8, 0x10251c6, 0x101f1c5, 0x101b1bf, 0x10161ba, 0x10191b4,
+  0x101b1af, 0x101d1aa, 0x001d1b1, 0x001c1b8, 0x001b1bf, 0x001a1c6, 0x00191cd, 0x00181d4,
+  0x00171db, 0x10171e0, 0x10171e6, 0x10171eb, 0x10171f1, 0x101b1f0, 0x101f1f0, 0x10241ea,
+  0x10241e5, 0x10241e1, 0x101f1dc, 0x101b1db, 0x10161db, 0x10121dc, 0x100e1dd, 0x100c1e2,
+  0x100a1e7, 0x100c1ec, 0x100e1f2, 0x00161f8, 0x001d1fe, 0x0024205, 0x002b20b, 0x0032211,
+  0x0039218, 0x003f21e, 0x0047225, 0x1042221, 0x103d21e, 0x1037219, 0x1030214, 0x102b210,
+  0x102620c, 0x002d20c, 0x003420c, 0x003a20c, 0x004020c, 0x004720c, 0x1042210, 0x103d214,
+  0x1037219, 0x103021e, 0x102b222, 0x1026226, 0x002621e, 0x0025216, 0x002520e, 0x0024206,
+  0x00241fe, 0x00231f6, 0x00231ee, 0x00221e6, 0x00221de, 0x00211d6, 0x00211ce, 0x00201c6,
+  0x00201be, 0x001f1b6, 0x001f1ae, 0x001e1a6, 0x001e19e, 0x001d196, 0x001d18e, 0x001c186,
+  0x001c17e, 0x001b176, 0x001b16e, 0x001a166, 0x001a15e, 0x0019156, 0x001914e, 0x0018146,
+  0x001813e, 0x0017136, 0x001712e, 0x0016126, 0x001611e, 0x0015116, 0x0015110, 0x0014108,
+  0x0014100, 0x00130f8, 0x00130f0, 0x00120e8, 0x00120e0, 0x00110d8, 0x00110d0, 0x00100c8,
+  0x00100c0, 0x000f0b8, 0x000f0b0, 0x000e0a8, 0x000e0a0, 0x000d098, 0x000d090, 0x000c088,
+  0x000c080, 0x000b078, 0x000b070, 0x000a068, 0x000a060, 0x0009058, 0x0009050, 0x0008048,
+  0x0008040, 0x0007038, 0x0007030, 0x0006028, 0x0006020, 0x0005018, 0x0005010, 0x0004008,
+  0x0003000,
+};
+
+static constexpr uint32_t EQN_34_POINTS[728] = {
+  0x0224068, 0x122406f, 0x1225076, 0x122607c, 0x1225084, 0x122508b, 0x1225092, 0x122509a,
+  0x12250a1, 0x12250a8, 0x12250b0, 0x12250b7, 0x12250be, 0x12250c6, 0x12250ce, 0x12250d6,
+  0x12250dd, 0x12250e5, 0x12250ec, 0x12250f3, 0x12250fb, 0x1225103, 0x122510a, 0x1225112,
+  0x122511a, 0x1225121, 0x1225129, 0x1225131, 0x1225138, 0x1225140, 0x1225148, 0x122514f,
+  0x1225157, 0x122515f, 0x1225167, 0x122516e, 0x1225175, 0x122517c, 0x1225183, 0x122518a,
+  0x1225191, 0x1225198, 0x122519f, 0x12251a7, 0x12241ae, 0x12231b6, 0x12221bd, 0x12221c5,
+  0x121d1c9, 0x12181cd, 0x12111ce, 0x120a1cf, 0x12031d0, 0x11fc1d1, 0x11f41d0, 0x11ed1cf,
+  0x11e61ce, 0x11df1ce, 0x11da1ca, 0x11d51c7, 0x11d31c0, 0x11d11b9, 0x11cf1b3, 0x11cf1ac,
+  0x11cf1a5, 0x11cf19e, 0x11cf197, 0x11cf190, 0x11cf189, 0x11cf182, 0x11cf17b, 0x11ce175,
+  0x11cd16f, 0x11cc169, 0x11cb163, 0x11c5160, 0x11bf15e, 0x11ba15c, 0x11b215b, 0x11ab15b,
+  0x11a415a, 0x119d15a, 0x119615a, 0x118e159, 0x1186158, 0x117f158, 0x1177157, 0x116f156,
+  0x1168156, 0x1160155, 0x1159155, 0x1152155, 0x114b155, 0x1144155, 0x113c154, 0x1135154,
+  0x112e154, 0x1127154, 0x1120154, 0x1118154, 0x1112155, 0x110b155, 0x1103156, 0x10fc156,
+  0x10f5157, 0x10ee157, 0x10e6158, 0x10e115c, 0x10db160, 0x10d5165, 0x10d216c, 0x10cf173,
+  0x10cc17a, 0x10c9182, 0x10cc188, 0x10ce18e, 0x10d0194, 0x10d219a, 0x10da19e, 0x10e11a2,
+  0x10e81a7, 0x10ef1ab, 0x10f61b0, 0x10f81b6, 0x10fa1bc, 0x10fb1c3, 0x10f71c7, 0x10f21cc,
+  0x10ec1cb, 0x10e51ca, 0x10de1c9, 0x10d71c8, 0x10d01c7, 0x10c91c6, 0x10c21c6, 0x10bb1c2,
+  0x10b31bf, 0x10ab1bc, 0x10a41b8, 0x109c1b5, 0x10941b2, 0x108e1ab, 0x10871a4, 0x108119e,
+  0x107a197, 0x1073191, 0x1071189, 0x106e181, 0x106c17a, 0x1069172, 0x106616b, 0x1067163,
+  0x106815c, 0x1069155, 0x106914e, 0x106e146, 0x107313f, 0x1078137, 0x107d130, 0x1082129,
+  0x108a125, 0x1091121, 0x109811d, 0x109f119, 0x10a6116, 0x10ae114, 0x10b5112, 0x10bc111,
+  0x10c310f, 0x10ca10d, 0x10d110c, 0x10d910b, 0x10e010b, 0x10e810a, 0x10ef10a, 0x10f7109,
+  0x10fe109, 0x1106109, 0x110d109, 0x111410a, 0x111b10a, 0x112310a, 0x112a10b, 0x113210b,
+  0x113910b, 0x114110c, 0x114810c, 0x114f10d, 0x115610e, 0x115e10e, 0x116510f, 0x116c110,
+  0x1174111, 0x117b111, 0x1182112, 0x118a113, 0x1191114, 0x1199114, 0x11a0115, 0x11a8116,
+  0x11af117, 0x11b7118, 0x11bc118, 0x11c2119, 0x11c7115, 0x11cd112, 0x11ce10b, 0x11cf104,
+  0x11d00fd, 0x11d10f6, 0x11d00ee, 0x11d00e8, 0x11cf0e1, 0x11cf0da, 0x11cf0d2, 0x11cd0cb,
+  0x11cb0c4, 0x11ca0bd, 0x11c30bd, 0x11bd0bc, 0x11b70bb, 0x11b10ba, 0x11a90ba, 0x11a20b9,
+  0x119a0b9, 0x11930b8, 0x118c0b8, 0x11840b7, 0x117d0b7, 0x11760b6, 0x116e0b6, 0x11660b6,
+  0x115f0b5, 0x11570b5, 0x114f0b5, 0x11480b4, 0x11400b4, 0x11380b3, 0x11300b2, 0x11280b1,
+  0x11210b0, 0x11190af, 0x11120ae, 0x110a0ad, 0x11020ac, 0x10fb0ab, 0x10f40a9, 0x10ed0a8,
+  0x10e60a6, 0x10de0a5, 0x10d70a3, 0x10d00a2, 0x10c90a0, 0x10c209f, 0x10ba09d, 0x10b309b,
+  0x10ab098, 0x10a4095, 0x109c092, 0x109408f, 0x108d08a, 0x1085084, 0x107e07e, 0x1076078,
+  0x106e072, 0x106d06b, 0x106c064, 0x106a05d, 0x1069056, 0x106704e, 0x106d048, 0x1072042,
+  0x107703b, 0x107c035, 0x108102e, 0x108802e, 0x108f02e, 0x109602e, 0x109d02e, 0x10a402e,
+  0x10aa02e, 0x10b1032, 0x10b8036, 0x10be039, 0x10c503d, 0x10cc041, 0x10d2044, 0x10d9049,
+  0x10e004d, 0x10e7051, 0x10ee055, 0x10f5059, 0x10fc05d, 0x1104060, 0x110c062, 0x1113064,
+  0x111b067, 0x1122069, 0x112a06b, 0x113206e, 0x113a070, 0x1142072, 0x1149073, 0x1150074,
+  0x1157075, 0x115e076, 0x1166076, 0x116d077, 0x1174078, 0x117b079, 0x118207a, 0x118a07a,
+  0x119107b, 0x119907c, 0x11a007c, 0x11a807d, 0x11af07e, 0x11b707e, 0x11be07f, 0x11c607f,
+  0x11cd07b, 0x11cd076, 0x11ce070, 0x11cf06a, 0x11cc064, 0x11ca05d, 0x11c8056, 0x11c604f,
+  0x11c4048, 0x11bd041, 0x11b703a, 0x11af035, 0x11a802f, 0x11a1029, 0x119a023, 0x119501c,
+  0x1191014, 0x119100e, 0x1191007, 0x1196004, 0x119b000, 0x11a1000, 0x11a7000, 0x11ad002,
+  0x11b3004, 0x11ba006, 0x11c0008, 0x11c7009, 0x11ce00e, 0x11d5012, 0x11dc016, 0x11e301b,
+  0x11ea01f, 0x11f1023, 0x11f9027, 0x11ff02f, 0x1206036, 0x120c03e, 0x1213045, 0x121a04c,
+  0x121c053, 0x121f05a, 0x1221061, 0x1224068, 0x021c067, 0x0214065, 0x020c064, 0x0204062,
+  0x01fc061, 0x01f405f, 0x01ec05e, 0x01e405c, 0x01dc05b, 0x01d4059, 0x01cc058, 0x01c4056,
+  0x01bc055, 0x01b5053, 0x01ad052, 0x01a5050, 0x019d04f, 0x019504d, 0x018d04c, 0x018504a,
+  0x017d049, 0x0175047, 0x016d046, 0x0165044, 0x015d043, 0x0155041, 0x014d040, 0x014603e,
+  0x013e03d, 0x013603b, 0x012e03a, 0x0126038, 0x011e037, 0x0116035, 0x010f034, 0x0107032,
+  0x00ff031, 0x00f702f, 0x00ef02e, 0x00e702c, 0x00df02b, 0x00d8029, 0x00d0028, 0x00c8026,
+  0x00c0025, 0x00b8023, 0x00b0022, 0x00a8020, 0x00a001f, 0x009801d, 0x009001c, 0x008801a,
+  0x0080019, 0x0078017, 0x0070016, 0x0069014, 0x0061013, 0x0059011, 0x0051010, 0x004900e,
+  0x004100d, 0x003900b, 0x003100a, 0x0029008, 0x0021007, 0x0019005, 0x0011004, 0x0009002,
+  0x0001000, 0x1008002, 0x100f004, 0x1016005, 0x101d007, 0x1024008, 0x102b00a, 0x103100b,
+  0x102a00f, 0x1023012, 0x101c015, 0x1015018, 0x100e01b, 0x100701e, 0x100e022, 0x1015025,
+  0x101c028, 0x102302b, 0x102a02e, 0x1030031, 0x1029033, 0x1021035, 0x1019036, 0x1011038,
+  0x100903a, 0x100103b, 0x0001041, 0x0001047, 0x000104d, 0x1007050, 0x100d053, 0x1012055,
+  0x1018058, 0x101d05b, 0x102205d, 0x1029060, 0x102f063, 0x1029066, 0x1022069, 0x101b06d,
+  0x1014070, 0x100e073, 0x1008076, 0x1001079, 0x0004072, 0x000706b, 0x0009063, 0x000c05c,
+  0x000e054, 0x100e05a, 0x100e05f, 0x100e064, 0x100e06b, 0x100e072, 0x0015079, 0x001c080,
+  0x0023087, 0x002a08e, 0x0031094, 0x102a094, 0x1022094, 0x101a094, 0x1014094, 0x100e094,
+  0x1008094, 0x1002094, 0x0009093, 0x0010091, 0x0017090, 0x001e08e, 0x002508d, 0x002c08b,
+  0x0032089, 0x103208f, 0x1032094, 0x103209a, 0x10320a0, 0x00330a7, 0x00330ad, 0x00330b3,
+  0x102c0b3, 0x10240b3, 0x10200b3, 0x101c0b3, 0x10180b3, 0x10140b3, 0x100e0b3, 0x10080b3,
+  0x10020b3, 0x00090b8, 0x00100bd, 0x00170c1, 0x001e0c6, 0x00250ca, 0x002c0cf, 0x00330d3,
+  0x102c0d3, 0x10240d3, 0x10200d3, 0x101b0d2, 0x10170d3, 0x10120d3, 0x100d0d3, 0x10070d3,
+  0x10010d3, 0x00070cd, 0x000c0c7, 0x00120c0, 0x00170ba, 0x001c0b3, 0x101c0bb, 0x101c0c2,
+  0x101c0c8, 0x101c0cd, 0x101c0d2, 0x001a0da, 0x00180e1, 0x00150e8, 0x00130ef, 0x00100f6,
+  0x000e0fe, 0x000b105, 0x000910c, 0x0006114, 0x100210d, 0x1001107, 0x1000101, 0x10020fb,
+  0x10040f6, 0x10060f1, 0x100b0ed, 0x10100ea, 0x10160e9, 0x101b0e9, 0x101f0e9, 0x10230ea,
+  0x10290ee, 0x102f0f2, 0x10320f8, 0x10340fe, 0x1034103, 0x1034108, 0x103110e, 0x102e114,
+  0x0027118, 0x002011c, 0x0019120, 0x0012124, 0x000b128, 0x000412d, 0x100a12f, 0x1010132,
+  0x1016135, 0x101c137, 0x102113a, 0x102613d, 0x102d140, 0x1033143, 0x102d146, 0x1026149,
+  0x101f14c, 0x101814f, 0x1012152, 0x100b155, 0x1004159, 0x0007151, 0x000a149, 0x000c142,
+  0x000f13a, 0x0011133, 0x1011138, 0x101113e, 0x1011144, 0x101114b, 0x1011152, 0x000d159,
+  0x0008160, 0x0003168, 0x100a169, 0x101116b, 0x101816c, 0x101f16e, 0x102616f, 0x102d171,
+  0x1034173, 0x102d176, 0x1026179, 0x101f17c, 0x101817f, 0x1011182, 0x100a186, 0x1011189,
+  0x101818c, 0x101f18f, 0x1026192, 0x102d195, 0x1033199, 0x102d19a, 0x102619b, 0x101f19d,
+  0x101819e, 0x10111a0, 0x100a1a1, 0x10031a3, 0x000a1a8, 0x00101ad, 0x00161b2, 0x001c1b7,
+  0x101c1bb, 0x101c1c0, 0x101d1c4, 0x101d1c8, 0x10211cc, 0x10281ce, 0x102e1cc, 0x10321c7,
+  0x10331c0, 0x10331bb, 0x10321b6, 0x102e1b6, 0x102a1b6, 0x10231b6, 0x101b1b6, 0x10151b6,
+  0x100f1b6, 0x10091b6, 0x10031b6, 0x000b1b1, 0x00131ac, 0x001b1a7, 0x00231a2, 0x002b19d,
+  0x0033198, 0x003b194, 0x004318f, 0x004b18a, 0x0052185, 0x005a180, 0x006217b, 0x006a177,
+  0x0072172, 0x007a16d, 0x0082168, 0x008a163, 0x009215e, 0x009a15a, 0x00a1155, 0x00a9150,
+  0x00b114b, 0x00b9146, 0x00c1141, 0x00c913c, 0x00d1138, 0x00d9133, 0x00e112e, 0x00e9129,
+  0x00f0124, 0x00f811f, 0x010011b, 0x0108116, 0x0110111, 0x011710c, 0x011f107, 0x0127102,
+  0x012f0fe, 0x01370f9, 0x013e0f4, 0x01460ef, 0x014e0ea, 0x01560e6, 0x015e0e2, 0x01660dd,
+  0x016e0d8, 0x01760d3, 0x017e0ce, 0x01860c9, 0x018d0c4, 0x01950c0, 0x019d0bb, 0x01a50b6,
+  0x01ad0b1, 0x01b50ac, 0x01bd0a7, 0x01c50a3, 0x01cd09e, 0x01d5099, 0x01dc094, 0x01e408f,
+  0x01ec08a, 0x01f4086, 0x01fc081, 0x020407c, 0x020c077, 0x0214072, 0x021c06d, 0x0224068,
+};
+
+static constexpr uint32_t EQN_35_POINTS[539] = {
+  0x01f8000, 0x11ff002, 0x1206003, 0x120d004, 0x1214006, 0x121b007, 0x1223008, 0x121b00c,
+  0x1214010, 0x120c013, 0x1205017, 0x11fe01a, 0x120501e, 0x120c021, 0x1214024, 0x121b027,
+  0x122302a, 0x121b02c, 0x121402e, 0x120d02f, 0x1206031, 0x11ff033, 0x11f8034, 0x01f803c,
+  0x01f8043, 0x11fd046, 0x1202048, 0x120804a, 0x120f04e, 0x1216051, 0x121b054, 0x1221057,
+  0x121b05a, 0x121605c, 0x121005f, 0x120a062, 0x1204065, 0x11fe068, 0x11f806a, 0x01fa064,
+  0x01fc05d, 0x01ff057, 0x0201050, 0x0204049, 0x1204050, 0x1204057, 0x120405e, 0x1204064,
+  0x020b06c, 0x0213073, 0x021b07b, 0x0223082, 0x121c082, 0x1215082, 0x120f082, 0x1207082,
+  0x1200082, 0x11f9082, 0x0200081, 0x020707f, 0x020e07d, 0x021507c, 0x021c07a, 0x0224078,
+  0x122407d, 0x1224082, 0x1224087, 0x122408c, 0x0224092, 0x0224098, 0x022509d, 0x121e09d,
+  0x121709d, 0x121009d, 0x120909d, 0x120109d, 0x11fa09d, 0x02010a2, 0x02080a7, 0x020f0ab,
+  0x02160b0, 0x021d0b5, 0x02250b9, 0x121e0b9, 0x12170b9, 0x12100b9, 0x120c0b9, 0x12080b9,
+  0x12000b9, 0x11f90b9, 0x01ff0b2, 0x02050ab, 0x020b0a4, 0x021109d, 0x12110a4, 0x12110ab,
+  0x12100b2, 0x12100b9, 0x020d0c1, 0x020b0c8, 0x02080ce, 0x02060d6, 0x02040dd, 0x02010e4,
+  0x01ff0eb, 0x01fd0f3, 0x11fa0ec, 0x11f90e7, 0x11f80e2, 0x11fa0db, 0x11fd0d4, 0x12010d1,
+  0x12060ce, 0x120b0cd, 0x12100cd, 0x12170cd, 0x121c0d1, 0x12220d5, 0x12240da, 0x12260e0,
+  0x12260e4, 0x12260e9, 0x12230ee, 0x12210f3, 0x02190f7, 0x02120fb, 0x020a100, 0x0203104,
+  0x01fc109, 0x120310c, 0x120b110, 0x1212113, 0x1219117, 0x121f119, 0x122511c, 0x121f11f,
+  0x1219122, 0x1213124, 0x120d127, 0x120712a, 0x120112d, 0x11fc130, 0x01fe129, 0x0200122,
+  0x020211c, 0x0204115, 0x020710f, 0x1207116, 0x120711d, 0x1207123, 0x120712a, 0x0203130,
+  0x01ff137, 0x01fb13e, 0x120213f, 0x1209141, 0x1210142, 0x1217144, 0x121e145, 0x1226147,
+  0x121e14a, 0x121614d, 0x120f151, 0x1207154, 0x1200158, 0x120715b, 0x120e15e, 0x1216162,
+  0x121d165, 0x1225169, 0x121e16a, 0x121716c, 0x121016d, 0x120916f, 0x1202170, 0x11fb172,
+  0x0202177, 0x020917d, 0x0210183, 0x1210187, 0x121018b, 0x1212192, 0x1215196, 0x121b197,
+  0x1220196, 0x1224191, 0x122518b, 0x1224186, 0x1224182, 0x121d182, 0x1216182, 0x1210182,
+  0x1209182, 0x1202182, 0x11fb182, 0x01f617a, 0x01f1172, 0x01ec16b, 0x01e7163, 0x01e215c,
+  0x01dd154, 0x01d814c, 0x01d3145, 0x01ce13d, 0x01ca136, 0x11c3133, 0x11bd130, 0x11b712d,
+  0x11b112b, 0x11a9125, 0x11a2120, 0x119a11b, 0x1193116, 0x118b112, 0x118410e, 0x117c10a,
+  0x1175106, 0x116d102, 0x11650ff, 0x115e0fc, 0x11560f9, 0x114f0f6, 0x11470f3, 0x11400f0,
+  0x11390ee, 0x11320ed, 0x112b0ec, 0x11240ea, 0x111d0e9, 0x11160e8, 0x11100e7, 0x11090e7,
+  0x11020e8, 0x10fb0e8, 0x10f40e9, 0x10ed0e9, 0x10e60ea, 0x10df0ea, 0x10d80eb, 0x10d10ec,
+  0x10ca0ee, 0x10c30f0, 0x10bc0f2, 0x10b40f4, 0x10ad0f6, 0x10a60f8, 0x109f0fa, 0x10970fc,
+  0x10900fe, 0x1089101, 0x1082103, 0x107b106, 0x1074108, 0x106d10b, 0x106610e, 0x105f111,
+  0x1058114, 0x1050117, 0x104a119, 0x104311c, 0x103c11f, 0x1036122, 0x102f125, 0x1028128,
+  0x1022129, 0x101b12b, 0x101412d, 0x100e12e, 0x1007130, 0x1000132, 0x100812d, 0x100f128,
+  0x1016123, 0x101d11e, 0x102511a, 0x102d116, 0x1034112, 0x103c10e, 0x104410a, 0x104b107,
+  0x1052103, 0x1059100, 0x10600fc, 0x10670f9, 0x106f0f6, 0x10760f3, 0x107d0f0, 0x10840ed,
+  0x108b0ea, 0x10920e7, 0x109a0e4, 0x10a20e2, 0x10aa0df, 0x10b10dd, 0x10b90da, 0x10c10d8,
+  0x10c90d5, 0x10d00d3, 0x10d80d2, 0x10df0d1, 0x10e60d0, 0x10ed0cf, 0x10f40cf, 0x10fb0ce,
+  0x11020cd, 0x11090cc, 0x11100cc, 0x11170cd, 0x111e0cf, 0x11250d1, 0x112c0d3, 0x11330d5,
+  0x113a0d7, 0x11410d9, 0x11480db, 0x114f0df, 0x11570e3, 0x115f0e7, 0x11670ec, 0x116f0f0,
+  0x11770f4, 0x117f0f9, 0x11860fd, 0x118d102, 0x1194107, 0x119b10c, 0x11a1110, 0x11a8115,
+  0x11ae11a, 0x11b511f, 0x11bc126, 0x11c312e, 0x11ca136, 0x01c212e, 0x01bb126, 0x01b411e,
+  0x01ad116, 0x01a610e, 0x019f106, 0x01980fe, 0x01910f6, 0x018a0ee, 0x01830e6, 0x017c0de,
+  0x01750d6, 0x016e0ce, 0x01670c7, 0x01600bf, 0x11670ba, 0x116e0b4, 0x11750af, 0x117d0a9,
+  0x11840a4, 0x118b09f, 0x119309a, 0x1199097, 0x119f094, 0x11a6091, 0x11a9097, 0x11ac09d,
+  0x11b00a2, 0x11b20a7, 0x11b50ac, 0x11b60b2, 0x11b70b8, 0x11b90be, 0x11b70c4, 0x11b60ca,
+  0x11b50d0, 0x11b30d4, 0x11b10d9, 0x11ac0df, 0x11a80e6, 0x11a40ed, 0x119d0e9, 0x11960e5,
+  0x11900e2, 0x118a0dd, 0x11840d9, 0x117e0d5, 0x11760cf, 0x116f0ca, 0x11670c5, 0x11600bf,
+  0x01660b8, 0x016d0b0, 0x01730a9, 0x017a0a1, 0x018109a, 0x0187092, 0x018e08b, 0x0195083,
+  0x019b07c, 0x01a2074, 0x01a806d, 0x01af065, 0x01b605e, 0x01bc056, 0x01c304f, 0x01ca047,
+  0x11c204f, 0x11bb057, 0x11b405e, 0x11ad064, 0x11a6069, 0x119f06e, 0x1199073, 0x1191078,
+  0x118a07d, 0x1182082, 0x117b087, 0x117408b, 0x116d08f, 0x1166093, 0x115f097, 0x115809b,
+  0x115109e, 0x114a0a1, 0x11440a4, 0x113d0a6, 0x11370a9, 0x11310ab, 0x112a0ad, 0x11230ae,
+  0x111c0af, 0x11150b0, 0x110e0b1, 0x11070b2, 0x11010b2, 0x10fb0b1, 0x10f50b1, 0x10ef0b0,
+  0x10e90af, 0x10e20ae, 0x10dc0ad, 0x10d50ac, 0x10ce0aa, 0x10c70a8, 0x10c00a6, 0x10b90a3,
+  0x10b20a1, 0x10ab09f, 0x10a409c, 0x109d09a, 0x1096098, 0x108e095, 0x1087092, 0x107f08e,
+  0x107708b, 0x1070087, 0x1068084, 0x1060080, 0x105907d, 0x1051079, 0x1049075, 0x1042071,
+  0x103b06d, 0x1033069, 0x102c065, 0x1025061, 0x101d05d, 0x1016059, 0x100e055, 0x1007051,
+  0x100004c, 0x100804d, 0x100f04e, 0x101604e, 0x101e051, 0x1025054, 0x102c057, 0x103305a,
+  0x103a05c, 0x104105f, 0x1047062, 0x104e065, 0x1054068, 0x105c06b, 0x106406e, 0x106c071,
+  0x1074074, 0x107b077, 0x108307a, 0x108b07d, 0x1093080, 0x109a082, 0x10a2084, 0x10a9086,
+  0x10b1088, 0x10b808a, 0x10bf08c, 0x10c708e, 0x10ce090, 0x10d5092, 0x10dc093, 0x10e2094,
+  0x10e9095, 0x10ef096, 0x10f5096, 0x10fc097, 0x1103097, 0x110a097, 0x1110097, 0x1117096,
+  0x111e095, 0x1125094, 0x112d093, 0x1133091, 0x113908f, 0x114008d, 0x114608b, 0x114d089,
+  0x1154086, 0x115c083, 0x1164080, 0x116c07c, 0x1173078, 0x117a074, 0x1181070, 0x118806c,
+  0x1190068, 0x1196064, 0x119d05f, 0x11a305b, 0x11aa056, 0x11b0053, 0x11b6050, 0x11bd04d,
+  0x11c304a, 0x11ca047, 0x01cf040, 0x01d4038, 0x01d9030, 0x01de028, 0x01e3020, 0x01e8018,
+  0x01ed010, 0x01f2008, 0x01f8000,
+};
+
+static constexpr uint32_t EQN_36_POINTS[857] = {
+  0x005521f, 0x104f222, 0x104a225, 0x1043225, 0x103b225, 0x1033225, 0x102b225, 0x1023226,
+  0x101d21f, 0x1017218, 0x1010212, 0x101020b, 0x100f205, 0x100f1fe, 0x100f1f7, 0x100f1f0,
+  0x100f1e9, 0x100f1e2, 0x100e1dc, 0x100f1d5, 0x10101cf, 0x10111c9, 0x10121c3, 0x10191bd,
+  0x10201b7, 0x10271b5, 0x102e1b3, 0x10341b2, 0x103c1b3, 0x10431b4, 0x104a1b5, 0x10501b8,
+  0x10561bc, 0x105c1bc, 0x10631bd, 0x10691be, 0x10701bf, 0x106f1c6, 0x106f1cd, 0x10681d2,
+  0x10611d8, 0x105a1de, 0x10591e2, 0x10591e7, 0x10591ed, 0x10591f3, 0x105a1f9, 0x105e1fe,
+  0x1062203, 0x1068208, 0x106f20e, 0x106f212, 0x106f216, 0x106f21c, 0x106821c, 0x106221d,
+  0x105b21e, 0x105521f, 0x0051217, 0x004e210, 0x004c209, 0x0049201, 0x00461fa, 0x00431f3,
+  0x00401eb, 0x003d1e4, 0x003a1dd, 0x00361d6, 0x10361ce, 0x10361c7, 0x103e1c7, 0x10451c7,
+  0x10451ce, 0x10451d6, 0x103e1d6, 0x10361d6, 0x00371dd, 0x00371e5, 0x00371ed, 0x00371f5,
+  0x00371fc, 0x0037204, 0x003720c, 0x0037214, 0x103720e, 0x1037209, 0x1037204, 0x103f204,
+  0x1046204, 0x1046209, 0x104620e, 0x1045214, 0x103e214, 0x1037214, 0x003620c, 0x0035205,
+  0x00331fe, 0x00321f7, 0x00311ef, 0x002f1e8, 0x002e1e1, 0x002c1da, 0x10261da, 0x10201da,
+  0x10201e0, 0x10201e6, 0x10201ed, 0x10201f3, 0x10201fa, 0x1020201, 0x1027201, 0x102d201,
+  0x002d1fa, 0x002d1f3, 0x002d1ed, 0x10271ed, 0x10211ed, 0x00291ef, 0x00311f1, 0x00381f4,
+  0x00401f6, 0x00481f8, 0x004f1fb, 0x00561fd, 0x005e1ff, 0x0066202, 0x106d202, 0x1075202,
+  0x107c202, 0x1084202, 0x108c202, 0x10901ff, 0x10951fc, 0x10971f8, 0x10991f4, 0x10991ed,
+  0x10991e7, 0x10991e1, 0x10991db, 0x10991d3, 0x10991cb, 0x10991c4, 0x10991bc, 0x10991b4,
+  0x10991ad, 0x10991a5, 0x109919d, 0x1099196, 0x109918e, 0x1099187, 0x1099181, 0x109917b,
+  0x109a176, 0x1098170, 0x109716a, 0x1096165, 0x1092162, 0x108e160, 0x108815f, 0x108315f,
+  0x107b15f, 0x107415f, 0x106c15f, 0x106515f, 0x105e15f, 0x105815f, 0x105215f, 0x104c15f,
+  0x1051157, 0x105714f, 0x105d147, 0x1063140, 0x1063139, 0x1063133, 0x105e132, 0x105a131,
+  0x1055133, 0x1050136, 0x104b13c, 0x1046143, 0x1041149, 0x103c150, 0x1038155, 0x103315a,
+  0x102e160, 0x1029160, 0x1023160, 0x101d162, 0x1016165, 0x101316c, 0x1012171, 0x1011176,
+  0x101117c, 0x1011182, 0x1011189, 0x101118f, 0x1011196, 0x101119c, 0x10111a2, 0x10111a8,
+  0x10111af, 0x10121b5, 0x10121bb, 0x10121c1, 0x00131b9, 0x00131b1, 0x00131aa, 0x00131a2,
+  0x001419a, 0x0014193, 0x001418b, 0x0014183, 0x001517c, 0x0015174, 0x001516c, 0x0015165,
+  0x1010163, 0x100c163, 0x1007164, 0x1003169, 0x100216d, 0x1006174, 0x100c176, 0x1011178,
+  0x001117d, 0x0010182, 0x100c183, 0x1007185, 0x100318a, 0x100218e, 0x1006195, 0x100b197,
+  0x1010199, 0x00101a0, 0x00101a7, 0x00101ae, 0x00101b6, 0x00101bd, 0x00101c4, 0x00101cc,
+  0x100b1cd, 0x10061ce, 0x10011d4, 0x10011d8, 0x10041de, 0x10091e0, 0x100d1e2, 0x000e1e9,
+  0x000e1f0, 0x100a1f1, 0x10051f2, 0x10011f7, 0x10001fb, 0x1004202, 0x1009204, 0x100e206,
+  0x00101fe, 0x00121f6, 0x00141ee, 0x00161e6, 0x00181de, 0x001a1d6, 0x001b1ce, 0x001d1c6,
+  0x001f1be, 0x00211b6, 0x00231ae, 0x00251a6, 0x002619e, 0x0028196, 0x002a18e, 0x002c186,
+  0x002e17e, 0x0030176, 0x003216e, 0x0033166, 0x003515e, 0x0037156, 0x003914e, 0x003b146,
+  0x003d13e, 0x003e136, 0x004012e, 0x0042126, 0x004411e, 0x0046116, 0x004810f, 0x004a107,
+  0x004b100, 0x004d0f8, 0x004e0f0, 0x00500e8, 0x00520e0, 0x00540d8, 0x00560d0, 0x00570c8,
+  0x00590c0, 0x005b0b8, 0x005d0b0, 0x005f0a8, 0x00610a0, 0x0062098, 0x0064090, 0x0066088,
+  0x0068080, 0x006a078, 0x006c070, 0x006e068, 0x006f060, 0x0071058, 0x0073050, 0x0075048,
+  0x0077040, 0x0079038, 0x007a030, 0x007c028, 0x007e020, 0x0080018, 0x0082010, 0x0084008,
+  0x0086000, 0x1087007, 0x108900d, 0x108a014, 0x108c01a, 0x108d022, 0x108f029, 0x1091030,
+  0x1093037, 0x109203f, 0x1091046, 0x109104d, 0x108e054, 0x108c05b, 0x108a062, 0x1088069,
+  0x1086070, 0x1087078, 0x1088080, 0x108a087, 0x108b08e, 0x108d095, 0x108f09c, 0x10910a3,
+  0x10930a9, 0x10920b1, 0x10910b8, 0x10910bf, 0x108f0c5, 0x108d0cb, 0x108c0d0, 0x108a0d7,
+  0x10880de, 0x10860e4, 0x10860eb, 0x10860f2, 0x10870f8, 0x108a100, 0x108d107, 0x108f10e,
+  0x1091113, 0x109311a, 0x1092120, 0x1092126, 0x109112c, 0x1091132, 0x108f137, 0x108d13d,
+  0x108c143, 0x1089149, 0x1087150, 0x1086157, 0x108615e, 0x0085156, 0x008414e, 0x0084146,
+  0x008313e, 0x0083136, 0x008212e, 0x0082126, 0x008111e, 0x0081116, 0x008010f, 0x0080107,
+  0x007f0ff, 0x007f0f7, 0x007e0ef, 0x007e0e7, 0x007d0df, 0x007d0d7, 0x007c0cf, 0x007c0c7,
+  0x007b0bf, 0x007b0b7, 0x007a0af, 0x00790a8, 0x00790a0, 0x0078098, 0x0078090, 0x0077088,
+  0x0077080, 0x0076078, 0x0076070, 0x0075068, 0x0075060, 0x0074058, 0x0074050, 0x0073048,
+  0x0073040, 0x0072038, 0x0072030, 0x0071028, 0x0071020, 0x0070018, 0x0070010, 0x006f008,
+  0x006f000, 0x1070007, 0x107200d, 0x1073014, 0x107501a, 0x1077022, 0x1079029, 0x107b030,
+  0x107d037, 0x107c03e, 0x107b045, 0x107a04c, 0x1077054, 0x107505b, 0x1073062, 0x1071069,
+  0x106f070, 0x1070078, 0x1071080, 0x1073087, 0x107408e, 0x1076095, 0x107809c, 0x107a0a3,
+  0x107c0a9, 0x107b0b0, 0x107b0b7, 0x107b0be, 0x10790c4, 0x10770ca, 0x10750d0, 0x10730d7,
+  0x10710de, 0x106f0e4, 0x106f0eb, 0x10700f1, 0x10710f7, 0x10720fd, 0x1074102, 0x1076107,
+  0x107810e, 0x107a113, 0x107c11a, 0x107b120, 0x107b126, 0x107b12c, 0x107b132, 0x1079137,
+  0x107713d, 0x1075143, 0x1073149, 0x1071150, 0x1070157, 0x106f15e, 0x006e156, 0x006d14e,
+  0x006d146, 0x006c13e, 0x006c136, 0x006b12e, 0x006b126, 0x006a11e, 0x006a116, 0x006910f,
+  0x0069107, 0x00680ff, 0x00680f7, 0x00670ef, 0x00670e8, 0x00660e0, 0x00660d8, 0x00650d0,
+  0x00650c8, 0x00640c0, 0x00640b8, 0x00630b0, 0x00620a8, 0x00620a0, 0x0061098, 0x0061090,
+  0x0060088, 0x0060080, 0x005f078, 0x005f071, 0x005e069, 0x005e061, 0x005d059, 0x005d051,
+  0x005c049, 0x005c041, 0x005b039, 0x005b031, 0x005a029, 0x005a021, 0x0059019, 0x0059011,
+  0x0058009, 0x0058001, 0x1059008, 0x105b00e, 0x105c015, 0x105e01b, 0x105f023, 0x106102a,
+  0x1063032, 0x1065039, 0x1064040, 0x1063047, 0x106204e, 0x1060056, 0x105e05d, 0x105c064,
+  0x105a06b, 0x1058072, 0x105907a, 0x105a082, 0x105b089, 0x105d090, 0x105f097, 0x106109e,
+  0x10630a5, 0x10650ab, 0x10640b2, 0x10630b9, 0x10630c0, 0x10610c6, 0x105f0cc, 0x105e0d1,
+  0x105c0d8, 0x105a0df, 0x10580e6, 0x10580ed, 0x10580f3, 0x10590f9, 0x105b0ff, 0x105d104,
+  0x105f109, 0x1061110, 0x1063115, 0x106511c, 0x1064123, 0x106312a, 0x1063131, 0x0062129,
+  0x0061121, 0x0060119, 0x005f112, 0x005e10b, 0x005d103, 0x005c0fb, 0x005b0f3, 0x005a0eb,
+  0x005a0e4, 0x00590dc, 0x00580d4, 0x00570cc, 0x00560c4, 0x00550bd, 0x00540b5, 0x00530ad,
+  0x00520a5, 0x005109d, 0x0051096, 0x005008e, 0x004f086, 0x004e07e, 0x004d076, 0x004d06f,
+  0x004c067, 0x004b05f, 0x004a057, 0x004904f, 0x0049048, 0x0048040, 0x0047038, 0x0046030,
+  0x0045028, 0x0044021, 0x0043019, 0x0042011, 0x0041009, 0x0040001, 0x1042008, 0x104300e,
+  0x1045015, 0x104601b, 0x1048023, 0x104a02a, 0x104c031, 0x104e038, 0x104d040, 0x104c047,
+  0x104b04e, 0x1049055, 0x104605c, 0x1044064, 0x104206b, 0x1040072, 0x104207a, 0x1043081,
+  0x1044088, 0x104608f, 0x1048096, 0x104a09d, 0x104c0a4, 0x104e0aa, 0x104d0b2, 0x104d0b9,
+  0x104c0c0, 0x104a0c6, 0x10480cc, 0x10460d1, 0x10440d8, 0x10420df, 0x10400e5, 0x10410ec,
+  0x10420f3, 0x10420f9, 0x1045101, 0x1048108, 0x104a10f, 0x104c115, 0x104d11c, 0x104d123,
+  0x104c12a, 0x104c131, 0x104b138, 0x004b130, 0x004a128, 0x0049120, 0x0048118, 0x0048111,
+  0x004710a, 0x0046102, 0x00450fa, 0x00450f2, 0x00440ea, 0x00430e3, 0x00420db, 0x00410d3,
+  0x00410cb, 0x00400c3, 0x003f0bc, 0x003e0b4, 0x003e0ac, 0x003d0a4, 0x003c09c, 0x003b095,
+  0x003a08d, 0x003a085, 0x003907d, 0x0038075, 0x003706e, 0x0037066, 0x003605e, 0x0035056,
+  0x003404e, 0x0033047, 0x003303f, 0x0032037, 0x003102f, 0x0030027, 0x0030020, 0x002f018,
+  0x002e010, 0x002d008, 0x002c000, 0x102e007, 0x102f00d, 0x1031014, 0x103201a, 0x1034022,
+  0x1036029, 0x1038031, 0x1039038, 0x103803f, 0x1037046, 0x103604d, 0x1034055, 0x103205c,
+  0x1030063, 0x102e06a, 0x102c071, 0x102d079, 0x102e080, 0x102f087, 0x103108e, 0x1033095,
+  0x103509c, 0x10370a3, 0x10390a9, 0x10390b1, 0x10380b8, 0x10370bf, 0x10360c5, 0x10340cb,
+  0x10320d0, 0x10300d7, 0x102e0de, 0x102c0e5, 0x102d0ec, 0x102d0f2, 0x102d0f8, 0x102f0fe,
+  0x1031103, 0x1033108, 0x103510f, 0x1037114, 0x103911b, 0x1039121, 0x1038127, 0x103812d,
+  0x1037133, 0x1036138, 0x103413e, 0x1032144, 0x103014a, 0x102d151, 0x102d158, 0x102c15f,
+  0x002c157, 0x002c14f, 0x002b147, 0x002b13f, 0x002a137, 0x002a12f, 0x0029127, 0x002911f,
+  0x0028117, 0x0028110, 0x0027108, 0x0027100, 0x00270f8, 0x00260f0, 0x00260e8, 0x00250e0,
+  0x00250d8, 0x00240d0, 0x00240c8, 0x00230c0, 0x00230b8, 0x00220b0, 0x00220a9, 0x00220a1,
+  0x0021099, 0x0021091, 0x0020089, 0x0020081, 0x001f079, 0x001f071, 0x001e069, 0x001e061,
+  0x001d059, 0x001d051, 0x001d049, 0x001c041, 0x001c039, 0x001b031, 0x001b029, 0x001a021,
+  0x001a019, 0x0019011, 0x0019009, 0x0018001, 0x101a008, 0x101b00e, 0x101d015, 0x101e01b,
+  0x1020023, 0x102202a, 0x1024032, 0x1026039, 0x1025040, 0x1024047, 0x102304e, 0x1021056,
+  0x101e05d, 0x101d064, 0x101b06b, 0x1019072, 0x101a07a, 0x101b081, 0x101c088, 0x101e08f,
+  0x1020096, 0x102209d, 0x10240a4, 0x10260aa, 0x10260b2, 0x10250b9, 0x10240c0, 0x10220c6,
+  0x10200cc, 0x101e0d1, 0x101d0d8, 0x101b0df, 0x10190e6, 0x101a0ed, 0x101a0f3, 0x101a0f9,
+  0x101c0ff, 0x101e104, 0x1020109, 0x1022110, 0x1024115, 0x102511c, 0x1025122, 0x1025128,
+  0x102512e, 0x1024134, 0x1022139, 0x102013f, 0x101e145, 0x101c14b, 0x101a152, 0x1019159,
+  0x1018160, 0x001b167, 0x001e16f, 0x0020177, 0x002317f, 0x0025187, 0x002818f, 0x002a197,
+  0x002d19f, 0x002f1a7, 0x00321af, 0x00341b7, 0x00371bf, 0x003a1c7, 0x003c1cf, 0x003f1d7,
+  0x00411df, 0x00441e7, 0x00461ef, 0x00491f7, 0x004b1ff, 0x004d207, 0x004f20f, 0x0052217,
+  0x005521f,
+};
+
+constexpr equation_shape_t EQUATION_SHAPES[NUM_EQUATIONS] = {
+  {EQN_01_POINTS, 285, -275, -47, 550, 95},
+  {EQN_02_POINTS, 279, -275, -34, 550, 68},
+  {EQN_03_POINTS, 489, -275, -79, 550, 158},
+  {EQN_04_POINTS, 324, -275, -24, 550, 49},
+  {EQN_05_POINTS, 279, -275, -44, 550, 89},
+  {EQN_06_POINTS, 279, -275, -57, 550, 114},
+  {EQN_07_POINTS, 479, -275, -46, 550, 93},
+  {EQN_08_POINTS, 298, -275, -23, 550, 47},
+  {EQN_09_POINTS, 292, -275, -25, 550, 51},
+  {EQN_10_POINTS, 335, -275, -55, 550, 110},
+  {EQN_11_POINTS, 271, -275, -94, 550, 188},
+  {EQN_12_POINTS, 401, -275, -132, 550, 264},
+  {EQN_13_POINTS, 401, -275, -111, 550, 222},
+  {EQN_14_POINTS, 318, -275, -24, 550, 49},
+  {EQN_15_POINTS, 626, -275, -162, 550, 324},
+  {EQN_16_POINTS, 437, -275, -53, 550, 107},
+  {EQN_17_POINTS, 383, -275, -73, 550, 147},
+  {EQN_18_POINTS, 296, -275, -99, 550, 199},
+  {EQN_19_POINTS, 375, -275, -59, 550, 119},
+  {EQN_20_POINTS, 427, -275, -33, 550, 66},
+  {EQN_21_POINTS, 301, -275, -106, 550, 213},
+  {EQN_22_POINTS, 258, -275, -40, 550, 81},
+  {EQN_23_POINTS, 343, -275, -103, 550, 206},
+  {EQN_24_POINTS, 372, -275, -59, 550, 118},
+  {EQN_25_POINTS, 465, -275, -100, 550, 201},
+  {EQN_26_POINTS, 465, -275, -34, 550, 69},
+  {EQN_27_POINTS, 407, -275, -13, 550, 26},
+  {EQN_28_POINTS, 414, -275, -13, 550, 26},
+  {EQN_29_POINTS, 388, -275, -59, 550, 119},
+  {EQN_30_POINTS, 290, -275, -49, 550, 98},
+  {EQN_31_POINTS, 260, -275, -52, 550, 104},
+  {EQN_32_POINTS, 302, -275, -67, 550, 135},
+  {EQN_33_POINTS, 337, -275, -62, 550, 124},
+  {EQN_34_POINTS, 728, -232, -275, 465, 550},
+  {EQN_35_POINTS, 539, -203, -275, 407, 550},
+  {EQN_36_POINTS, 857, -275, -77, 550, 154},
+};
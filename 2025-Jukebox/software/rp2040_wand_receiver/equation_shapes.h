@@ -0,0 +1,25 @@
+#ifndef _EQUATION_SHAPES_
+#define _EQUATION_SHAPES_
+
+#include <Arduino.h>
+
+#define NUM_EQUATIONS 36
+
+// Each point is packed into 32 bits: x and y as 12-bit offsets from the
+// shape's min_x/min_y, plus the laser on (not blanked) flag in bit 24
+#define EQN_POINT_X(s, p)  ((s)->min_x + (int)((p) & 0xfff))
+#define EQN_POINT_Y(s, p)  ((s)->min_y + (int)(((p) >> 12) & 0xfff))
+#define EQN_POINT_ON(p)    (((p) >> 24) & 1)
+
+// Equations already scaled, centered on their midpoint and interpolated to
+// 8 unit segments. Generated by host/equation_gen from laser_objects.cpp.
+typedef struct {
+  const uint32_t *points;
+  uint16_t len;
+  int16_t min_x, min_y;
+  uint16_t width, height;
+} equation_shape_t;
+
+extern const equation_shape_t EQUATION_SHAPES[NUM_EQUATIONS];
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef _FIXED_
+#define _FIXED_
+
+#include <Arduino.h>
+
+// Signed Q16.16 fixed point number. The RP2040 has no FPU, so the per-point
+// kernels in primitives.h can be instantiated with this type instead of
+// double. Range is +/-32768 with a resolution of 1/65536.
+class fix16 {
+  public:
+    int32_t raw;
+
+    constexpr fix16() : raw(0) {}
+    constexpr fix16(int v) : raw((int32_t)v * 65536) {}
+    constexpr fix16(double v) : raw((int32_t)(v * 65536.0 + (v >= 0 ? 0.5 : -0.5))) {}
+
+    static constexpr fix16 from_raw(int32_t r) {
+      fix16 f;
+      f.raw = r;
+      return f;
+    }
+
+    // Truncates toward zero, matching a (int) cast of a double
+    explicit constexpr operator int() const { return raw / 65536; }
+    constexpr double to_double() const { return raw / 65536.0; }
+
+    fix16 &operator+=(fix16 b) { raw += b.raw; return *this; }
+    fix16 &operator-=(fix16 b) { raw -= b.raw; return *this; }
+    fix16 &operator*=(fix16 b) { raw = (int32_t)(((int64_t)raw * b.raw) >> 16); return *this; }
+    fix16 &operator/=(fix16 b) {
+      if (b.raw == 0) raw = raw >= 0 ? INT32_MAX : INT32_MIN;
+      else raw = (int32_t)(((int64_t)raw * 65536) / b.raw);
+      return *this;
+    }
+};
+
+inline fix16 operator-(fix16 a) { return fix16::from_raw(-a.raw); }
+inline fix16 operator+(fix16 a, fix16 b) { return a += b; }
+inline fix16 operator-(fix16 a, fix16 b) { return a -= b; }
+inline fix16 operator*(fix16 a, fix16 b) { return a *= b; }
+inline fix16 operator/(fix16 a, fix16 b) { return a /= b; }
+
+inline bool operator==(fix16 a, fix16 b) { return a.raw == b.raw; }
+inline bool operator!=(fix16 a, fix16 b) { return a.raw != b.raw; }
+inline bool operator<(fix16 a, fix16 b)  { return a.raw < b.raw; }
+inline bool operator>(fix16 a, fix16 b)  { return a.raw > b.raw; }
+inline bool operator<=(fix16 a, fix16 b) { return a.raw <= b.raw; }
+inline bool operator>=(fix16 a, fix16 b) { return a.raw >= b.raw; }
+
+#define FIX16_PI      fix16::from_raw(205887)
+#define FIX16_HALF_PI fix16::from_raw(102944)
+#define FIX16_TWO_PI  fix16::from_raw(411775)
+
+inline fix16 sqrt(fix16 a) {
+  if (a.raw <= 0) return fix16();
+  uint64_t n = (uint64_t)a.raw << 16;
+  uint64_t root = 0;
+  uint64_t bit = (uint64_t)1 << 46;
+  while (bit > n) bit >>= 2;
+  while (bit != 0) {
+    if (n >= root + bit) {
+      n -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return fix16::from_raw((int32_t)root);
+}
+
+inline fix16 sin(fix16 a) {
+  int32_t x = a.raw % FIX16_TWO_PI.raw;
+  if (x > FIX16_PI.raw) x -= FIX16_TWO_PI.raw;
+  else if (x < -FIX16_PI.raw) x += FIX16_TWO_PI.raw;
+  if (x > FIX16_HALF_PI.raw) x = FIX16_PI.raw - x;
+  else if (x < -FIX16_HALF_PI.raw) x = -FIX16_PI.raw - x;
+
+  // Taylor series to x^9, evaluated in Q2.30 so the small coefficients keep
+  // their precision. |error| < 4e-6 before rounding back to Q16.16.
+  int64_t t = (int64_t)x << 14;
+  int64_t t2 = (t * t) >> 30;
+  int64_t p = 2959;
+  p = -213042 + ((p * t2) >> 30);
+  p = 8947849 + ((p * t2) >> 30);
+  p = -178956971 + ((p * t2) >> 30);
+  p = 1073741824 + ((p * t2) >> 30);
+  return fix16::from_raw((int32_t)((((p * t) >> 30) + (1 << 13)) >> 14));
+}
+
+inline fix16 cos(fix16 a) {
+  return sin(a + FIX16_HALF_PI);
+}
+
+// Polynomial arctangent on [0, 1] folded out to all quadrants, |error| < 1e-4
+inline fix16 atan2(fix16 y, fix16 x) {
+  if (x.raw == 0 && y.raw == 0) return fix16();
+  int32_t ax = x.raw < 0 ? -x.raw : x.raw;
+  int32_t ay = y.raw < 0 ? -y.raw : y.raw;
+  bool swap = ay > ax;
+  fix16 z = swap ? fix16::from_raw(ax) / fix16::from_raw(ay) : fix16::from_raw(ay) / fix16::from_raw(ax);
+  fix16 z2 = z * z;
+  fix16 r = z * (fix16(0.99986600) + z2 * (fix16(-0.33029950) + z2 * (fix16(0.18014100) +
+                 z2 * (fix16(-0.08513300) + z2 * fix16(0.02083510)))));
+  if (swap) r = FIX16_HALF_PI - r;
+  if (x.raw < 0) r = FIX16_PI - r;
+  return y.raw < 0 ? -r : r;
+}
+
+inline fix16 asin(fix16 a) {
+  if (a.raw >= 65536) return FIX16_HALF_PI;
+  if (a.raw <= -65536) return -FIX16_HALF_PI;
+  return atan2(a, sqrt(fix16(1) - a) * sqrt(fix16(1) + a));
+}
+
+inline fix16 acos(fix16 a) {
+  if (a.raw >= 65536) return fix16();
+  if (a.raw <= -65536) return FIX16_PI;
+  return atan2(sqrt(fix16(1) - a) * sqrt(fix16(1) + a), a);
+}
+
+#endif
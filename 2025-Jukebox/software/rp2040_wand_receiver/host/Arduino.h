@@ -0,0 +1,40 @@
+#ifndef _HOST_ARDUINO_
+#define _HOST_ARDUINO_
+
+// Minimal stand-in for the Arduino core so the laser generator sources can be
+// built and run on a desktop machine. Time and randomness are injected by the
+// host program instead of coming from the RP2040 timer and ADC noise.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <cmath>
+#include <algorithm>
+
+using std::abs;
+using std::min;
+using std::max;
+
+#define PI         3.1415926535897932384626433832795
+#define HALF_PI    1.5707963267948966192313216916398
+#define TWO_PI     6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+// Host-only hooks for driving the simulated clock and random generator
+void host_set_micros(uint64_t us);
+void host_advance_micros(uint64_t us);
+uint64_t host_get_micros();
+
+#endif
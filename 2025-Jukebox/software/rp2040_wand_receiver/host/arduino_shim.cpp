@@ -0,0 +1,50 @@
+#include "Arduino.h"
+
+static uint64_t currentMicros = 0;
+static uint32_t randomState = 0x2545f491;
+
+unsigned long millis() {
+  return (unsigned long)(currentMicros / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)currentMicros;
+}
+
+void delay(unsigned long ms) {
+  currentMicros += (uint64_t)ms * 1000;
+}
+
+static uint32_t next_random() {
+  // xorshift32, so point streams are identical across hosts and libc versions
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  return (long)(next_random() % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed) {
+  if (seed != 0) randomState = (uint32_t)seed;
+}
+
+void host_set_micros(uint64_t us) {
+  currentMicros = us;
+}
+
+void host_advance_micros(uint64_t us) {
+  currentMicros += us;
+}
+
+uint64_t host_get_micros() {
+  return currentMicros;
+}
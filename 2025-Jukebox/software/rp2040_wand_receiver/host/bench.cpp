@@ -0,0 +1,295 @@
+// Per-mode microbenchmarks for LaserGenerator::get_point and get_points,
+// and for the compressed point encoding in point_codec.h.
+//
+// queueLaserData() must produce one point every LASER_POINT_PERIOD_US on
+// core 0, so besides ns/point every benchmark reports budget_pct, the share
+// of that period a single point costs. Run with
+//   --benchmark_out=bench.json --benchmark_out_format=json
+// to keep results for comparison between builds.
+
+#include <benchmark/benchmark.h>
+#include "Arduino.h"
+#include "laser_generator.h"
+#include "lookup_tables.h"
+#include "point_codec.h"
+#include <chrono>
+#include <vector>
+
+#define LASER_POINT_PERIOD_US 150
+#define LASER_PACKET_POINTS   170
+#define LASER_PACKET_MAX_LEN  1472
+#define RECORDED_POINTS       20000
+
+// The calibration default is a wand held level and pointing at projector 0
+#define WAND_RAW_LEVEL 32767
+
+typedef struct {
+  uint8_t mode;
+  const char *name;
+} bench_mode_t;
+
+static const bench_mode_t BENCH_MODES[] = {
+  {2, "AudioVisualizer"},
+  {3, "Equations"},
+  {4, "Spirograph"},
+  {5, "Pong"},
+  {7, "WandDrawing"},
+  {9, "Calibration"}
+};
+
+static LaserGenerator laserGen;
+
+static void setup_generator() {
+  randomSeed(1);
+  host_set_micros(0);
+  laserGen.init();
+
+  for (int i = 0; i < UDP_AUDIO_BUFF_SIZE; i++)
+    laserGen.audioBuffer[i] = (uint8_t)(128 + 100 * sin(i * TWO_PI / 64.0));
+
+  wand_quaternion(WAND_RAW_LEVEL, 16384, 16384, 16384, laserGen.wandData1);
+  laserGen.numWandsConnected = 1;
+}
+
+typedef std::chrono::steady_clock::time_point budget_start_t;
+
+static budget_start_t budget_start() { return std::chrono::steady_clock::now(); }
+
+// start is taken just before the timing loop
+static void set_budget_counters(benchmark::State &state, budget_start_t start,
+                                int64_t pointsPerIteration = 1) {
+  int64_t points = state.iterations() * pointsPerIteration;
+  state.SetItemsProcessed(points);
+  if (points == 0) return;
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  double nsPerPoint = ns / points;
+  state.counters["budget_pct"] = 100.0 * nsPerPoint / LASER_POINT_PERIOD_US / 1000;
+}
+
+static void BM_Init(benchmark::State &state) {
+  for (auto _ : state) {
+    LaserGenerator gen;
+    gen.init();
+    benchmark::DoNotOptimize(&gen);
+  }
+}
+
+// Every mode keeps its state in function statics, so only the very first call
+// in the process takes the setup_complete path. These run once, before any
+// steady-state benchmark touches the same mode.
+static void BM_FirstPoint(benchmark::State &state, uint8_t mode) {
+  for (auto _ : state) {
+    laser_point_x3_t p = laserGen.get_point(mode);
+    benchmark::DoNotOptimize(p);
+  }
+  host_advance_micros(LASER_POINT_PERIOD_US);
+}
+
+static void BM_GetPoint(benchmark::State &state, uint8_t mode) {
+  budget_start_t start = budget_start();
+  for (auto _ : state) {
+    host_advance_micros(LASER_POINT_PERIOD_US);
+    laser_point_x3_t p = laserGen.get_point(mode);
+    benchmark::DoNotOptimize(p);
+  }
+  set_budget_counters(state, start);
+}
+
+// One UDP packet's worth of points per get_points() call
+static void BM_GetPoints(benchmark::State &state, uint8_t mode) {
+  laser_point_x3_t points[LASER_PACKET_POINTS];
+  budget_start_t start = budget_start();
+  for (auto _ : state) {
+    host_advance_micros(LASER_POINT_PERIOD_US * LASER_PACKET_POINTS);
+    laserGen.get_points(mode, points, LASER_PACKET_POINTS);
+    benchmark::DoNotOptimize(points);
+  }
+  set_budget_counters(state, start, LASER_PACKET_POINTS);
+}
+
+// get_equation_points() swaps all three equations every 30 s
+static void BM_EquationReload(benchmark::State &state) {
+  budget_start_t start = budget_start();
+  for (auto _ : state) {
+    host_advance_micros(30000000UL);
+    laser_point_x3_t p = laserGen.get_point(3);
+    benchmark::DoNotOptimize(p);
+  }
+  set_budget_counters(state, start);
+}
+
+// Lookup tables against the libm and hsv_to_rgb calls they replaced. The host
+// has an FPU, so these understate the gap on the RP2040's soft float.
+static void BM_SinCos_Libm(benchmark::State &state) {
+  double x = 0.1;
+  for (auto _ : state) {
+    double s = sin(x), c = cos(x);
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(c);
+    x += 0.0137;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_SinCos_Table(benchmark::State &state) {
+  double x = 0.1;
+  for (auto _ : state) {
+    double s, c;
+    sincos_rad(x, &s, &c);
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(c);
+    x += 0.0137;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Hue_Hsv(benchmark::State &state) {
+  int angle = 0;
+  for (auto _ : state) {
+    rgb_t c = hsv_to_rgb((double)(angle % 360) / 360.0, 1.0, 1.0);
+    benchmark::DoNotOptimize(c);
+    angle += 7;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Hue_Table(benchmark::State &state) {
+  int angle = 0;
+  for (auto _ : state) {
+    rgb_t c = hue_to_rgb(angle);
+    benchmark::DoNotOptimize(c);
+    angle += 7;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// A stream recorded from one mode, all three projectors, at the point rate
+static std::vector<laser_point_x3_t> record_stream(uint8_t mode) {
+  std::vector<laser_point_x3_t> points(RECORDED_POINTS);
+  for (size_t i = 0; i < points.size(); i += LASER_PACKET_POINTS) {
+    size_t n = std::min<size_t>(LASER_PACKET_POINTS, points.size() - i);
+    host_advance_micros(LASER_POINT_PERIOD_US * LASER_PACKET_POINTS);
+    laserGen.get_points(mode, &points[i], n);
+  }
+  return points;
+}
+
+// Splits one projector's stream into packets the way the sketch does, ending
+// a packet when the next point might not fit or it holds
+// LASER_CODEC_PACKET_POINTS. Returns the packet count.
+static size_t encode_stream(const std::vector<laser_point_x3_t> &points, int projector,
+                            std::vector<std::vector<uint8_t>> *packets) {
+  point_encoder encoder;
+  uint8_t buf[LASER_PACKET_MAX_LEN];
+  size_t len = LASER_CODEC_HEADER_LEN;
+  size_t count = 0;
+  size_t numPoints = 0;
+
+  for (size_t i = 0; i < points.size(); i++) {
+    len += encoder.add(&points[i].p[projector], buf + len);
+    if (++numPoints >= LASER_CODEC_PACKET_POINTS || len + LASER_CODEC_MAX_POINT_LEN + 1 > LASER_PACKET_MAX_LEN ||
+        i == points.size() - 1) {
+      len += encoder.flush(buf + len);
+      if (packets) packets->emplace_back(buf, buf + len);
+      encoder.reset();
+      len = LASER_CODEC_HEADER_LEN;
+      numPoints = 0;
+      count++;
+    }
+  }
+  return count;
+}
+
+// Reports the wire size against the 6 byte points of point_to_bytes()
+static void set_codec_counters(benchmark::State &state, size_t numPoints, size_t bytes, size_t packets) {
+  state.counters["bytes_per_point"] = (double)bytes / numPoints;
+  state.counters["points_per_packet"] = (double)numPoints / packets;
+  state.counters["compression"] = 6.0 * numPoints / bytes;
+}
+
+static void BM_Encode(benchmark::State &state, uint8_t mode) {
+  std::vector<laser_point_x3_t> points = record_stream(mode);
+  std::vector<std::vector<uint8_t>> packets;
+  for (int i = 0; i < 3; i++)
+    encode_stream(points, i, &packets);
+
+  // Every packet has to decode back to exactly the recorded points
+  std::vector<laser_point_t> decoded(RECORDED_POINTS);
+  size_t bytes = 0, index = 0;
+  for (const std::vector<uint8_t> &p : packets) {
+    int n = laser_codec_decode(p.data() + LASER_CODEC_HEADER_LEN, p.size() - LASER_CODEC_HEADER_LEN,
+                               decoded.data(), decoded.size());
+    if (n < 0) {
+      state.SkipWithError("packet failed to decode");
+      return;
+    }
+    for (int j = 0; j < n; j++, index++) {
+      const laser_point_t &a = decoded[j], &b = points[index % RECORDED_POINTS].p[index / RECORDED_POINTS];
+      if (a.x != b.x || a.y != b.y || a.r != b.r || a.g != b.g || a.b != b.b) {
+        state.SkipWithError("decoded stream does not match");
+        return;
+      }
+    }
+    bytes += p.size();
+  }
+
+  for (auto _ : state) {
+    size_t n = encode_stream(points, 0, NULL);
+    benchmark::DoNotOptimize(n);
+  }
+  state.SetItemsProcessed(state.iterations() * RECORDED_POINTS);
+  set_codec_counters(state, 3 * RECORDED_POINTS, bytes, packets.size());
+}
+
+static void BM_Decode(benchmark::State &state, uint8_t mode) {
+  std::vector<laser_point_x3_t> points = record_stream(mode);
+  std::vector<std::vector<uint8_t>> packets;
+  encode_stream(points, 0, &packets);
+
+  std::vector<laser_point_t> decoded(RECORDED_POINTS);
+  for (auto _ : state) {
+    for (const std::vector<uint8_t> &p : packets) {
+      int n = laser_codec_decode(p.data() + LASER_CODEC_HEADER_LEN, p.size() - LASER_CODEC_HEADER_LEN,
+                                 decoded.data(), decoded.size());
+      benchmark::DoNotOptimize(n);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * RECORDED_POINTS);
+}
+
+int main(int argc, char **argv) {
+  setup_generator();
+
+  benchmark::RegisterBenchmark("BM_Init", BM_Init)->Unit(benchmark::kMicrosecond);
+
+  for (const bench_mode_t &m : BENCH_MODES) {
+    benchmark::RegisterBenchmark((std::string("BM_FirstPoint/") + m.name).c_str(), BM_FirstPoint, m.mode)
+      ->Iterations(1)->Unit(benchmark::kMicrosecond);
+  }
+
+  for (const bench_mode_t &m : BENCH_MODES)
+    benchmark::RegisterBenchmark((std::string("BM_GetPoint/") + m.name).c_str(), BM_GetPoint, m.mode);
+
+  for (const bench_mode_t &m : BENCH_MODES)
+    benchmark::RegisterBenchmark((std::string("BM_GetPoints/") + m.name).c_str(), BM_GetPoints, m.mode);
+
+  benchmark::RegisterBenchmark("BM_EquationReload", BM_EquationReload)->Unit(benchmark::kMicrosecond);
+
+  benchmark::RegisterBenchmark("BM_SinCos/Libm", BM_SinCos_Libm);
+  benchmark::RegisterBenchmark("BM_SinCos/Table", BM_SinCos_Table);
+  benchmark::RegisterBenchmark("BM_Hue/Hsv", BM_Hue_Hsv);
+  benchmark::RegisterBenchmark("BM_Hue/Table", BM_Hue_Table);
+
+  for (const bench_mode_t &m : BENCH_MODES)
+    benchmark::RegisterBenchmark((std::string("BM_Encode/") + m.name).c_str(), BM_Encode, m.mode)
+      ->Unit(benchmark::kMicrosecond);
+  for (const bench_mode_t &m : BENCH_MODES)
+    benchmark::RegisterBenchmark((std::string("BM_Decode/") + m.name).c_str(), BM_Decode, m.mode)
+      ->Unit(benchmark::kMicrosecond);
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,84 @@
+// Runs the equation setup that get_equation_point() used to do every 30 s
+// (convert_to_xy, then interpolate_objects) once on the host, and writes the
+// results as a constexpr table for equation_shapes.h. Regenerate after
+// changing any EQN_xx array in laser_objects.cpp with
+//   cmake --build <build dir> --target equation_shapes
+
+#include <stdio.h>
+#include <vector>
+#include "Arduino.h"
+#include "primitives.h"
+#include "laser_objects.h"
+#include "equation_shapes.h"
+
+#define EQUATION_SCALE 0.5
+#define EQUATION_SEG_DIST 8
+
+static uint16_t *EQUATION_LIST[NUM_EQUATIONS] = {
+  EQN_01, EQN_02, EQN_03, EQN_04, EQN_05, EQN_06, EQN_07, EQN_08, 
+  EQN_09, EQN_10, EQN_11, EQN_12, EQN_13, EQN_14, EQN_15, EQN_16, 
+  EQN_17, EQN_18, EQN_19, EQN_20, EQN_21, EQN_22, EQN_23, EQN_24, 
+  EQN_25, EQN_26, EQN_27, EQN_28, EQN_29, EQN_30, EQN_31, EQN_32, 
+  EQN_33, EQN_34, EQN_35, EQN_36
+};
+
+static int EQUATION_LENS[NUM_EQUATIONS] = {
+  210, 224, 324, 322, 156, 106, 412, 318, 
+  260, 308, 104, 164, 192, 198, 308, 332, 
+  264, 152, 266, 488, 128, 82, 150, 278, 
+  214, 500, 564, 572, 318, 156, 86, 128, 
+  190, 282, 268, 380
+};
+
+int main(int argc, char **argv) {
+  FILE *out = argc > 1 ? fopen(argv[1], "w") : stdout;
+  if (out == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  fprintf(out, "// Generated by host/equation_gen, do not edit\n\n");
+  fprintf(out, "#include \"equation_shapes.h\"\n");
+
+  int minX[NUM_EQUATIONS], minY[NUM_EQUATIONS], lens[NUM_EQUATIONS];
+  int widths[NUM_EQUATIONS], heights[NUM_EQUATIONS];
+  long total = 0;
+
+  for (int e = 0; e < NUM_EQUATIONS; e++) {
+    std::vector<xy_t> raw(EQUATION_LENS[e] / 2 + 1);
+    int len = convert_to_xy(EQUATION_LIST[e], EQUATION_LENS[e], EQUATION_SCALE, EQUATION_SCALE, raw.data());
+
+    int maxX, maxY;
+    get_laser_obj_bounds(raw.data(), len, &minX[e], &maxX, &minY[e], &maxY);
+    widths[e] = maxX - minX[e];
+    heights[e] = maxY - minY[e];
+    if (widths[e] > 0xfff || heights[e] > 0xfff) {
+      fprintf(stderr, "EQN_%02d is %dx%d, too large to pack\n", e + 1, widths[e], heights[e]);
+      return 1;
+    }
+
+    lens[e] = get_interpolated_size(raw.data(), len, EQUATION_SEG_DIST);
+    std::vector<xy_t> interp(lens[e]);
+    interpolate_objects(raw.data(), len, EQUATION_SEG_DIST, interp.data());
+    total += lens[e];
+
+    fprintf(out, "\nstatic constexpr uint32_t EQN_%02d_POINTS[%d] = {", e + 1, lens[e]);
+    for (int i = 0; i < lens[e]; i++) {
+      uint32_t p = (uint32_t)(interp[i].x - minX[e]) | ((uint32_t)(interp[i].y - minY[e]) << 12) |
+                   ((uint32_t)interp[i].on << 24);
+      fprintf(out, "%s0x%07x,", i % 8 == 0 ? "\n  " : " ", p);
+    }
+    fprintf(out, "\n};\n");
+  }
+
+  fprintf(out, "\nconstexpr equation_shape_t EQUATION_SHAPES[NUM_EQUATIONS] = {\n");
+  for (int e = 0; e < NUM_EQUATIONS; e++) {
+    fprintf(out, "  {EQN_%02d_POINTS, %d, %d, %d, %d, %d},\n",
+            e + 1, lens[e], minX[e], minY[e], widths[e], heights[e]);
+  }
+  fprintf(out, "};\n");
+
+  if (out != stdout) fclose(out);
+  fprintf(stderr, "%d equations, %ld points, %ld bytes\n", NUM_EQUATIONS, total, total * 4);
+  return 0;
+}
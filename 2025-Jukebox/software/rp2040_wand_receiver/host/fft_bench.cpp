@@ -0,0 +1,195 @@
+// Checks the jukebox's FixedFFT against a double precision FFT of the same
+// windowed input and times it. For each test signal it prints the error of
+// the whole spectrum relative to its energy and the worst band level error
+// in dB, for bands within 60 dB of the loudest. Timing is wall clock and,
+// on x86, TSC cycles per frame; on the RP2040 expect very different
+// numbers, this is for comparing changes. Exits non-zero when a tolerance
+// is exceeded.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <complex>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "FixedFFT.h"
+
+#define NUM_TIMED_FRAMES 20000
+
+#define TOL_SNR_DB      55   // spectrum error energy below signal energy
+#define TOL_BAND_DB     0.5  // band levels within 60 dB of the loudest band
+#define TOL_BAND_HEALTH 0.5  // band level of a full scale tone vs its RMS, in dB
+
+typedef std::complex<double> cplx;
+
+static FixedFFT fft;
+static int failures = 0;
+
+static void reference_fft(std::vector<cplx> &x) {
+  size_t n = x.size();
+  for (size_t i = 1, j = 0; i < n; i++) {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) std::swap(x[i], x[j]);
+  }
+  for (size_t len = 2; len <= n; len <<= 1) {
+    cplx w = std::polar(1.0, -2 * M_PI / len);
+    for (size_t i = 0; i < n; i += len) {
+      cplx wk = 1;
+      for (size_t k = 0; k < len / 2; k++, wk *= w) {
+        cplx u = x[i + k], v = x[i + k + len / 2] * wk;
+        x[i + k] = u + v;
+        x[i + k + len / 2] = u - v;
+      }
+    }
+  }
+}
+
+// Band levels from the reference spectrum, same scaling as bandLevels()
+static void reference_levels(const std::vector<cplx> &x, double *levels) {
+  for (int b = 0; b < FFT_BANDS; b++) {
+    double sum = 0;
+    for (int k = fft.bandEdge(b); k < fft.bandEdge(b + 1); k++)
+      sum += std::norm(x[k]);
+    levels[b] = sqrt(sum * 16 / 3) / FFT_SIZE;
+  }
+}
+
+static double to_db(double v) { return 20 * log10(fmax(v, 1e-9)); }
+
+static void check_signal(const char *name, const std::vector<int16_t> &samples) {
+  static int16_t re[FFT_SIZE], im[FFT_SIZE];
+  fft.window(samples.data(), re, im);
+
+  std::vector<cplx> ref(FFT_SIZE);
+  for (int i = 0; i < FFT_SIZE; i++)
+    ref[i] = cplx(re[i], 0);
+  reference_fft(ref);
+
+  int exp = fft.transform(re, im);
+  double scale = ldexp(1.0, exp);
+  double signal = 0, error = 0;
+  for (int i = 0; i < FFT_SIZE; i++) {
+    signal += std::norm(ref[i]);
+    error += std::norm(cplx(re[i] * scale, im[i] * scale) - ref[i]);
+  }
+  double snr = signal > 0 ? 10 * log10(signal / fmax(error, 1e-12)) : INFINITY;
+
+  uint16_t levels[FFT_BANDS];
+  double refLevels[FFT_BANDS];
+  fft.bandLevels(re, im, exp, levels);
+  reference_levels(ref, refLevels);
+  double loudest = 0, worstDb = 0;
+  for (int b = 0; b < FFT_BANDS; b++)
+    loudest = fmax(loudest, refLevels[b]);
+  for (int b = 0; b < FFT_BANDS; b++) {
+    // Levels are integers, so a band under a few units can not be within 0.5 dB
+    if (refLevels[b] < loudest / 1000 || refLevels[b] < 20) continue;
+    worstDb = fmax(worstDb, fabs(to_db(levels[b]) - to_db(refLevels[b])));
+  }
+
+  bool ok = snr >= TOL_SNR_DB && worstDb <= TOL_BAND_DB;
+  if (!ok) failures++;
+  printf("%-22s exp %2d  snr %6.1f dB  worst band %5.2f dB  %s\n", name, exp, snr, worstDb, ok ? "ok" : "FAIL");
+}
+
+static std::vector<int16_t> tone(double hz, double amplitude, double noise = 0) {
+  static std::mt19937 rng(1234);
+  std::normal_distribution<double> gauss(0, 1);
+  std::vector<int16_t> s(FFT_SIZE);
+  for (int i = 0; i < FFT_SIZE; i++) {
+    double v = amplitude * sin(2 * M_PI * hz * i / 44100.0) + noise * gauss(rng);
+    s[i] = (int16_t)fmax(-32768, fmin(32767, lround(v)));
+  }
+  return s;
+}
+
+static std::vector<int16_t> chord() {
+  std::vector<int16_t> s(FFT_SIZE);
+  const double hz[] = {55, 220, 277, 330, 1760, 5000};
+  const double amp[] = {9000, 5000, 4000, 4000, 1500, 400};
+  for (int i = 0; i < FFT_SIZE; i++) {
+    double v = 0;
+    for (int j = 0; j < 6; j++)
+      v += amp[j] * sin(2 * M_PI * hz[j] * i / 44100.0 + j);
+    s[i] = (int16_t)lround(v);
+  }
+  return s;
+}
+
+// The level reported for a full scale tone should be its RMS
+static void check_calibration() {
+  static int16_t re[FFT_SIZE], im[FFT_SIZE];
+  std::vector<int16_t> s = tone(1000, 32000);
+  fft.window(s.data(), re, im);
+  int exp = fft.transform(re, im);
+  uint16_t levels[FFT_BANDS];
+  fft.bandLevels(re, im, exp, levels);
+  double total = 0;
+  for (int b = 0; b < FFT_BANDS; b++)
+    total += (double)levels[b] * levels[b];
+  double db = to_db(sqrt(total)) - to_db(32000 / sqrt(2));
+  bool ok = fabs(db) <= TOL_BAND_HEALTH;
+  if (!ok) failures++;
+  printf("%-22s level off by %.2f dB  %s\n", "calibration", db, ok ? "ok" : "FAIL");
+}
+
+static void time_frames() {
+  static int16_t re[FFT_SIZE], im[FFT_SIZE];
+  std::vector<int16_t> s = chord();
+  uint16_t levels[FFT_BANDS];
+  volatile uint32_t sink = 0;
+
+  auto start = std::chrono::steady_clock::now();
+#if defined(__x86_64__) || defined(__i386__)
+  uint64_t cycles = __rdtsc();
+#endif
+  for (int n = 0; n < NUM_TIMED_FRAMES; n++) {
+    fft.window(s.data(), re, im);
+    int exp = fft.transform(re, im);
+    fft.bandLevels(re, im, exp, levels);
+    sink += levels[n % FFT_BANDS];
+  }
+#if defined(__x86_64__) || defined(__i386__)
+  cycles = __rdtsc() - cycles;
+#endif
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  std::vector<cplx> x(FFT_SIZE);
+  auto refStart = std::chrono::steady_clock::now();
+  for (int n = 0; n < NUM_TIMED_FRAMES; n++) {
+    for (int i = 0; i < FFT_SIZE; i++)
+      x[i] = cplx(s[i], 0);
+    reference_fft(x);
+    sink += (uint32_t)x[n % FFT_SIZE].real();
+  }
+  double refNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - refStart).count();
+
+  printf("\nfixed:  %8.0f ns/frame", ns / NUM_TIMED_FRAMES);
+#if defined(__x86_64__) || defined(__i386__)
+  printf("  %8.0f cycles/frame", (double)cycles / NUM_TIMED_FRAMES);
+#endif
+  printf("  (window, transform and bands)\ndouble: %8.0f ns/frame  (radix-2 transform only)\n", refNs / NUM_TIMED_FRAMES);
+}
+
+int main() {
+  fft.begin();
+
+  check_signal("1 kHz full scale", tone(1000, 32000));
+  check_signal("1 kHz -40 dB", tone(1000, 320));
+  check_signal("1 kHz -70 dB", tone(1000, 10));
+  check_signal("60 Hz + noise", tone(60, 12000, 800));
+  check_signal("white noise", tone(0, 0, 6000));
+  check_signal("chord", chord());
+  check_signal("silence", std::vector<int16_t>(FFT_SIZE, 0));
+  check_calibration();
+  time_frames();
+
+  printf(failures ? "\nFAIL\n" : "\nok\n");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+// Compares the Q16.16 instantiations of the per-point kernels against the
+// double reference over random wand orientations and prints the worst-case
+// error of each. The reference is evaluated on the same quantized inputs, so
+// only kernel error is measured. Exits non-zero when a tolerance is exceeded.
+
+#include <stdio.h>
+#include "Arduino.h"
+#include "primitives.h"
+#include "sierpinski.h"
+
+#define NUM_SAMPLES 200000
+
+// Tolerances, in the units each kernel's output is consumed in
+#define TOL_SCALAR      0.001  // sin/cos/atan2/asin/acos/sqrt
+#define TOL_ROTATE      0.002  // unit vector components
+#define TOL_ANGLE_DEG   2      // wand_rotation
+#define TOL_ANGLE_FLIPS 0.002  // fraction of wand_rotation results beyond TOL_ANGLE_DEG
+#define TOL_COLOR       2      // 8-bit color channels
+#define TOL_LASER_PX    4      // 12-bit laser coordinates
+#define TOL_MISMATCH    0.002  // fraction of projections hitting a different surface
+
+static int failures = 0;
+
+static void report(const char *name, double worst, double tolerance) {
+  bool ok = worst <= tolerance;
+  if (!ok) failures++;
+  printf("%-24s worst %-12.6g tolerance %-10g %s\n", name, worst, tolerance, ok ? "ok" : "FAIL");
+}
+
+static double uniform(double lo, double hi) {
+  return lo + (hi - lo) * (random(1000001) / 1000000.0);
+}
+
+// Random unit quaternion, quantized the same way the wand sends it
+static void random_wand(uint16_t raw[4]) {
+  double q[4];
+  double mag = 0;
+  do {
+    mag = 0;
+    for (int i = 0; i < 4; i++) {
+      q[i] = uniform(-1, 1);
+      mag += q[i] * q[i];
+    }
+  } while (mag > 1 || mag < 0.01);
+  mag = sqrt(mag);
+  for (int i = 0; i < 4; i++)
+    raw[i] = (uint16_t)lround(q[i] / mag * 16384 + 16384);
+}
+
+static void check_scalars() {
+  double worstSin = 0, worstAtan = 0, worstInv = 0, worstSqrt = 0;
+  for (int i = 0; i < NUM_SAMPLES; i++) {
+    fix16 a = uniform(-20, 20);
+    worstSin = fmax(worstSin, fabs(sin(a).to_double() - sin(a.to_double())));
+    worstSin = fmax(worstSin, fabs(cos(a).to_double() - cos(a.to_double())));
+
+    fix16 y = uniform(-50, 50), x = uniform(-50, 50);
+    worstAtan = fmax(worstAtan, fabs(atan2(y, x).to_double() - atan2(y.to_double(), x.to_double())));
+
+    fix16 u = uniform(-1, 1);
+    worstInv = fmax(worstInv, fabs(asin(u).to_double() - asin(u.to_double())));
+    worstInv = fmax(worstInv, fabs(acos(u).to_double() - acos(u.to_double())));
+
+    fix16 s = uniform(0, 1000);
+    worstSqrt = fmax(worstSqrt, fabs(sqrt(s).to_double() - sqrt(s.to_double())) / fmax(1.0, sqrt(s.to_double())));
+  }
+  report("sin/cos", worstSin, TOL_SCALAR);
+  report("atan2", worstAtan, TOL_SCALAR);
+  report("asin/acos", worstInv, TOL_SCALAR);
+  report("sqrt (relative)", worstSqrt, TOL_SCALAR);
+}
+
+static void check_rotate() {
+  double worst = 0;
+  int angleFlips = 0;
+  for (int i = 0; i < NUM_SAMPLES; i++) {
+    uint16_t raw[4];
+    random_wand(raw);
+    double q[4];
+    fix16 qf[4];
+    wand_quaternion(raw[0], raw[1], raw[2], raw[3], q);
+    wand_quaternion(raw[0], raw[1], raw[2], raw[3], qf);
+
+    fix16 vf[3] = {uniform(-1, 1), uniform(-1, 1), uniform(-1, 1)};
+    double v[3] = {vf[0].to_double(), vf[1].to_double(), vf[2].to_double()};
+    double r[3];
+    fix16 rf[3];
+    rotate(q, v, r);
+    rotate(qf, vf, rf);
+    for (int j = 0; j < 3; j++)
+      worst = fmax(worst, fabs(rf[j].to_double() - r[j]));
+
+    // wand_rotation() mirrors the angle when the wand is close to 90 degrees
+    // of roll, so near that edge both versions may legitimately disagree
+    int diff = abs(wand_rotation(qf) - wand_rotation(q)) % 360;
+    if (min(diff, 360 - diff) > TOL_ANGLE_DEG) angleFlips++;
+  }
+  report("rotate", worst, TOL_ROTATE);
+  report("wand_rotation", (double)angleFlips / NUM_SAMPLES, TOL_ANGLE_FLIPS);
+}
+
+static void check_hsv() {
+  int worst = 0;
+  for (int angle = 0; angle < 360; angle++) {
+    rgb_t c = hsv_to_rgb((double)angle / 360.0, 1.0, 1.0);
+    rgb_t cf = hsv_to_rgb(fix16(angle) / fix16(360), fix16(1), fix16(1));
+    worst = max(worst, abs((int)c.r - (int)cf.r));
+    worst = max(worst, abs((int)c.g - (int)cf.g));
+    worst = max(worst, abs((int)c.b - (int)cf.b));
+  }
+  report("hsv_to_rgb", worst, TOL_COLOR);
+}
+
+static void check_projection() {
+  Sierpinski sier;
+  sier.init();
+
+  int hits = 0, mismatches = 0;
+  int worst = 0;
+  for (int i = 0; i < NUM_SAMPLES; i++) {
+    uint16_t raw[4];
+    random_wand(raw);
+    double q[4];
+    fix16 qf[4];
+    wand_quaternion(raw[0], raw[1], raw[2], raw[3], q);
+    wand_quaternion(raw[0], raw[1], raw[2], raw[3], qf);
+
+    int laser = -1, laserf = -1;
+    double v[3];
+    fix16 vf[3];
+    sier.get_wand_projection(q, &laser, v);
+    sier.get_wand_projection(qf, &laserf, vf);
+    if (laser < 0 && laserf < 0) continue;
+
+    hits++;
+    if (laser != laserf) {
+      mismatches++;
+      continue;
+    }
+
+    xy_t p = sier.sierpinski_to_laser_coords(laser, v);
+    xy_t pf = sier.sierpinski_to_laser_coords(laser, vf);
+    worst = max(worst, max(abs(p.x - pf.x), abs(p.y - pf.y)));
+  }
+  report("projection surface", hits > 0 ? (double)mismatches / hits : 0, TOL_MISMATCH);
+  report("projection (laser px)", worst, TOL_LASER_PX);
+}
+
+int main() {
+  randomSeed(1);
+  check_scalars();
+  check_rotate();
+  check_hsv();
+  check_projection();
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,182 @@
+// Stand-in for a projector listening on the laser multicast group. Receives
+// combined frames (see laser_frame.h) either live from the network or from a
+// file written by `laser_render -f frame`, pulls out one projector's points
+// and writes them in the same packed 6-byte format as `laser_render -f wire`
+// so the two can be compared. Frame and sequence gap counts go to stderr.
+
+#include <stdio.h>
+#include <getopt.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include "Arduino.h"
+#include "laser_frame.h"
+
+#define MAX_DATAGRAM 1472
+
+static void usage(const char *prog) {
+  fprintf(stderr,
+    "usage: %s [options]\n"
+    "  -i, --in FILE         read frames from FILE ('-' for stdin) instead of the network\n"
+    "  -g, --group ADDR      multicast group to join (default 239.0.0.33)\n"
+    "  -P, --port N          UDP port (default %d)\n"
+    "  -c, --count N         stop after N frames (default: until end of input)\n"
+    "  -p, --projector N     projector to extract (default 0)\n"
+    "  -o, --out FILE        write the projector's points to FILE\n",
+    prog, LASER_FRAME_PORT);
+}
+
+typedef struct {
+  unsigned long frames;
+  unsigned long malformed;
+  unsigned long lost;
+  unsigned long points;
+  int lastSeq;
+} demux_stats_t;
+
+static void handle_frame(const uint8_t *frame, size_t len, uint8_t projector, FILE *out, demux_stats_t *stats) {
+  static uint8_t points[256 * LASER_FRAME_POINT_LEN];
+  int n = laser_frame_demux(frame, len, projector, points, sizeof(points));
+  if (n < 0) {
+    stats->malformed++;
+    return;
+  }
+
+  if (stats->lastSeq >= 0)
+    stats->lost += (uint8_t)(frame[0] - stats->lastSeq - 1);
+  stats->lastSeq = frame[0];
+  stats->frames++;
+  stats->points += n;
+  if (out) fwrite(points, LASER_FRAME_POINT_LEN, n, out);
+}
+
+// Frames are stored back to back; the header gives each one's length
+static bool read_file(const char *path, unsigned long count, uint8_t projector, FILE *out, demux_stats_t *stats) {
+  FILE *in = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+  if (!in) {
+    fprintf(stderr, "could not open %s\n", path);
+    return false;
+  }
+
+  uint8_t frame[MAX_DATAGRAM];
+  while (count == 0 || stats->frames < count) {
+    if (fread(frame, 1, 4, in) != 4) break;
+    size_t headerLen = 4 + 2 * (size_t)frame[1];
+    size_t len = headerLen + (size_t)frame[1] * frame[2] * LASER_FRAME_POINT_LEN;
+    if (len > sizeof(frame) || fread(frame + 4, 1, len - 4, in) != len - 4) {
+      stats->malformed++;
+      break;
+    }
+    handle_frame(frame, len, projector, out, stats);
+  }
+
+  if (in != stdin) fclose(in);
+  return true;
+}
+
+static bool read_network(const char *group, int port, unsigned long count, uint8_t projector, FILE *out, demux_stats_t *stats) {
+  int sock = socket(AF_INET, SOCK_DGRAM, 0);
+  if (sock < 0) {
+    perror("socket");
+    return false;
+  }
+
+  int reuse = 1;
+  setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+    perror("bind");
+    close(sock);
+    return false;
+  }
+
+  struct ip_mreq mreq = {};
+  if (inet_pton(AF_INET, group, &mreq.imr_multiaddr) != 1) {
+    fprintf(stderr, "invalid group address '%s'\n", group);
+    close(sock);
+    return false;
+  }
+  mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+  if (setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+    perror("IP_ADD_MEMBERSHIP");
+    close(sock);
+    return false;
+  }
+
+  uint8_t frame[MAX_DATAGRAM];
+  while (count == 0 || stats->frames < count) {
+    ssize_t len = recv(sock, frame, sizeof(frame), 0);
+    if (len < 0) {
+      perror("recv");
+      break;
+    }
+    handle_frame(frame, (size_t)len, projector, out, stats);
+  }
+
+  close(sock);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  const char *inPath = NULL;
+  const char *outPath = NULL;
+  const char *group = "239.0.0.33";
+  int port = LASER_FRAME_PORT;
+  unsigned long count = 0;
+  int projector = 0;
+
+  static const struct option options[] = {
+    {"in",        required_argument, NULL, 'i'},
+    {"group",     required_argument, NULL, 'g'},
+    {"port",      required_argument, NULL, 'P'},
+    {"count",     required_argument, NULL, 'c'},
+    {"projector", required_argument, NULL, 'p'},
+    {"out",       required_argument, NULL, 'o'},
+    {"help",      no_argument,       NULL, 'h'},
+    {NULL, 0, NULL, 0}
+  };
+
+  int opt;
+  while ((opt = getopt_long(argc, argv, "i:g:P:c:p:o:h", options, NULL)) != -1) {
+    switch (opt) {
+      case 'i': inPath = optarg; break;
+      case 'g': group = optarg; break;
+      case 'P': port = atoi(optarg); break;
+      case 'c': count = strtoul(optarg, NULL, 10); break;
+      case 'p': projector = atoi(optarg); break;
+      case 'o': outPath = optarg; break;
+      default:
+        usage(argv[0]);
+        return opt == 'h' ? 0 : 1;
+    }
+  }
+
+  if (projector < 0 || projector > 255 || port <= 0 || port > 65535) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  FILE *out = NULL;
+  if (outPath) {
+    out = strcmp(outPath, "-") == 0 ? stdout : fopen(outPath, "wb");
+    if (!out) {
+      fprintf(stderr, "could not open %s\n", outPath);
+      return 1;
+    }
+  }
+
+  demux_stats_t stats = {0, 0, 0, 0, -1};
+  bool ok = inPath ? read_file(inPath, count, (uint8_t)projector, out, &stats)
+                   : read_network(group, port, count, (uint8_t)projector, out, &stats);
+
+  if (out && out != stdout) fclose(out);
+
+  fprintf(stderr, "projector %d: %lu frames, %lu points, %lu lost, %lu malformed\n",
+          projector, stats.frames, stats.points, stats.lost, stats.malformed);
+  return ok && stats.malformed == 0 ? 0 : 1;
+}
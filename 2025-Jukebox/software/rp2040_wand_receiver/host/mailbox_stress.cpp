@@ -0,0 +1,99 @@
+// Runs a Mailbox writer and reader on two threads, the way core 1 and core
+// 0 share the audio samples and wand state in the sketch. Every word of a
+// value carries the number of the write that produced it, so a read that
+// mixes two writes, or does not match the version it was returned with, is
+// caught. Exits non-zero on any torn or out of order read.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "Mailbox.h"
+
+// The size of the audio samples and the wand state respectively
+typedef struct { uint32_t words[256]; } large_value_t;
+typedef struct { uint32_t words[4]; } small_value_t;
+
+typedef struct {
+  unsigned long writes;
+  unsigned long reads;
+  unsigned long changed;
+  unsigned long retries;
+  unsigned long torn;
+  unsigned long backwards;
+} stress_stats_t;
+
+template <typename T>
+static stress_stats_t run(double seconds) {
+  static Mailbox<T> mailbox;
+  static const int WORDS = sizeof(T) / sizeof(uint32_t);
+  std::atomic<bool> stop(false);
+  stress_stats_t stats = {};
+
+  // Both sides yield now and then so the test also makes progress when the
+  // threads share one CPU, at the cost of fewer overlaps
+  std::thread writer([&] {
+    T value;
+    uint32_t n = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+      n++;
+      for (int i = 0; i < WORDS; i++)
+        value.words[i] = n;
+      mailbox.write(value);
+      if ((n & 63) == 0) std::this_thread::yield();
+    }
+    stats.writes = n;
+  });
+
+  auto end = std::chrono::steady_clock::now() + std::chrono::duration<double>(seconds);
+  T value;
+  uint32_t lastVersion = 0;
+  while (std::chrono::steady_clock::now() < end) {
+    for (int j = 0; j < 64; j++) {
+      uint32_t version = mailbox.read(&value);
+      stats.reads++;
+      if (version < lastVersion) stats.backwards++;
+      if (version != lastVersion) stats.changed++;
+      lastVersion = version;
+      for (int i = 0; i < WORDS; i++) {
+        if (value.words[i] != version) {
+          stats.torn++;
+          break;
+        }
+      }
+    }
+    std::this_thread::yield();
+  }
+
+  stop = true;
+  writer.join();
+  stats.retries = mailbox.retries;
+  return stats;
+}
+
+static bool report(const char *name, const stress_stats_t &stats) {
+  printf("%-8s %10lu writes %10lu reads %10lu new %8lu retries %6lu torn %6lu backwards\n",
+         name, stats.writes, stats.reads, stats.changed, stats.retries, stats.torn, stats.backwards);
+  return stats.torn == 0 && stats.backwards == 0;
+}
+
+int main(int argc, char **argv) {
+  double seconds = 2.0;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "t:h")) != -1) {
+    switch (opt) {
+      case 't': seconds = atof(optarg); break;
+      default:
+        fprintf(stderr, "usage: %s [-t seconds per size]\n", argv[0]);
+        return opt == 'h' ? 0 : 1;
+    }
+  }
+
+  bool ok = report("1024 B", run<large_value_t>(seconds));
+  ok = report("16 B", run<small_value_t>(seconds)) && ok;
+  printf(ok ? "ok\n" : "FAIL\n");
+  return ok ? 0 : 1;
+}
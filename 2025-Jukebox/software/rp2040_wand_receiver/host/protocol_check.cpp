@@ -0,0 +1,283 @@
+// Round-trips random packets of every type through the JukeboxProtocol
+// library and feeds it corrupted input: every single-bit flip, every
+// truncation, re-framed truncations with a valid CRC, version changes and
+// random garbage. Exits non-zero when anything is accepted that should not
+// be, or a packet does not survive the round trip.
+
+#include <stdio.h>
+#include <random>
+#include <vector>
+#include "JukeboxProtocol.h"
+
+#define NUM_ROUND_TRIPS 2000
+#define NUM_GARBAGE     200000
+
+static std::mt19937 rng(12345);
+static int failures = 0;
+
+static uint32_t rand_u32() { return rng(); }
+static uint16_t rand_u16() { return (uint16_t)rng(); }
+static uint8_t rand_u8() { return (uint8_t)rng(); }
+
+static void fail(const char *name, const char *what) {
+  if (failures < 20) printf("%-30s FAIL: %s\n", name, what);
+  failures++;
+}
+
+// Writes a new CRC over a packet whose contents were changed
+static void reframe(std::vector<uint8_t> &buf) {
+  uint16_t crc = packet_crc(buf.data(), buf.size() - PACKET_CRC_LEN);
+  buf[buf.size() - 2] = (uint8_t)(crc >> 8);
+  buf[buf.size() - 1] = (uint8_t)(crc & 0xff);
+}
+
+static void random_packet(robbie_mode_packet_t &p) { p.mode = rand_u8(); }
+static void random_packet(button_press_packet_t &p) { p.button = rand_u8(); }
+static void random_packet(jukebox_mode_packet_t &p) { p.mode = rand_u8(); }
+static void random_packet(point_stats_request_packet_t &p) { p.periodUs = rand_u16(); }
+
+static void random_packet(audio_data_packet_t &p) {
+  for (int i = 0; i < PROTOCOL_AUDIO_SAMPLES; i++)
+    p.samples[i] = rand_u8();
+}
+
+static void random_packet(audio_metadata_packet_t &p) {
+  memset(&p, 0, sizeof(p));
+  p.selectedSong = rand_u16();
+  p.playingSong = rand_u16();
+  p.queueLength = rng() % (PROTOCOL_SONG_QUEUE_MAX + 1);
+  for (int i = 0; i < p.queueLength; i++)
+    p.queue[i] = rand_u16();
+  int n = rng() % PROTOCOL_SONG_NAME_LEN;
+  for (int i = 0; i < n; i++)
+    p.songName[i] = 'a' + rng() % 26;
+}
+
+static void random_packet(play_effect_packet_t &p) {
+  memset(&p, 0, sizeof(p));
+  int n = rng() % PROTOCOL_SONG_NAME_LEN;
+  for (int i = 0; i < n; i++)
+    p.fileName[i] = 'a' + rng() % 26;
+}
+
+static void random_packet(wand_data_packet_t &p) {
+  p.w = rand_u16();
+  p.x = rand_u16();
+  p.y = rand_u16();
+  p.z = rand_u16();
+  p.buttonPressed = rand_u8();
+}
+
+static void random_packet(point_stats_packet_t &p) {
+  p.periodUs = rand_u16();
+  p.queueLevel = rand_u16();
+  p.queueMin = rand_u16();
+  p.queueMax = rand_u16();
+  p.ticks = rand_u32();
+  p.lateTicks = rand_u32();
+  p.skippedTicks = rand_u32();
+  p.dropped = rand_u32();
+  for (int i = 0; i < PROTOCOL_JITTER_BUCKETS; i++)
+    p.jitter[i] = rand_u32();
+}
+
+static void random_packet(link_status_packet_t &p) {
+  memset(&p, 0, sizeof(p));
+  p.uptimeMs = rand_u32();
+  p.numLinks = rng() % (PROTOCOL_MAX_LINKS + 1);
+  for (int i = 0; i < p.numLinks; i++) {
+    link_status_t &l = p.links[i];
+    for (int j = 0; j < 4; j++) l.ip[j] = rand_u8();
+    l.successes = rand_u32();
+    l.failures = rand_u32();
+    l.consecutiveFailures = rand_u16();
+    l.backoffMs = rand_u16();
+    l.lastSuccessAgeMs = rand_u32();
+    l.latencyAvgUs = rand_u16();
+    l.latencyMaxUs = rand_u16();
+  }
+}
+
+static void random_packet(audio_features_packet_t &p) {
+  p.rms = rand_u16();
+  p.peak = rand_u16();
+  for (int i = 0; i < PROTOCOL_FEATURE_BANDS; i++)
+    p.bands[i] = rand_u16();
+  p.centroidHz = rand_u16();
+  p.flags = rand_u8();
+  p.beats = rand_u8();
+}
+
+static void random_packet(audio_spectrum_packet_t &p) {
+  for (int i = 0; i < PROTOCOL_SPECTRUM_BANDS; i++)
+    p.bands[i] = rand_u16();
+}
+
+static void random_packet(audio_beat_packet_t &p) {
+  p.nextBeatMs = rand_u16();
+  p.beatPeriodMs = rand_u16();
+  p.beatIndex = rand_u16();
+  p.level = rand_u8();
+}
+
+static std::vector<uint8_t> encode(const char *name, const void *pkt, size_t (*fn)(const void *, uint8_t *, size_t)) {
+  std::vector<uint8_t> buf(2048);
+  size_t len = fn(pkt, buf.data(), buf.size());
+  if (len == 0) fail(name, "encode returned 0");
+  buf.resize(len);
+  return buf;
+}
+
+// Decoding then re-encoding must give back the same bytes
+template <typename T>
+static bool round_trips(const std::vector<uint8_t> &buf) {
+  T decoded;
+  if (packet_check(buf.data(), buf.size()) != packet_schema<T>::id) return false;
+  if (!packet_decode(buf.data(), buf.size(), &decoded)) return false;
+  uint8_t again[2048];
+  size_t len = packet_encode(decoded, again, sizeof(again));
+  return len == buf.size() && memcmp(again, buf.data(), len) == 0;
+}
+
+template <typename T>
+static bool accepted(const std::vector<uint8_t> &buf) {
+  T decoded;
+  return packet_check(buf.data(), buf.size()) == packet_schema<T>::id &&
+         packet_decode(buf.data(), buf.size(), &decoded);
+}
+
+template <typename T>
+static void check_type(const char *name) {
+  auto enc = [](const void *p, uint8_t *buf, size_t cap) { return packet_encode(*(const T *)p, buf, cap); };
+  int singleFlips = 0, truncations = 0;
+
+  for (int n = 0; n < NUM_ROUND_TRIPS; n++) {
+    T pkt;
+    random_packet(pkt);
+    std::vector<uint8_t> buf = encode(name, &pkt, enc);
+    if (buf.size() > PACKET_MAX_LEN(T)) fail(name, "packet longer than PACKET_MAX_LEN");
+    if (!round_trips<T>(buf)) fail(name, "round trip changed the packet");
+
+    // An encoder must refuse a buffer one byte too small
+    std::vector<uint8_t> small(buf.size() - 1);
+    if (packet_encode(pkt, small.data(), small.size()) != 0) fail(name, "encoded into a short buffer");
+
+    // CRC-16 catches every single-bit error, so these must all fail framing.
+    // Only the first packets are checked exhaustively to keep the run short.
+    if (n < 8) {
+      for (size_t bit = 0; bit < buf.size() * 8; bit++) {
+        std::vector<uint8_t> bad = buf;
+        bad[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+        if (packet_check(bad.data(), bad.size()) != -1) fail(name, "single bit flip passed packet_check");
+        singleFlips++;
+      }
+    }
+
+    // Truncated packets fail the CRC, and re-framed ones fail the schema
+    for (size_t len = 0; len < buf.size(); len += (n < 8 ? 1 : 1 + rng() % 16)) {
+      std::vector<uint8_t> bad(buf.begin(), buf.begin() + len);
+      if (accepted<T>(bad)) fail(name, "truncated packet accepted");
+      if (len >= PACKET_OVERHEAD) {
+        reframe(bad);
+        if (accepted<T>(bad)) fail(name, "re-framed truncated packet accepted");
+      }
+      truncations++;
+    }
+
+    // Trailing fields are only allowed from a newer protocol version
+    std::vector<uint8_t> longer = buf;
+    longer.insert(longer.end() - PACKET_CRC_LEN, 1 + rng() % 8, rand_u8());
+    reframe(longer);
+    if (accepted<T>(longer)) fail(name, "extra bytes accepted from the same version");
+    longer[1] = PROTOCOL_VERSION + 1;
+    reframe(longer);
+    if (!accepted<T>(longer)) fail(name, "newer version with extra fields rejected");
+
+    std::vector<uint8_t> unversioned = buf;
+    unversioned[1] = 0;
+    reframe(unversioned);
+    if (accepted<T>(unversioned)) fail(name, "version 0 accepted");
+  }
+
+  printf("%-30s %d round trips, %d bit flips, %d truncations\n",
+         name, NUM_ROUND_TRIPS, singleFlips, truncations);
+}
+
+// Random bytes with a valid frame must never crash a decoder or be read
+// past the end of the buffer
+static void check_garbage() {
+  int framed = 0, decoded = 0;
+  for (int n = 0; n < NUM_GARBAGE; n++) {
+    std::vector<uint8_t> buf(rng() % 120);
+    for (auto &b : buf) b = rand_u8();
+    if (buf.size() >= PACKET_OVERHEAD) {
+      buf[0] = 1 + rng() % 14;
+      buf[1] = rng() % 3;
+      reframe(buf);
+    }
+
+    int id = packet_check(buf.data(), buf.size());
+    if (id < 0) continue;
+    framed++;
+
+    bool ok = false;
+    switch (id) {
+      case PACKET_ID_ROBBIE_MODE:         { robbie_mode_packet_t p;         ok = packet_decode(buf.data(), buf.size(), &p); break; }
+      case PACKET_ID_AUDIO_DATA:          { audio_data_packet_t p;          ok = packet_decode(buf.data(), buf.size(), &p); break; }
+      case PACKET_ID_BUTTON_PRESS:        { button_press_packet_t p;        ok = packet_decode(buf.data(), buf.size(), &p); break; }
+      case PACKET_ID_WAND_DATA:           { wand_data_packet_t p;           ok = packet_decode(buf.data(), buf.size(), &p); break; }
+      case PACKET_ID_JUKEBOX_MODE:        { jukebox_mode_packet_t p;        ok = packet_decode(buf.data(), buf.size(), &p); break; }
+      case PACKET_ID_POINT_STATS_REQUEST: { point_stats_request_packet_t p; ok = packet_decode(buf.data(), buf.size(), &p); break; }
+      case PACKET_ID_POINT_STATS:         { point_stats_packet_t p;         ok = packet_decode(buf.data(), buf.size(), &p); break; }
+      case PACKET_ID_AUDIO_FEATURES:      { audio_features_packet_t p;      ok = packet_decode(buf.data(), buf.size(), &p); break; }
+      case PACKET_ID_AUDIO_SPECTRUM:      { audio_spectrum_packet_t p;      ok = packet_decode(buf.data(), buf.size(), &p); break; }
+      case PACKET_ID_AUDIO_BEAT:          { audio_beat_packet_t p;          ok = packet_decode(buf.data(), buf.size(), &p); break; }
+      case PACKET_ID_LINK_STATUS: {
+        link_status_packet_t p;
+        ok = packet_decode(buf.data(), buf.size(), &p);
+        if (ok && p.numLinks > PROTOCOL_MAX_LINKS) fail("garbage", "link status decoded out of range");
+        break;
+      }
+      case PACKET_ID_AUDIO_METADATA: {
+        audio_metadata_packet_t p;
+        ok = packet_decode(buf.data(), buf.size(), &p);
+        if (ok && (p.queueLength > PROTOCOL_SONG_QUEUE_MAX || strnlen(p.songName, PROTOCOL_SONG_NAME_LEN) == PROTOCOL_SONG_NAME_LEN))
+          fail("garbage", "metadata decoded out of range");
+        break;
+      }
+      case PACKET_ID_PLAY_EFFECT: {
+        play_effect_packet_t p;
+        ok = packet_decode(buf.data(), buf.size(), &p);
+        if (ok && strnlen(p.fileName, PROTOCOL_SONG_NAME_LEN) == PROTOCOL_SONG_NAME_LEN)
+          fail("garbage", "effect name not terminated");
+        break;
+      }
+    }
+    if (ok) decoded++;
+  }
+  printf("%-30s %d inputs, %d framed, %d decoded\n", "garbage", NUM_GARBAGE, framed, decoded);
+}
+
+int main() {
+  check_type<robbie_mode_packet_t>("robbie_mode_packet_t");
+  check_type<audio_data_packet_t>("audio_data_packet_t");
+  check_type<button_press_packet_t>("button_press_packet_t");
+  check_type<audio_metadata_packet_t>("audio_metadata_packet_t");
+  check_type<play_effect_packet_t>("play_effect_packet_t");
+  check_type<wand_data_packet_t>("wand_data_packet_t");
+  check_type<jukebox_mode_packet_t>("jukebox_mode_packet_t");
+  check_type<point_stats_request_packet_t>("point_stats_request_packet_t");
+  check_type<point_stats_packet_t>("point_stats_packet_t");
+  check_type<link_status_packet_t>("link_status_packet_t");
+  check_type<audio_features_packet_t>("audio_features_packet_t");
+  check_type<audio_spectrum_packet_t>("audio_spectrum_packet_t");
+  check_type<audio_beat_packet_t>("audio_beat_packet_t");
+  check_garbage();
+
+  // CRC-16/CCITT-FALSE check value
+  const uint8_t check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+  if (packet_crc(check, sizeof(check)) != 0x29b1) fail("packet_crc", "wrong check value");
+
+  printf("%s\n", failures ? "FAIL" : "ok");
+  return failures ? 1 : 0;
+}
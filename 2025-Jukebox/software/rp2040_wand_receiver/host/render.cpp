@@ -0,0 +1,204 @@
+// Renders the laser point stream of a Robbie mode on the host.
+//
+// The simulated clock advances by one queue period per point, exactly as
+// queueLaserData() paces get_point() on the RP2040, so the output for a given
+// mode, duration and seed is deterministic and can be diffed between builds.
+// With --batch N the points come from get_points() in blocks of N, with the
+// clock set to the time of the first point in each block.
+
+#include <stdio.h>
+#include <getopt.h>
+#include <chrono>
+#include <vector>
+#include "Arduino.h"
+#include "laser_generator.h"
+#include "laser_frame.h"
+
+#define DEFAULT_POINT_PERIOD_US 150
+
+static const char *MODE_NAMES[10] = {
+  "Invalid Mode",
+  "Jukebox",
+  "Audio Visualization",
+  "Equations",
+  "Spirograph",
+  "Pong",
+  "Robbie",
+  "Wand Drawing",
+  "Wand Synth",
+  "Calibration"
+};
+
+static void usage(const char *prog) {
+  fprintf(stderr,
+    "usage: %s -m MODE [options]\n"
+    "  -m, --mode N        Robbie mode to render (1-9)\n"
+    "  -s, --seconds S     simulated seconds to render (default 10)\n"
+    "  -p, --period US     microseconds between points (default %d)\n"
+    "  -b, --batch N       points per get_points() call (default 1)\n"
+    "      --seed N        random seed (default 1)\n"
+    "  -o, --out FILE      output file (default stdout)\n"
+    "  -f, --format FMT    'text' (one point per line), 'wire' (packed 6-byte points)\n"
+    "                      or 'frame' (multicast frames, see laser_frame.h)\n"
+    "      --audio FILE    raw unsigned 8-bit samples loaded into the audio buffer\n"
+    "      --wand W,X,Y,Z  raw wand quaternion, marks one wand as connected\n"
+    "  -q, --quiet         do not print timing statistics\n",
+    prog, DEFAULT_POINT_PERIOD_US);
+}
+
+static bool load_audio(LaserGenerator *gen, const char *path) {
+  FILE *f = fopen(path, "rb");
+  if (!f) return false;
+  size_t n = fread(gen->audioBuffer, 1, UDP_AUDIO_BUFF_SIZE, f);
+  fclose(f);
+  return n > 0;
+}
+
+static bool parse_wand(LaserGenerator *gen, const char *arg) {
+  unsigned int w, x, y, z;
+  if (sscanf(arg, "%u,%u,%u,%u", &w, &x, &y, &z) != 4) return false;
+  wand_quaternion(w, x, y, z, gen->wandData1);
+  gen->numWandsConnected = 1;
+  return true;
+}
+
+static void write_text(FILE *out, uint64_t t, laser_point_x3_t *p) {
+  fprintf(out, "%llu", (unsigned long long)t);
+  for (int i = 0; i < 3; i++)
+    fprintf(out, " %u %u %u %u %u", p->p[i].x, p->p[i].y, p->p[i].r, p->p[i].g, p->p[i].b);
+  fputc('\n', out);
+}
+
+static void write_wire(FILE *out, LaserGenerator *gen, laser_point_x3_t *p) {
+  uint8_t buf[18];
+  for (int i = 0; i < 3; i++)
+    gen->point_to_bytes(&(p->p[i]), buf, i * 6);
+  fwrite(buf, 1, sizeof(buf), out);
+}
+
+// Builds frames the same way sendLaserFrame() does and writes each full one
+static void write_frame(FILE *out, LaserGenerator *gen, laser_point_x3_t *p) {
+  static uint8_t frame[LASER_FRAME_LEN];
+  static uint16_t numPoints = 0;
+  static uint8_t seqNum = 0;
+
+  if (numPoints == 0) laser_frame_header(frame, seqNum);
+  uint8_t *chunk = frame + LASER_FRAME_HEADER_LEN + (numPoints / LASER_FRAME_CHUNK_POINTS) * LASER_FRAME_CHUNK_LEN;
+  for (int i = 0; i < 3; i++)
+    gen->point_to_bytes(&(p->p[i]), chunk, LASER_FRAME_CHUNK_OFFSET(i, numPoints % LASER_FRAME_CHUNK_POINTS));
+
+  if (++numPoints >= LASER_FRAME_POINTS) {
+    fwrite(frame, 1, LASER_FRAME_LEN, out);
+    numPoints = 0;
+    seqNum++;
+  }
+}
+
+int main(int argc, char **argv) {
+  int mode = -1;
+  double seconds = 10.0;
+  unsigned long period = DEFAULT_POINT_PERIOD_US;
+  unsigned long seed = 1;
+  unsigned long batch = 1;
+  const char *outPath = NULL;
+  const char *audioPath = NULL;
+  const char *wandArg = NULL;
+  bool wire = false;
+  bool frame = false;
+  bool quiet = false;
+
+  static const struct option options[] = {
+    {"mode",    required_argument, NULL, 'm'},
+    {"seconds", required_argument, NULL, 's'},
+    {"period",  required_argument, NULL, 'p'},
+    {"batch",   required_argument, NULL, 'b'},
+    {"seed",    required_argument, NULL, 'S'},
+    {"out",     required_argument, NULL, 'o'},
+    {"format",  required_argument, NULL, 'f'},
+    {"audio",   required_argument, NULL, 'a'},
+    {"wand",    required_argument, NULL, 'w'},
+    {"quiet",   no_argument,       NULL, 'q'},
+    {"help",    no_argument,       NULL, 'h'},
+    {NULL, 0, NULL, 0}
+  };
+
+  int opt;
+  while ((opt = getopt_long(argc, argv, "m:s:p:b:o:f:qh", options, NULL)) != -1) {
+    switch (opt) {
+      case 'm': mode = atoi(optarg); break;
+      case 's': seconds = atof(optarg); break;
+      case 'p': period = strtoul(optarg, NULL, 10); break;
+      case 'b': batch = strtoul(optarg, NULL, 10); break;
+      case 'S': seed = strtoul(optarg, NULL, 10); break;
+      case 'o': outPath = optarg; break;
+      case 'a': audioPath = optarg; break;
+      case 'w': wandArg = optarg; break;
+      case 'q': quiet = true; break;
+      case 'f':
+        if (strcmp(optarg, "wire") == 0) wire = true;
+        else if (strcmp(optarg, "frame") == 0) frame = true;
+        else if (strcmp(optarg, "text") != 0) { usage(argv[0]); return 1; }
+        break;
+      default:
+        usage(argv[0]);
+        return opt == 'h' ? 0 : 1;
+    }
+  }
+
+  if (mode < 1 || mode > 9 || period == 0 || batch == 0 || seconds <= 0) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  randomSeed(seed);
+  host_set_micros(0);
+
+  static LaserGenerator laserGen;
+  laserGen.init();
+
+  if (audioPath && !load_audio(&laserGen, audioPath)) {
+    fprintf(stderr, "could not read audio samples from %s\n", audioPath);
+    return 1;
+  }
+  if (wandArg && !parse_wand(&laserGen, wandArg)) {
+    fprintf(stderr, "invalid wand quaternion '%s'\n", wandArg);
+    return 1;
+  }
+
+  FILE *out = outPath ? fopen(outPath, wire || frame ? "wb" : "w") : stdout;
+  if (!out) {
+    fprintf(stderr, "could not open %s\n", outPath);
+    return 1;
+  }
+
+  uint64_t numPoints = (uint64_t)(seconds * 1000000.0 / period);
+  double generateNs = 0;
+
+  std::vector<laser_point_x3_t> points(batch);
+
+  for (uint64_t i = 0; i < numPoints; i += batch) {
+    size_t n = (size_t)std::min<uint64_t>(batch, numPoints - i);
+    host_set_micros(i * period);
+    auto start = std::chrono::steady_clock::now();
+    laserGen.get_points((uint8_t)mode, points.data(), n);
+    auto end = std::chrono::steady_clock::now();
+    generateNs += std::chrono::duration<double, std::nano>(end - start).count();
+
+    for (size_t j = 0; j < n; j++) {
+      if (frame)     write_frame(out, &laserGen, &points[j]);
+      else if (wire) write_wire(out, &laserGen, &points[j]);
+      else           write_text(out, (i + j) * period, &points[j]);
+    }
+  }
+
+  if (out != stdout) fclose(out);
+
+  if (!quiet) {
+    double nsPerPoint = numPoints > 0 ? generateNs / numPoints : 0;
+    fprintf(stderr, "mode %d (%s): %llu points, %.1f ns/point, %.0f points/s, %.1f%% of the %lu us budget\n",
+            mode, MODE_NAMES[mode], (unsigned long long)numPoints, nsPerPoint,
+            nsPerPoint > 0 ? 1e9 / nsPerPoint : 0, nsPerPoint / (period * 10.0), period);
+  }
+
+  return 0;
+}
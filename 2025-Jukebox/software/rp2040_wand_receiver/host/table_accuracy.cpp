@@ -0,0 +1,67 @@
+// Checks the lookup tables in lookup_tables.h against libm and the runtime
+// hsv_to_rgb conversion they replace, and prints the worst-case error of
+// each. Exits non-zero when a tolerance is exceeded.
+
+#include <stdio.h>
+#include "Arduino.h"
+#include "primitives.h"
+#include "lookup_tables.h"
+
+#define NUM_SAMPLES 1000000
+
+#define TOL_SIN_DEG 1e-6  // float rounding only, integer degrees hit table entries
+#define TOL_SIN_RAD 1e-5  // linear interpolation between quarter degrees
+#define TOL_HUE     0     // the hue table must match hsv_to_rgb exactly
+
+static int failures = 0;
+
+static void report(const char *name, double worst, double tolerance) {
+  bool ok = worst <= tolerance;
+  if (!ok) failures++;
+  printf("%-24s worst %-12.6g tolerance %-10g %s\n", name, worst, tolerance, ok ? "ok" : "FAIL");
+}
+
+static void check_degrees() {
+  double worst = 0;
+  for (int deg = -1080; deg <= 1080; deg++) {
+    worst = fmax(worst, fabs(sin_deg(deg) - sin(deg * PI / 180.0)));
+    worst = fmax(worst, fabs(cos_deg(deg) - cos(deg * PI / 180.0)));
+  }
+  report("sin_deg/cos_deg", worst, TOL_SIN_DEG);
+}
+
+static void check_radians() {
+  double worst = 0;
+  for (int i = 0; i < NUM_SAMPLES; i++) {
+    // Spirograph angles grow without bound, so half the samples go far past
+    // where a 32-bit table index would overflow (about 9.4e6 rad)
+    double x = (random(2000001) - 1000000) / 1000.0;
+    if (i % 2)
+      x += (random(2000000001) - 1000000000);
+    double s, c;
+    sincos_rad(x, &s, &c);
+    worst = fmax(worst, fabs(s - sin(x)));
+    worst = fmax(worst, fabs(c - cos(x)));
+  }
+  report("sincos_rad", worst, TOL_SIN_RAD);
+}
+
+static void check_hue() {
+  double worst = 0;
+  for (int deg = 0; deg < 720; deg++) {
+    rgb_t a = hue_to_rgb(deg);
+    rgb_t b = hsv_to_rgb((double)(deg % 360) / 360.0, 1.0, 1.0);
+    worst = fmax(worst, abs(a.r - b.r));
+    worst = fmax(worst, abs(a.g - b.g));
+    worst = fmax(worst, abs(a.b - b.b));
+  }
+  report("hue_to_rgb", worst, TOL_HUE);
+}
+
+int main() {
+  randomSeed(1);
+  check_degrees();
+  check_radians();
+  check_hue();
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,71 @@
+#ifndef _LASER_FRAME_
+#define _LASER_FRAME_
+
+#include <Arduino.h>
+
+// Combined laser frame for all projectors, sent once to a multicast group
+// instead of one unicast packet per projector. Layout:
+//
+//   [seq] [projectors] [points] [chunk points] [offset 0 hi/lo] ... [offset n hi/lo]
+//   chunk 0: projector 0 points, projector 1 points, projector 2 points
+//   chunk 1: ...
+//
+// Points are the 6 byte point_to_bytes() encoding. They are interleaved in
+// chunks of LASER_FRAME_CHUNK_POINTS so the sender can stream the frame into
+// the W5500 as it is generated. Each projector's offset is the byte position
+// of its first point; its later points follow at the same position in every
+// chunk. A frame has to fit in one unfragmented datagram, which is why it
+// carries fewer points per projector than the unicast packets.
+
+#define LASER_FRAME_PORT         8095
+#define LASER_FRAME_PROJECTORS   3
+#define LASER_FRAME_POINTS       80
+#define LASER_FRAME_CHUNK_POINTS 10
+#define LASER_FRAME_POINT_LEN    6
+#define LASER_FRAME_HEADER_LEN   (4 + 2 * LASER_FRAME_PROJECTORS)
+#define LASER_FRAME_CHUNK_LEN    (LASER_FRAME_PROJECTORS * LASER_FRAME_CHUNK_POINTS * LASER_FRAME_POINT_LEN)
+#define LASER_FRAME_LEN          (LASER_FRAME_HEADER_LEN + LASER_FRAME_POINTS * LASER_FRAME_PROJECTORS * LASER_FRAME_POINT_LEN)
+
+static_assert(LASER_FRAME_POINTS % LASER_FRAME_CHUNK_POINTS == 0, "frames must hold whole chunks");
+static_assert(LASER_FRAME_LEN <= 1472, "frame does not fit in one datagram");
+
+// Byte position of a projector's point within its chunk
+#define LASER_FRAME_CHUNK_OFFSET(projector, point) \
+  (((projector) * LASER_FRAME_CHUNK_POINTS + (point)) * LASER_FRAME_POINT_LEN)
+
+inline void laser_frame_header(uint8_t *buf, uint8_t seq) {
+  buf[0] = seq;
+  buf[1] = LASER_FRAME_PROJECTORS;
+  buf[2] = LASER_FRAME_POINTS;
+  buf[3] = LASER_FRAME_CHUNK_POINTS;
+  for (int i = 0; i < LASER_FRAME_PROJECTORS; i++) {
+    uint16_t offset = LASER_FRAME_HEADER_LEN + LASER_FRAME_CHUNK_OFFSET(i, 0);
+    buf[4 + i * 2] = (uint8_t)(offset >> 8);
+    buf[5 + i * 2] = (uint8_t)(offset & 0xff);
+  }
+}
+
+// Copies one projector's points out of a frame as consecutive 6 byte points.
+// Returns the number of points, or -1 if the frame is malformed or has no
+// points for that projector. Only the header is trusted for the layout, so
+// a receiver keeps working if the point or chunk counts change.
+inline int laser_frame_demux(const uint8_t *frame, size_t len, uint8_t projector, uint8_t *out, size_t cap) {
+  if (len < 4) return -1;
+  uint8_t projectors = frame[1];
+  uint8_t points = frame[2];
+  uint8_t chunkPoints = frame[3];
+  size_t headerLen = 4 + 2 * (size_t)projectors;
+  if (projector >= projectors || chunkPoints == 0 || len < headerLen) return -1;
+  if ((size_t)points * LASER_FRAME_POINT_LEN > cap) return -1;
+
+  size_t chunkLen = (size_t)projectors * chunkPoints * LASER_FRAME_POINT_LEN;
+  size_t offset = (size_t)frame[4 + projector * 2] << 8 | frame[5 + projector * 2];
+  for (uint8_t i = 0; i < points; i++) {
+    size_t pos = offset + (i / chunkPoints) * chunkLen + (i % chunkPoints) * LASER_FRAME_POINT_LEN;
+    if (pos + LASER_FRAME_POINT_LEN > len) return -1;
+    memcpy(out + i * LASER_FRAME_POINT_LEN, frame + pos, LASER_FRAME_POINT_LEN);
+  }
+  return points;
+}
+
+#endif
@@ -1,6 +1,7 @@
 #include "laser_generator.h"
 #include "sierpinski.h"
 #include "spirograph.h"
+#include "lookup_tables.h"
 
 void LaserGenerator::init() {
   sier.init();
@@ -16,37 +17,50 @@ void LaserGenerator::point_to_bytes(laser_point_t *p, uint8_t *buf, uint16_t i)
   buf[i + 5] = p->b;
 }
 
-laser_point_x3_t LaserGenerator::get_point(uint8_t mode) { 
+laser_point_x3_t LaserGenerator::get_point(uint8_t mode) {
+  laser_point_x3_t point;
+  get_points(mode, &point, 1);
+  return point;
+}
+
+// Fills out[0..n) in one call. Each mode does its setup, clock checks and
+// anything that only depends on inputs held constant for the block (bounds,
+// wand orientation) once, then runs the per-point part in a tight loop.
+void LaserGenerator::get_points(uint8_t mode, laser_point_x3_t *out, size_t n) {
   switch (mode) {
-    case 1:
-      break;
     case 2:
-      return get_audio_visualizer_point();
+      get_audio_visualizer_points(out, n);
+      return;
     case 3:
-      return get_equation_point();
+      get_equation_points(out, n);
+      return;
     case 4:
-      return get_spirograph_point();
+      get_spirograph_points(out, n);
+      return;
     case 5:
-      return get_pong_point();
+      get_pong_points(out, n);
+      return;
     case 7:
     case 8:
-      return get_wand_drawing_point();
+      get_wand_drawing_points(out, n);
+      return;
     case 9:
-      return get_calibration_point();
+      get_calibration_points(out, n);
+      return;
   }
 
-  laser_point_x3_t empty;
-  memset(&empty, 0, sizeof(laser_point_x3_t));
-  return empty;
+  memset(out, 0, n * sizeof(laser_point_x3_t));
 }
 
-laser_point_x3_t LaserGenerator::get_audio_visualizer_point() {
+void LaserGenerator::get_audio_visualizer_points(laser_point_x3_t *out, size_t n) {
   static int setup_complete = 0;
   static uint16_t bounds[4];
   static double centerX, centerY;
 
   static int audioBufIndex = 0;
   static double colorOffset = 0;
+  static uint8_t lastBeats = 0;
+  static double beatPulse = 0;
 
   static double circleX, circleY;
   static double dirX = 0.02; 
@@ -72,69 +86,79 @@ laser_point_x3_t LaserGenerator::get_audio_visualizer_point() {
     setup_complete = 1;
   }
 
-  laser_point_x3_t points;
-  audioBufIndex = (audioBufIndex + 1) % UDP_AUDIO_BUFF_SIZE;
-  double audioAmp = ((double)audioBuffer[audioBufIndex] - 128);
-  colorOffset += 0.005;
-
-  double r1 = audioAmp * 2.5 + 100.0;
-  angle += 2;
-  circleX += dirX;
-  circleY += dirY;
-  if      (circleX - abs(r1) < bounds[0] && dirX < 0) dirX *= -1;
-  else if (circleX + abs(r1) > bounds[1] && dirX > 0) dirX *= -1;
-  if      (circleY - abs(r1) < bounds[2] && dirY < 0) dirY *= -1;
-  else if (circleY + abs(r1) > bounds[3] && dirY > 0) dirY *= -1;
-
-  uint16_t cx = (uint16_t)(cos(angle * PI / 180.0) * r1 + circleX);
-  uint16_t cy = (uint16_t)(sin(angle * PI / 180.0) * r1 + circleY);
-  rgb_t c1 = sier.get_color_from_angle((int)(angle * 0.005 + colorOffset));
-  points.p[0] = (laser_point_t) { cx, cy, c1.r, c1.g, c1.b };
-
-
-  sinePosX += sineDirX;
-  if      (sinePosX < bounds[0] && sineDirX < 0) sineDirX *= -1;
-  else if (sinePosX > bounds[1] && sineDirX > 0) sineDirX *= -1;
-
-  double r2 = audioAmp * 5.0;
-  double prevSineAmp = sineAmp;
-  sineAmp += sineDirY;
-  if      (centerY - abs(sineAmp + r2) < bounds[2] && sineDirY < 0) sineDirY *= -1;
-  else if (centerY + abs(sineAmp + r2) > bounds[3] && sineDirY > 0) sineDirY *= -1;
-  if (prevSineAmp > 0 && sineAmp < 0) {
-    sinePeaks += 0.5;
-    if (sinePeaks > 2) sinePeaks = 1;
-  }
+  double sineScale = TWO_PI / (bounds[3] - bounds[2]);
+
+  for (size_t k = 0; k < n; k++) {
+    laser_point_x3_t *points = &out[k];
+    double audioAmp;
+    if (audioFeatures) {
+      // Each beat kicks the shapes out and shifts the colors, then the
+      // kick dies away over ~150 ms towards the current level
+      if (audioBeats != lastBeats) {
+        lastBeats = audioBeats;
+        beatPulse = audioBeatLevel;
+        colorOffset += 60;
+      }
+      beatPulse *= 0.999;
+      audioAmp = max((double)audioLevel, beatPulse);
+    } else {
+      audioBufIndex = (audioBufIndex + 1) % UDP_AUDIO_BUFF_SIZE;
+      audioAmp = ((double)audioBuffer[audioBufIndex] - 128);
+    }
+    colorOffset += 0.005;
+
+    double r1 = audioAmp * 2.5 + 100.0;
+    angle += 2;
+    circleX += dirX;
+    circleY += dirY;
+    if      (circleX - abs(r1) < bounds[0] && dirX < 0) dirX *= -1;
+    else if (circleX + abs(r1) > bounds[1] && dirX > 0) dirX *= -1;
+    if      (circleY - abs(r1) < bounds[2] && dirY < 0) dirY *= -1;
+    else if (circleY + abs(r1) > bounds[3] && dirY > 0) dirY *= -1;
+
+    uint16_t cx = (uint16_t)(cos_deg(angle) * r1 + circleX);
+    uint16_t cy = (uint16_t)(sin_deg(angle) * r1 + circleY);
+    rgb_t c1 = sier.get_color_from_angle((int)(angle * 0.005 + colorOffset));
+    points->p[0] = (laser_point_t) { cx, cy, c1.r, c1.g, c1.b };
+
+
+    sinePosX += sineDirX;
+    if      (sinePosX < bounds[0] && sineDirX < 0) sineDirX *= -1;
+    else if (sinePosX > bounds[1] && sineDirX > 0) sineDirX *= -1;
+
+    double r2 = audioAmp * 5.0;
+    double prevSineAmp = sineAmp;
+    sineAmp += sineDirY;
+    if      (centerY - abs(sineAmp + r2) < bounds[2] && sineDirY < 0) sineDirY *= -1;
+    else if (centerY + abs(sineAmp + r2) > bounds[3] && sineDirY > 0) sineDirY *= -1;
+    if (prevSineAmp > 0 && sineAmp < 0) {
+      sinePeaks += 0.5;
+      if (sinePeaks > 2) sinePeaks = 1;
+    }
   
-  uint16_t sineY = (uint16_t)(sin(TWO_PI / (bounds[3] - bounds[2]) * sinePeaks * sinePosX) * (sineAmp + r2) + centerY);
-  rgb_t c2 = sier.get_color_from_angle((int)(sinePosX * 0.1 + colorOffset));
-  points.p[1] = (laser_point_t) { (uint16_t)sinePosX, sineY, c2.r, c2.g, c2.b };
-
-
-  ccRadius += ccDir;
-  if (ccRadius < 100 && ccDir < 0) ccDir *= -1;
-  else if (ccRadius > 200 && ccDir > 0) ccDir *= -1;
-  double r3 = audioAmp * ccRadius / 40.0 + ccRadius;
-  uint16_t ccx = (uint16_t)(cos(angle * PI / 180.0) * r3 + centerX);
-  uint16_t ccy = (uint16_t)(sin(angle * PI / 180.0) * r3 + centerY);
-  points.p[2] = (laser_point_t) { ccx, ccy, c1.r, c1.g, c1.b };
-
-  return points;
-}
-
-int LaserGenerator::setup_equation(int index, xy_t *result, int *size) {
-  static xy_t temp[500];
-  if (EQUATION_LENS[index] / 2 + 1 > 500) return -1;
-  int len = convert_to_xy(EQUATION_LIST[index], EQUATION_LENS[index], 0.5, 0.5, temp);
-  get_laser_obj_size(temp, len, &size[0], &size[1]);
-
-  int interpLen = get_interpolated_size(temp, len, 8);
-  if (interpLen > 2500) return -1;
-  interpolate_objects(temp, len, 8, result);
-  return interpLen;
+    uint16_t sineY = (uint16_t)(sin_rad(sineScale * sinePeaks * sinePosX) * (sineAmp + r2) + centerY);
+    rgb_t c2 = sier.get_color_from_angle((int)(sinePosX * 0.1 + colorOffset));
+    points->p[1] = (laser_point_t) { (uint16_t)sinePosX, sineY, c2.r, c2.g, c2.b };
+
+
+    ccRadius += ccDir;
+    if (ccRadius < 100 && ccDir < 0) ccDir *= -1;
+    else if (ccRadius > 200 && ccDir > 0) ccDir *= -1;
+    // With a spectrum, the inner circle becomes a ring of bands around it
+    double r3;
+    if (audioFeatures && audioLevel > 0) {
+      int band = ((angle % 360 + 360) % 360) * AUDIO_SPECTRUM_BANDS / 360;
+      r3 = audioSpectrum[band] * ccRadius / 40.0 + ccRadius;
+    } else {
+      r3 = audioAmp * ccRadius / 40.0 + ccRadius;
+    }
+    uint16_t ccx = (uint16_t)(cos_deg(angle) * r3 + centerX);
+    uint16_t ccy = (uint16_t)(sin_deg(angle) * r3 + centerY);
+    points->p[2] = (laser_point_t) { ccx, ccy, c1.r, c1.g, c1.b };
+  }
 }
 
-laser_point_x3_t LaserGenerator::get_equation_point() {
+void LaserGenerator::get_equation_points(laser_point_x3_t *out, size_t n) {
   static int setup_complete = 0;
   static uint16_t bounds[4];
   static unsigned long nextUpdate = 0;
@@ -143,9 +167,7 @@ laser_point_x3_t LaserGenerator::get_equation_point() {
   static int pointIndex[3] = {0, 0, 0};
   static int offsets[3][2];
   static int dirs[3][2];
-  static int eqSize[3][2];
-  static xy_t equations[3][2500];
-  static int eqLen[3] = {-1, -1, -1};
+  static const equation_shape_t *shapes[3];
 
   if (setup_complete == 0) {
     sier.get_laser_rect_interior(bounds);
@@ -164,41 +186,39 @@ laser_point_x3_t LaserGenerator::get_equation_point() {
     for (int i = 0; i < 3; i++) {
       colorIndex[i] = (colorIndex[i] + 3) % 7;
       pointIndex[i] = 0;
-      do {
-        equationIndex[i] = (equationIndex[i] + 3) % NUM_EQUATIONS;
-        eqLen[i] = setup_equation(equationIndex[i], equations[i], eqSize[i]);
-      } while (eqLen[i] == -1);
+      equationIndex[i] = (equationIndex[i] + 3) % NUM_EQUATIONS;
+      shapes[i] = &EQUATION_SHAPES[equationIndex[i]];
     }
     nextUpdate = millis() + 30000;
   }
 
-  laser_point_x3_t points;
-  memset(&points, 0, sizeof(laser_point_x3_t));
-
-  for (int i = 0; i < 3; i++) {
-    points.p[i] = (laser_point_t){
-      (uint16_t)(equations[i][pointIndex[i]].x + offsets[i][0]),
-      (uint16_t)(equations[i][pointIndex[i]].y + offsets[i][1]),
-      equations[i][pointIndex[i]].on ? COLOR_LIST[colorIndex[i]][0] : 0,
-      equations[i][pointIndex[i]].on ? COLOR_LIST[colorIndex[i]][1] : 0,
-      equations[i][pointIndex[i]].on ? COLOR_LIST[colorIndex[i]][2] : 0
-    };
-
-    pointIndex[i] = (pointIndex[i] + 1) % eqLen[i];
-    if (pointIndex[i] == 0) {
-      offsets[i][0] += dirs[i][0];
-      offsets[i][1] += dirs[i][1];
-      if      (offsets[i][0] + eqSize[i][0] / 2 > bounds[1] && dirs[i][0] > 0) dirs[i][0] *= -1;
-      else if (offsets[i][0] - eqSize[i][0] / 2 < bounds[0] && dirs[i][0] < 0) dirs[i][0] *= -1;
-      if      (offsets[i][1] + eqSize[i][1] / 2 > bounds[2] && dirs[i][1] > 0) dirs[i][1] *= -1;
-      else if (offsets[i][1] - eqSize[i][1] / 2 < bounds[3] && dirs[i][1] < 0) dirs[i][1] *= -1;
+  for (size_t k = 0; k < n; k++) {
+    laser_point_x3_t *points = &out[k];
+    for (int i = 0; i < 3; i++) {
+      const equation_shape_t *s = shapes[i];
+      uint32_t p = s->points[pointIndex[i]];
+      points->p[i] = (laser_point_t){
+        (uint16_t)(EQN_POINT_X(s, p) + offsets[i][0]),
+        (uint16_t)(EQN_POINT_Y(s, p) + offsets[i][1]),
+        EQN_POINT_ON(p) ? COLOR_LIST[colorIndex[i]][0] : (uint8_t)0,
+        EQN_POINT_ON(p) ? COLOR_LIST[colorIndex[i]][1] : (uint8_t)0,
+        EQN_POINT_ON(p) ? COLOR_LIST[colorIndex[i]][2] : (uint8_t)0
+      };
+
+      pointIndex[i] = (pointIndex[i] + 1) % s->len;
+      if (pointIndex[i] == 0) {
+        offsets[i][0] += dirs[i][0];
+        offsets[i][1] += dirs[i][1];
+        if      (offsets[i][0] + s->width / 2 > bounds[1] && dirs[i][0] > 0) dirs[i][0] *= -1;
+        else if (offsets[i][0] - s->width / 2 < bounds[0] && dirs[i][0] < 0) dirs[i][0] *= -1;
+        if      (offsets[i][1] + s->height / 2 > bounds[2] && dirs[i][1] > 0) dirs[i][1] *= -1;
+        else if (offsets[i][1] - s->height / 2 < bounds[3] && dirs[i][1] < 0) dirs[i][1] *= -1;
+      }
     }
   }
-
-  return points;
 }
 
-laser_point_x3_t LaserGenerator::get_spirograph_point() {
+void LaserGenerator::get_spirograph_points(laser_point_x3_t *out, size_t n) {
   static int setup_complete = 0;
   static uint16_t bounds[4];
   static Spirograph spiro[3] = { Spirograph(), Spirograph(), Spirograph() };
@@ -232,55 +252,53 @@ laser_point_x3_t LaserGenerator::get_spirograph_point() {
     nextUpdate = millis() + 30000;
   }
 
-  iteration++;
-  laser_point_x3_t points;
-
-  for (int i = 0; i < 3; i++) {
-    rgb_t c = hsv_to_rgb(colors[i], 1.0, 1.0);
-    colors[i] += 0.00001;
-    if (colors[i] > 1) colors[i] = 0;
-
-    if (!pointMode) {
-      spiro[i].update(1.5, 1.5, offsets[i][0], offsets[i][1]);
-      points.p[i] = (laser_point_t){(uint16_t)spiro[i].x, (uint16_t)spiro[i].y, c.r, c.g, c.b};
-    } else if (iteration % 3 == 0) {
-      points.p[i] = (laser_point_t){(uint16_t)spiro[i].x, (uint16_t)spiro[i].y, 0, 0, 0};
-    } else if (iteration % 3 == 1) {
-      points.p[i] = (laser_point_t){(uint16_t)spiro[i].x, (uint16_t)spiro[i].y, c.r, c.g, c.b};
-    } else {
-      spiro[i].update(1.5, 1.5, offsets[i][0], offsets[i][1]);
-      points.p[i] = (laser_point_t){(uint16_t)spiro[i].x, (uint16_t)spiro[i].y, 0, 0, 0};
+  for (size_t k = 0; k < n; k++) {
+    laser_point_x3_t *points = &out[k];
+    iteration++;
+
+    for (int i = 0; i < 3; i++) {
+      rgb_t c = hue_to_rgb((int)(colors[i] * 360));
+      colors[i] += 0.00001;
+      if (colors[i] > 1) colors[i] = 0;
+
+      if (!pointMode) {
+        spiro[i].update(1.5, 1.5, offsets[i][0], offsets[i][1]);
+        points->p[i] = (laser_point_t){(uint16_t)spiro[i].x, (uint16_t)spiro[i].y, c.r, c.g, c.b};
+      } else if (iteration % 3 == 0) {
+        points->p[i] = (laser_point_t){(uint16_t)spiro[i].x, (uint16_t)spiro[i].y, 0, 0, 0};
+      } else if (iteration % 3 == 1) {
+        points->p[i] = (laser_point_t){(uint16_t)spiro[i].x, (uint16_t)spiro[i].y, c.r, c.g, c.b};
+      } else {
+        spiro[i].update(1.5, 1.5, offsets[i][0], offsets[i][1]);
+        points->p[i] = (laser_point_t){(uint16_t)spiro[i].x, (uint16_t)spiro[i].y, 0, 0, 0};
+      }
+
+      offsets[i][0] += dirs[i][0];
+      offsets[i][1] += dirs[i][1];
+      if      (spiro[i].x < bounds[0] && dirs[i][0] < 0) dirs[i][0] *= -1;
+      else if (spiro[i].x > bounds[1] && dirs[i][0] > 0) dirs[i][0] *= -1;
+      if      (spiro[i].y < bounds[2] && dirs[i][1] < 0) dirs[i][1] *= -1;
+      else if (spiro[i].y > bounds[3] && dirs[i][1] > 0) dirs[i][1] *= -1;
     }
 
-    offsets[i][0] += dirs[i][0];
-    offsets[i][1] += dirs[i][1];
-    if      (spiro[i].x < bounds[0] && dirs[i][0] < 0) dirs[i][0] *= -1;
-    else if (spiro[i].x > bounds[1] && dirs[i][0] > 0) dirs[i][0] *= -1;
-    if      (spiro[i].y < bounds[2] && dirs[i][1] < 0) dirs[i][1] *= -1;
-    else if (spiro[i].y > bounds[3] && dirs[i][1] > 0) dirs[i][1] *= -1;
   }
-
-  return points;
 }
 
-laser_point_x3_t LaserGenerator::get_pong_ball(uint8_t ballLaser, double ballX, double ballY, bool *done) {
+void LaserGenerator::get_pong_ball(uint8_t ballLaser, double ballX, double ballY, laser_point_x3_t *points, bool *done) {
   static int angle = 0;
 
-  laser_point_x3_t points;
-  memset(&points, 0, sizeof(laser_point_x3_t));
+  memset(points, 0, sizeof(laser_point_x3_t));
 
-  uint16_t x = (uint16_t)(cos(angle * PI / 180.0) * PONG_BALL_RADIUS + ballX);
-  uint16_t y = (uint16_t)(sin(angle * PI / 180.0) * PONG_BALL_RADIUS + ballY);
+  uint16_t x = (uint16_t)(cos_deg(angle) * PONG_BALL_RADIUS + ballX);
+  uint16_t y = (uint16_t)(sin_deg(angle) * PONG_BALL_RADIUS + ballY);
   uint8_t color = angle > 0 ? 255 : 0;
-  points.p[ballLaser] = (laser_point_t){x, y, color, color, color};
+  points->p[ballLaser] = (laser_point_t){x, y, color, color, color};
   angle = (angle + 30) % 420;
   if (angle == 0) *done = true;
-  
-  return points;
 }
 
-laser_point_x3_t LaserGenerator::get_pong_paddles(uint8_t ballLaser, double ballX, double ballY, 
-                                  double centerX, double leftPaddle, double rightPaddle, bool *done) {
+void LaserGenerator::get_pong_paddles(uint8_t ballLaser, double ballX, double ballY, double centerX, 
+                                      double leftPaddle, double rightPaddle, laser_point_x3_t *points, bool *done) {
   static int setup_complete = 0;
   static xy_t paddlePoints[6];
   static int interpLen = 0;
@@ -310,10 +328,9 @@ laser_point_x3_t LaserGenerator::get_pong_paddles(uint8_t ballLaser, double ball
     setup_complete = 1;
   }
 
-  laser_point_x3_t points;
-  memset(&points, 0, sizeof(laser_point_x3_t));
+  memset(points, 0, sizeof(laser_point_x3_t));
   uint8_t color = interpPoints[index].on ? 255 : 0;
-  points.p[0] = (laser_point_t){
+  points->p[0] = (laser_point_t){
     (uint16_t)interpPoints[index].x,
     (uint16_t)interpPoints[index].y,
     color, color, color
@@ -325,11 +342,9 @@ laser_point_x3_t LaserGenerator::get_pong_paddles(uint8_t ballLaser, double ball
     setup_complete = 0;
     *done = true;
   }
-
-  return points;
 }
 
-laser_point_x3_t LaserGenerator::get_pong_point() {
+void LaserGenerator::get_pong_points(laser_point_x3_t *out, size_t n) {
   static int setup_complete = 0;
   static uint16_t bounds[4];
   static double centerX, centerY;
@@ -353,102 +368,101 @@ laser_point_x3_t LaserGenerator::get_pong_point() {
     setup_complete = 1;
   }
 
-  if (drawMode == 0) {
-    bool done = false;
-    laser_point_x3_t lp = get_pong_ball(ballLaser, ballX, ballY, &done);
-    if (done) drawMode = 1;
-    return lp;
-  }
-
-  if (drawMode == 1) {
-    bool done = false;
-    laser_point_x3_t lp = get_pong_paddles(ballLaser, ballX, ballY, centerX, leftPaddle, rightPaddle, &done);
-    if (done) drawMode = 2;
-    return lp;
-  }
-
-  if (scoreTimeout && millis() > gameResetTime) {
-    scoreTimeout = false;
-    ballX = centerX;
-    ballY = centerY;
-    ballLaser = 1;
-    dx = PONG_START_SPEED;
-    dy = PONG_START_SPEED;
-  }
-
-  if (!scoreTimeout) {
-    ballX += dx;
-    ballY += dy;
-
-    if (ballX < bounds[0]) {
-      ballLaser = (ballLaser + 3 - 1) % 3;
-      ballX = bounds[1];
-    } else if (ballX > bounds[1]) {
-      ballLaser = (ballLaser + 1) % 3;
-      ballX = bounds[0];
-    }
-
-    if ((ballY < bounds[2] && dy < 0) || (ballY > bounds[3] && dy > 0)) {
-      dy *= -1;
-      playSoundEffect = SOUND_EFFECT_PONG_WALL;
-    }
-
-    if (ballLaser == 0 && dx > 0 && ballX < centerX && ballX > (centerX - PONG_PADDLE_GAP)) {
-      if (abs(ballY - leftPaddle) < PONG_PADDLE_HALF_HEIGHT) {
-        dx *= -1;
-        playSoundEffect = SOUND_EFFECT_PONG_PADDLE;
-      } else {
-        scoreTimeout = true;
-        gameResetTime = millis() + 3000;
-        playSoundEffect = SOUND_EFFECT_PONG_GAMEOVER;
+  for (size_t k = 0; k < n; k++) {
+    // Physics runs once per frame, between the paddles and the next ball
+    if (drawMode == 2) {
+      if (scoreTimeout && millis() > gameResetTime) {
+        scoreTimeout = false;
+        ballX = centerX;
+        ballY = centerY;
+        ballLaser = 1;
+        dx = PONG_START_SPEED;
+        dy = PONG_START_SPEED;
       }
-    } else if (ballLaser == 0 && dx < 0 && ballX > centerX && ballX < (centerX + PONG_PADDLE_GAP)) {
-      if (abs(ballY - rightPaddle) < PONG_PADDLE_HALF_HEIGHT) {
-        dx *= -1;
-        playSoundEffect = SOUND_EFFECT_PONG_PADDLE;
-      } else {
-        scoreTimeout = true;
-        gameResetTime = millis() + 3000;
-        playSoundEffect = SOUND_EFFECT_PONG_GAMEOVER;
-      }
-    }
 
-    if (numWandsConnected > 0) {
-      int laserIndex = -1;
-      double v[3];
-      sier.get_wand_projection(wandData1, &laserIndex, v);
-      if (laserIndex >= 0) {
-        xy_t lp = sier.sierpinski_to_laser_coords(laserIndex, v);
-        leftPaddle += max(min(lp.y, (int)bounds[3] - PONG_PADDLE_HALF_HEIGHT), (int)bounds[2] + PONG_PADDLE_HALF_HEIGHT) - leftPaddle;
+      if (!scoreTimeout) {
+        ballX += dx;
+        ballY += dy;
+
+        if (ballX < bounds[0]) {
+          ballLaser = (ballLaser + 3 - 1) % 3;
+          ballX = bounds[1];
+        } else if (ballX > bounds[1]) {
+          ballLaser = (ballLaser + 1) % 3;
+          ballX = bounds[0];
+        }
+
+        if ((ballY < bounds[2] && dy < 0) || (ballY > bounds[3] && dy > 0)) {
+          dy *= -1;
+          playSoundEffect = SOUND_EFFECT_PONG_WALL;
+        }
+
+        if (ballLaser == 0 && dx > 0 && ballX < centerX && ballX > (centerX - PONG_PADDLE_GAP)) {
+          if (abs(ballY - leftPaddle) < PONG_PADDLE_HALF_HEIGHT) {
+            dx *= -1;
+            playSoundEffect = SOUND_EFFECT_PONG_PADDLE;
+          } else {
+            scoreTimeout = true;
+            gameResetTime = millis() + 3000;
+            playSoundEffect = SOUND_EFFECT_PONG_GAMEOVER;
+          }
+        } else if (ballLaser == 0 && dx < 0 && ballX > centerX && ballX < (centerX + PONG_PADDLE_GAP)) {
+          if (abs(ballY - rightPaddle) < PONG_PADDLE_HALF_HEIGHT) {
+            dx *= -1;
+            playSoundEffect = SOUND_EFFECT_PONG_PADDLE;
+          } else {
+            scoreTimeout = true;
+            gameResetTime = millis() + 3000;
+            playSoundEffect = SOUND_EFFECT_PONG_GAMEOVER;
+          }
+        }
+
+        if (numWandsConnected > 0) {
+          int laserIndex = -1;
+          laser_scalar_t v[3];
+          sier.get_wand_projection(wandData1, &laserIndex, v);
+          if (laserIndex >= 0) {
+            xy_t lp = sier.sierpinski_to_laser_coords(laserIndex, v);
+            leftPaddle += max(min(lp.y, (int)bounds[3] - PONG_PADDLE_HALF_HEIGHT), (int)bounds[2] + PONG_PADDLE_HALF_HEIGHT) - leftPaddle;
+          }
+        } else {
+          if (leftPaddle < ballY && leftPaddle + PONG_PADDLE_HALF_HEIGHT < bounds[3])
+            leftPaddle += PONG_AI_SPEED;
+          else if (leftPaddle > ballY && leftPaddle - PONG_PADDLE_HALF_HEIGHT > bounds[2])
+            leftPaddle -= PONG_AI_SPEED;
+        }
+
+        if (numWandsConnected > 1) {
+          int laserIndex = -1;
+          laser_scalar_t v[3];
+          sier.get_wand_projection(wandData2, &laserIndex, v);
+          if (laserIndex >= 0) {
+            xy_t lp = sier.sierpinski_to_laser_coords(laserIndex, v);
+            rightPaddle += max(min(lp.y, (int)bounds[3] - PONG_PADDLE_HALF_HEIGHT), (int)bounds[2] + PONG_PADDLE_HALF_HEIGHT) - rightPaddle;
+          }
+        } else {
+          if (rightPaddle < ballY && rightPaddle + PONG_PADDLE_HALF_HEIGHT < bounds[3])
+            rightPaddle += PONG_AI_SPEED;
+          else if (rightPaddle > ballY && rightPaddle - PONG_PADDLE_HALF_HEIGHT > bounds[2])
+            rightPaddle -= PONG_AI_SPEED;
+        }
       }
-    } else {
-      if (leftPaddle < ballY && leftPaddle + PONG_PADDLE_HALF_HEIGHT < bounds[3])
-        leftPaddle += PONG_AI_SPEED;
-      else if (leftPaddle > ballY && leftPaddle - PONG_PADDLE_HALF_HEIGHT > bounds[2])
-        leftPaddle -= PONG_AI_SPEED;
+
+      drawMode = 0;
     }
 
-    if (numWandsConnected > 1) {
-      int laserIndex = -1;
-      double v[3];
-      sier.get_wand_projection(wandData2, &laserIndex, v);
-      if (laserIndex >= 0) {
-        xy_t lp = sier.sierpinski_to_laser_coords(laserIndex, v);
-        rightPaddle += max(min(lp.y, (int)bounds[3] - PONG_PADDLE_HALF_HEIGHT), (int)bounds[2] + PONG_PADDLE_HALF_HEIGHT) - rightPaddle;
-      }
+    bool done = false;
+    if (drawMode == 0) {
+      get_pong_ball(ballLaser, ballX, ballY, &out[k], &done);
+      if (done) drawMode = 1;
     } else {
-      if (rightPaddle < ballY && rightPaddle + PONG_PADDLE_HALF_HEIGHT < bounds[3])
-        rightPaddle += PONG_AI_SPEED;
-      else if (rightPaddle > ballY && rightPaddle - PONG_PADDLE_HALF_HEIGHT > bounds[2])
-        rightPaddle -= PONG_AI_SPEED;
+      get_pong_paddles(ballLaser, ballX, ballY, centerX, leftPaddle, rightPaddle, &out[k], &done);
+      if (done) drawMode = 2;
     }
   }
-
-  drawMode = 0;
-  return get_pong_point();
 }
 
-laser_point_x3_t LaserGenerator::get_wand_drawing_point() {
+void LaserGenerator::get_wand_drawing_points(laser_point_x3_t *out, size_t n) {
   static int setup_complete = 0;
   static uint16_t bounds[4];
 
@@ -466,15 +480,14 @@ laser_point_x3_t LaserGenerator::get_wand_drawing_point() {
     setup_complete = 1;
   }
 
-  laser_point_x3_t points;
-  memset(&points, 0, sizeof(laser_point_x3_t));
-  if (numWandsConnected == 0) return points;
+  memset(out, 0, n * sizeof(laser_point_x3_t));
+  if (numWandsConnected == 0) return;
 
   if (millis() > nextUpdate) {
     nextUpdate = millis() + WAND_DELTA_TIME;
     
     int laserIndex = -1;
-    double v[3];
+    laser_scalar_t v[3];
     sier.get_wand_projection(wandData1, &laserIndex, v);
     
     if (laserIndex != currentLaser || laserIndex < 0) {
@@ -485,62 +498,63 @@ laser_point_x3_t LaserGenerator::get_wand_drawing_point() {
       currentLaser = laserIndex;
     }
 
-    if (laserIndex < 0) return points;
+    if (laserIndex < 0) return;
 
     if (listLen < WAND_PATH_LENGTH) listLen++;
     pointList[pIndex] = sier.sierpinski_to_laser_coords(laserIndex, v);
     pIndex = (pIndex + 1) % WAND_PATH_LENGTH;
   }
 
-  if (listLen == 0) return points;
-    
-  if (listLen < WAND_PATH_LENGTH) {
-    if (forwardDir) {
-      if (cIndex < (listLen - 1)) cIndex++;
-      else forwardDir = false;
-    } else {
-      if (cIndex > 0) cIndex--;
-      else forwardDir = true;
-    }
-  } else {
-    if (forwardDir) {
-      if (((cIndex + 1) % WAND_PATH_LENGTH) != pIndex) 
-        cIndex = (cIndex + 1) % WAND_PATH_LENGTH;
-      else 
-        forwardDir = false;
-    } else {
-      if (cIndex != pIndex) 
-        cIndex = (cIndex + WAND_PATH_LENGTH - 1) % WAND_PATH_LENGTH;
-      else 
-        forwardDir = true;
-    }
-  }
+  if (listLen == 0) return;
 
+  // The wand only moves between calls, so its colors are fixed for the block
   rgb_t wandColor1 = sier.get_wand_rotation_color(wandData1, 0);
-  points.p[currentLaser] = (laser_point_t) {
-    (uint16_t)pointList[cIndex].x,
-    (uint16_t)pointList[cIndex].y,
-    wandColor1.r, wandColor1.g, wandColor1.b
-  };
-
   rgb_t wandColor2 = sier.get_wand_rotation_color(wandData1, 120);
-  points.p[(currentLaser + 1) % 3] = (laser_point_t) {
-    (uint16_t)pointList[cIndex].x,
-    (uint16_t)(bounds[2] + (bounds[3] - pointList[cIndex].y)),
-    wandColor2.r, wandColor2.g, wandColor2.b
-  };
-
   rgb_t wandColor3 = sier.get_wand_rotation_color(wandData1, 240);
-  points.p[(currentLaser + 2) % 3] = (laser_point_t) {
-    (uint16_t)(2048 + (2048 - pointList[cIndex].x)),
-    (uint16_t)pointList[cIndex].y,
-    wandColor3.r, wandColor3.g, wandColor3.b
-  };
 
-  return points;
+  for (size_t k = 0; k < n; k++) {
+    laser_point_x3_t *points = &out[k];
+    if (listLen < WAND_PATH_LENGTH) {
+      if (forwardDir) {
+        if (cIndex < (listLen - 1)) cIndex++;
+        else forwardDir = false;
+      } else {
+        if (cIndex > 0) cIndex--;
+        else forwardDir = true;
+      }
+    } else {
+      if (forwardDir) {
+        if (((cIndex + 1) % WAND_PATH_LENGTH) != pIndex) 
+          cIndex = (cIndex + 1) % WAND_PATH_LENGTH;
+        else 
+          forwardDir = false;
+      } else {
+        if (cIndex != pIndex) 
+          cIndex = (cIndex + WAND_PATH_LENGTH - 1) % WAND_PATH_LENGTH;
+        else 
+          forwardDir = true;
+      }
+    }
+
+    points->p[currentLaser] = (laser_point_t) {
+      (uint16_t)pointList[cIndex].x,
+      (uint16_t)pointList[cIndex].y,
+      wandColor1.r, wandColor1.g, wandColor1.b
+    };
+    points->p[(currentLaser + 1) % 3] = (laser_point_t) {
+      (uint16_t)pointList[cIndex].x,
+      (uint16_t)(bounds[2] + (bounds[3] - pointList[cIndex].y)),
+      wandColor2.r, wandColor2.g, wandColor2.b
+    };
+    points->p[(currentLaser + 2) % 3] = (laser_point_t) {
+      (uint16_t)(2048 + (2048 - pointList[cIndex].x)),
+      (uint16_t)pointList[cIndex].y,
+      wandColor3.r, wandColor3.g, wandColor3.b
+    };
+  }
 }
 
-laser_point_x3_t LaserGenerator::get_calibration_point() {
+void LaserGenerator::get_calibration_points(laser_point_x3_t *out, size_t n) {
   static int setup_complete = 0;
   static xy_t raw_bounds[5];
   static xy_t *interp_bounds;
@@ -555,30 +569,28 @@ laser_point_x3_t LaserGenerator::get_calibration_point() {
     setup_complete = 1;
   }
 
-  curr_index = (curr_index + 1) % interp_bounds_size;
+  for (size_t k = 0; k < n; k++) {
+    curr_index = (curr_index + 1) % interp_bounds_size;
 
-  uint8_t r = 0;
-  uint8_t g = 0;
-  uint8_t b = 0;
+    uint8_t r = 0;
+    uint8_t g = 0;
+    uint8_t b = 0;
 
-  if      ((curr_index / 40) % 3 == 0) r = 255;
-  else if ((curr_index / 40) % 3 == 1) g = 255;
-  else                                 b = 255;
+    if      ((curr_index / 40) % 3 == 0) r = 255;
+    else if ((curr_index / 40) % 3 == 1) g = 255;
+    else                                 b = 255;
 
-  laser_point_t lp = (laser_point_t){
-    (uint16_t)interp_bounds[curr_index].x,
-    (uint16_t)interp_bounds[curr_index].y,
-    r, g, b
-  };
-  return (laser_point_x3_t){lp, lp, lp};
+    laser_point_t lp = (laser_point_t){
+      (uint16_t)interp_bounds[curr_index].x,
+      (uint16_t)interp_bounds[curr_index].y,
+      r, g, b
+    };
+    out[k] = (laser_point_x3_t){lp, lp, lp};
+  }
 }
 
 void LaserGenerator::calibrate_wand(uint16_t x, uint16_t y, uint16_t z, uint16_t w) {
-  double q[4] = {
-    ((double)x - 16384.0) / 16384.0,
-    ((double)y - 16384.0) / 16384.0,
-    ((double)z - 16384.0) / 16384.0,
-    ((double)w - 16384.0) / 16384.0
-  };
+  double q[4];
+  wand_quaternion(w, x, y, z, q);
   sier.calibrate_wand_position(q);
 }
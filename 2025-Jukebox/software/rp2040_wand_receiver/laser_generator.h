@@ -4,9 +4,10 @@
 #include <Arduino.h>
 #include "primitives.h"
 #include "sierpinski.h"
-#include "laser_objects.h"
+#include "equation_shapes.h"
 
 #define UDP_AUDIO_BUFF_SIZE 1024
+#define AUDIO_SPECTRUM_BANDS 16
 
 #define PONG_START_SPEED 6
 #define PONG_BALL_RADIUS 20
@@ -22,8 +23,6 @@
 #define MAX_CIRCLE_RADIUS 200
 #define MAX_CIRCLE_ANGLE 400
 
-#define NUM_EQUATIONS 36
-
 #define WAND_PATH_LENGTH 10
 #define WAND_DELTA_TIME 100
 
@@ -37,11 +36,19 @@ class LaserGenerator {
     void init();
     void point_to_bytes(laser_point_t *p, uint8_t *buf, uint16_t i);
     laser_point_x3_t get_point(uint8_t mode);
+    void get_points(uint8_t mode, laser_point_x3_t *out, size_t n);
     void calibrate_wand(uint16_t x, uint16_t y, uint16_t z, uint16_t w);
     uint8_t audioBuffer[UDP_AUDIO_BUFF_SIZE];
+    // When audioFeatures is set the visualizer follows the level and beat
+    // count sent by the jukebox instead of walking audioBuffer
+    bool audioFeatures = false;
+    uint8_t audioLevel = 0;   // 0-127
+    uint8_t audioBeats = 0;
+    uint8_t audioBeatLevel = 127;  // 0-127, how hard the next beat kicks
+    uint8_t audioSpectrum[AUDIO_SPECTRUM_BANDS] = {};  // 0-127, lowest band first
     uint8_t numWandsConnected = 0;
-    double wandData1[4] = {0.0, 0.0, 0.0, 1.0};
-    double wandData2[4] = {0.0, 0.0, 0.0, 1.0};
+    laser_scalar_t wandData1[4] = {0.0, 0.0, 0.0, 1.0};
+    laser_scalar_t wandData2[4] = {0.0, 0.0, 0.0, 1.0};
     int playSoundEffect = -1;
     char soundEffects[3][20] = {
       "/pong/wall.wav",
@@ -53,37 +60,20 @@ class LaserGenerator {
   private:
     Sierpinski sier;
     
-    int setup_equation(int index, xy_t *result, int *size);
-    laser_point_x3_t get_equation_point();
-    laser_point_x3_t get_spirograph_point();
-    laser_point_x3_t get_audio_visualizer_point();
-    laser_point_x3_t get_pong_point();
-    laser_point_x3_t get_pong_ball(uint8_t ballLaser, double ballX, double ballY, bool *done);
-    laser_point_x3_t get_pong_paddles(uint8_t ballLaser, double ballX, double ballY, 
-                                 double centerX, double leftPaddle, double rightPaddle, bool *done);
-    laser_point_x3_t get_wand_drawing_point();
-    laser_point_x3_t get_calibration_point();
+    void get_equation_points(laser_point_x3_t *out, size_t n);
+    void get_spirograph_points(laser_point_x3_t *out, size_t n);
+    void get_audio_visualizer_points(laser_point_x3_t *out, size_t n);
+    void get_pong_points(laser_point_x3_t *out, size_t n);
+    void get_pong_ball(uint8_t ballLaser, double ballX, double ballY, laser_point_x3_t *points, bool *done);
+    void get_pong_paddles(uint8_t ballLaser, double ballX, double ballY, double centerX, 
+                          double leftPaddle, double rightPaddle, laser_point_x3_t *points, bool *done);
+    void get_wand_drawing_points(laser_point_x3_t *out, size_t n);
+    void get_calibration_points(laser_point_x3_t *out, size_t n);
 
     uint8_t COLOR_LIST[7][3] = {
       {0, 0, 255}, {0, 255, 0}, {255, 0, 0}, {0, 255, 255}, 
       {255, 255, 0}, {255, 0, 255}, {255, 255, 255}
     };
-
-    uint16_t *EQUATION_LIST[NUM_EQUATIONS] = {
-      EQN_01, EQN_02, EQN_03, EQN_04, EQN_05, EQN_06, EQN_07, EQN_08, 
-      EQN_09, EQN_10, EQN_11, EQN_12, EQN_13, EQN_14, EQN_15, EQN_16, 
-      EQN_17, EQN_18, EQN_19, EQN_20, EQN_21, EQN_22, EQN_23, EQN_24, 
-      EQN_25, EQN_26, EQN_27, EQN_28, EQN_29, EQN_30, EQN_31, EQN_32, 
-      EQN_33, EQN_34, EQN_35, EQN_36
-    };
-
-    int EQUATION_LENS[NUM_EQUATIONS] = {
-      210, 224, 324, 322, 156, 106, 412, 318, 
-      260, 308, 104, 164, 192, 198, 308, 332, 
-      264, 152, 266, 488, 128, 82, 150, 278, 
-      214, 500, 564, 572, 318, 156, 86, 128, 
-      190, 282, 268, 380
-    };
 };
 
 #endif
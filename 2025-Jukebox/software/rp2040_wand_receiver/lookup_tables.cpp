@@ -0,0 +1,50 @@
+#include "lookup_tables.h"
+
+// sin() is not constexpr, so the table is filled from a Taylor series on
+// [-PI, PI]. Twenty terms are exact to double precision over that range.
+static constexpr double taylor_sin(double x) {
+  double term = x;
+  double sum = x;
+  for (int n = 1; n < 20; n++) {
+    term *= -x * x / ((2 * n) * (2 * n + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+static constexpr sin_table_t make_sin_table() {
+  sin_table_t t = {};
+  for (int i = 0; i <= SIN_TABLE_SIZE; i++) {
+    double x = TWO_PI * i / SIN_TABLE_SIZE;
+    if (x > PI) x -= TWO_PI;
+    t.v[i] = (float)taylor_sin(x);
+  }
+  return t;
+}
+
+// Mirrors hsv_to_rgb<double>(angle / 360.0, 1.0, 1.0) step for step so the
+// table gives exactly the same colors as the runtime conversion it replaces
+static constexpr hue_table_t make_hue_table() {
+  hue_table_t t = {};
+  for (int a = 0; a < HUE_TABLE_SIZE; a++) {
+    double h = (double)a / 360.0;
+    int i = (int)(h * 6.0);
+    double f = (h * 6.0) - (double)i;
+    uint8_t vb = 255;
+    uint8_t pb = 0;
+    uint8_t qb = (uint8_t)(int)((1.0 - f) * 255);
+    uint8_t tb = (uint8_t)(int)((1.0 - (1.0 - f)) * 255);
+    switch (i % 6) {
+      case 0: t.v[a] = (rgb_t){vb, tb, pb}; break;
+      case 1: t.v[a] = (rgb_t){qb, vb, pb}; break;
+      case 2: t.v[a] = (rgb_t){pb, vb, tb}; break;
+      case 3: t.v[a] = (rgb_t){pb, qb, vb}; break;
+      case 4: t.v[a] = (rgb_t){tb, pb, vb}; break;
+      case 5: t.v[a] = (rgb_t){vb, pb, qb}; break;
+    }
+  }
+  return t;
+}
+
+constexpr sin_table_t SIN_TABLE = make_sin_table();
+constexpr hue_table_t HUE_TABLE = make_hue_table();
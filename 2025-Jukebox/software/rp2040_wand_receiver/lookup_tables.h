@@ -0,0 +1,65 @@
+#ifndef _LOOKUP_TABLES_
+#define _LOOKUP_TABLES_
+
+#include <Arduino.h>
+#include "primitives.h"
+
+// Sine table with SIN_TABLE_STEPS_PER_DEG entries per degree, one extra entry
+// so interpolation never wraps. Both tables are generated at compile time and
+// live in flash.
+#define SIN_TABLE_STEPS_PER_DEG 4
+#define SIN_TABLE_SIZE          (360 * SIN_TABLE_STEPS_PER_DEG)
+#define HUE_TABLE_SIZE          360
+
+typedef struct {
+  float v[SIN_TABLE_SIZE + 1];
+} sin_table_t;
+
+typedef struct {
+  rgb_t v[HUE_TABLE_SIZE];
+} hue_table_t;
+
+extern const sin_table_t SIN_TABLE;
+extern const hue_table_t HUE_TABLE;
+
+inline int wrap_degrees(int deg) {
+  deg %= 360;
+  return deg < 0 ? deg + 360 : deg;
+}
+
+inline double sin_deg(int deg) {
+  return SIN_TABLE.v[wrap_degrees(deg) * SIN_TABLE_STEPS_PER_DEG];
+}
+
+inline double cos_deg(int deg) {
+  return SIN_TABLE.v[wrap_degrees(deg + 90) * SIN_TABLE_STEPS_PER_DEG];
+}
+
+// Linearly interpolated sine and cosine of an angle in radians. The angle is
+// wrapped to one turn before indexing, since the spirograph's angles grow
+// without bound and would overflow a 32-bit index within the hour.
+inline void sincos_rad(double rad, double *s, double *c) {
+  double pos = rad * (SIN_TABLE_SIZE / TWO_PI);
+  pos -= SIN_TABLE_SIZE * floor(pos / SIN_TABLE_SIZE);
+  int32_t i = (int32_t)pos;
+  double f = pos - i;
+  if (i >= SIN_TABLE_SIZE) i -= SIN_TABLE_SIZE;  // pos can round up to a full turn
+  *s = SIN_TABLE.v[i] + (SIN_TABLE.v[i + 1] - SIN_TABLE.v[i]) * f;
+
+  int32_t j = i + SIN_TABLE_SIZE / 4;
+  if (j >= SIN_TABLE_SIZE) j -= SIN_TABLE_SIZE;
+  *c = SIN_TABLE.v[j] + (SIN_TABLE.v[j + 1] - SIN_TABLE.v[j]) * f;
+}
+
+inline double sin_rad(double rad) {
+  double s, c;
+  sincos_rad(rad, &s, &c);
+  return s;
+}
+
+// Same result as hsv_to_rgb(angle / 360.0, 1.0, 1.0)
+inline rgb_t hue_to_rgb(int angle) {
+  return HUE_TABLE.v[wrap_degrees(angle)];
+}
+
+#endif
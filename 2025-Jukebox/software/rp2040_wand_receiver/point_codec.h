@@ -0,0 +1,180 @@
+#ifndef _POINT_CODEC_
+#define _POINT_CODEC_
+
+#include <Arduino.h>
+#include "primitives.h"
+
+// Compressed laser point stream, an alternative to the fixed 6 bytes per
+// point of LaserGenerator::point_to_bytes(). A packet is
+//
+//   [seq] [LASER_CODEC_ID] [op] [op] ...
+//
+// Colors and positions are carried as state. Color ops change the current
+// color, and position ops emit a point at the current color:
+//
+//   00 dx:7 dy:7              2 bytes, signed delta from the previous point
+//   01 dx:11 dy:11            3 bytes, signed delta
+//   10 x:12 y:12 00           4 bytes, absolute position
+//   1100 0000 r g b           4 bytes, set the color
+//   1101 0000                 1 byte, set the color to black (blanked)
+//   111 n:5                   1 byte, the previous point n + 1 more times
+//
+// Position and color start at 0 and black in every packet, so each packet
+// decodes on its own and a lost packet never corrupts the next one.
+
+#define LASER_CODEC_ID             0xc1
+#define LASER_CODEC_HEADER_LEN     2
+// Pending repeat + color + absolute position
+#define LASER_CODEC_MAX_POINT_LEN  9
+#define LASER_CODEC_MAX_REPEAT     32
+// Caps the points per packet, so a stream that compresses well (a held
+// wand, a paused game) is not held back for long. 340 is two legacy packets.
+#define LASER_CODEC_PACKET_POINTS  340
+
+#define CODEC_OP_SHORT   0x00
+#define CODEC_OP_MEDIUM  0x40
+#define CODEC_OP_ABS     0x80
+#define CODEC_OP_COLOR   0xc0
+#define CODEC_OP_BLANK   0xd0
+#define CODEC_OP_REPEAT  0xe0
+
+class point_encoder {
+  public:
+    point_encoder() { reset(); }
+
+    // Starts a new packet
+    void reset() {
+      _x = 0;
+      _y = 0;
+      _r = _g = _b = 0;
+      _repeat = 0;
+      _havePoint = false;
+    }
+
+    // Appends p to out and returns the number of bytes written, at most
+    // LASER_CODEC_MAX_POINT_LEN. Repeated points are held back, so this can
+    // return 0; call flush() before ending the packet.
+    size_t add(const laser_point_t *p, uint8_t *out) {
+      int x = p->x, y = p->y;
+      if (_havePoint && x == _x && y == _y && p->r == _r && p->g == _g && p->b == _b) {
+        if (++_repeat < LASER_CODEC_MAX_REPEAT) return 0;
+        return flush(out);
+      }
+
+      size_t n = flush(out);
+      if (p->r != _r || p->g != _g || p->b != _b) {
+        if (p->r == 0 && p->g == 0 && p->b == 0) {
+          out[n++] = CODEC_OP_BLANK;
+        } else {
+          out[n++] = CODEC_OP_COLOR;
+          out[n++] = p->r;
+          out[n++] = p->g;
+          out[n++] = p->b;
+        }
+        _r = p->r;
+        _g = p->g;
+        _b = p->b;
+      }
+
+      int dx = x - _x, dy = y - _y;
+      if (dx >= -64 && dx < 64 && dy >= -64 && dy < 64) {
+        uint16_t v = (uint16_t)((dx & 0x7f) << 7 | (dy & 0x7f));
+        out[n++] = CODEC_OP_SHORT | (uint8_t)(v >> 8);
+        out[n++] = (uint8_t)(v & 0xff);
+      } else if (dx >= -1024 && dx < 1024 && dy >= -1024 && dy < 1024) {
+        uint32_t v = (uint32_t)(dx & 0x7ff) << 11 | (uint32_t)(dy & 0x7ff);
+        out[n++] = CODEC_OP_MEDIUM | (uint8_t)(v >> 16);
+        out[n++] = (uint8_t)((v >> 8) & 0xff);
+        out[n++] = (uint8_t)(v & 0xff);
+      } else {
+        uint32_t v = (uint32_t)x << 14 | (uint32_t)y << 2;
+        out[n++] = CODEC_OP_ABS | (uint8_t)(v >> 24);
+        out[n++] = (uint8_t)((v >> 16) & 0xff);
+        out[n++] = (uint8_t)((v >> 8) & 0xff);
+        out[n++] = (uint8_t)(v & 0xff);
+      }
+
+      _x = x;
+      _y = y;
+      _havePoint = true;
+      return n;
+    }
+
+    // Writes out a pending repeat, returns 0 or 1 bytes
+    size_t flush(uint8_t *out) {
+      if (_repeat == 0) return 0;
+      out[0] = CODEC_OP_REPEAT | (uint8_t)(_repeat - 1);
+      _repeat = 0;
+      return 1;
+    }
+
+  private:
+    int _x, _y;
+    uint8_t _r, _g, _b;
+    uint8_t _repeat;
+    bool _havePoint;
+};
+
+inline int codec_sign_extend(uint32_t v, int bits) {
+  return (int)(v ^ (1u << (bits - 1))) - (1 << (bits - 1));
+}
+
+// Reference decoder for the ops after the packet header. Returns the number
+// of points written to out, or -1 if the stream is malformed or more than
+// cap points long.
+inline int laser_codec_decode(const uint8_t *buf, size_t len, laser_point_t *out, size_t cap) {
+  int x = 0, y = 0;
+  uint8_t r = 0, g = 0, b = 0;
+  size_t n = 0;
+  size_t i = 0;
+
+  while (i < len) {
+    uint8_t op = buf[i];
+    int count = 1;
+
+    if ((op & 0xc0) == CODEC_OP_SHORT) {
+      if (i + 2 > len) return -1;
+      uint16_t v = (uint16_t)op << 8 | buf[i + 1];
+      x += codec_sign_extend((v >> 7) & 0x7f, 7);
+      y += codec_sign_extend(v & 0x7f, 7);
+      i += 2;
+    } else if ((op & 0xc0) == CODEC_OP_MEDIUM) {
+      if (i + 3 > len) return -1;
+      uint32_t v = (uint32_t)(op & 0x3f) << 16 | (uint32_t)buf[i + 1] << 8 | buf[i + 2];
+      x += codec_sign_extend((v >> 11) & 0x7ff, 11);
+      y += codec_sign_extend(v & 0x7ff, 11);
+      i += 3;
+    } else if ((op & 0xc0) == CODEC_OP_ABS) {
+      if (i + 4 > len) return -1;
+      uint32_t v = (uint32_t)op << 24 | (uint32_t)buf[i + 1] << 16 | (uint32_t)buf[i + 2] << 8 | buf[i + 3];
+      x = (v >> 14) & 0xfff;
+      y = (v >> 2) & 0xfff;
+      i += 4;
+    } else if ((op & 0xe0) == CODEC_OP_REPEAT) {
+      if (n == 0) return -1;
+      count = (op & 0x1f) + 1;
+      i += 1;
+    } else if (op == CODEC_OP_COLOR) {
+      if (i + 4 > len) return -1;
+      r = buf[i + 1];
+      g = buf[i + 2];
+      b = buf[i + 3];
+      i += 4;
+      continue;
+    } else if (op == CODEC_OP_BLANK) {
+      r = g = b = 0;
+      i += 1;
+      continue;
+    } else {
+      return -1;
+    }
+
+    if (x < 0 || x > 4095 || y < 0 || y > 4095 || n + count > cap) return -1;
+    for (int j = 0; j < count; j++)
+      out[n++] = (laser_point_t){(uint32_t)x, (uint32_t)y, r, g, b};
+  }
+
+  return (int)n;
+}
+
+#endif
@@ -1,11 +1,5 @@
 #include "primitives.h"
 
-void cross(double a[3], double b[3], double result[3]) {
-  result[0] = a[1] * b[2] - a[2] * b[1];
-  result[1] = a[2] * b[0] - a[0] * b[2];
-  result[2] = a[0] * b[1] - a[1] * b[0];
-}
-
 void norm(int n, double *a, double *result) {
   double mag = 0;
   for (int i = 0; i < n; i++)
@@ -33,85 +27,6 @@ void find_surface_normal(double surface[4][3], double result[3]) {
   norm(3, pn, result);
 }
 
-int same_side(double p1[3], double p2[3], double a[3], double b[3]) {
-  double diff1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
-  double diff2[3] = {p1[0] - a[0], p1[1] - a[1], p1[2] - a[2]};
-  double diff3[3] = {p2[0] - a[0], p2[1] - a[1], p2[2] - a[2]};
-  double cross1[3];
-  double cross2[3];
-  cross(diff1, diff2, cross1);
-  cross(diff1, diff3, cross2);
-  double dot = 0.0;
-  for (int i = 0; i < 3; i++) 
-    dot += cross1[i] * cross2[i];
-  return dot >= 0;
-}
-
-int point_in_triangle(double a[3], double b[3], double c[3], double p[3]) {
-  return same_side(p, a, b, c) && same_side(p, b, a, c) && same_side(p, c, a, b);
-}
-
-int point_in_surface(double p1[3], double p2[3], double p3[3], double p4[3], double p[3]) {
-  return point_in_triangle(p1, p2, p3, p) || point_in_triangle(p3, p4, p1, p);
-}
-
-void rotate(double q[4], double v[3], double result[3]) {
-  double conj[4] = { -q[0], -q[1], -q[2], q[3] };
-  double qv[4] = {
-    q[3] * v[0] + q[1] * v[2] - q[2] * v[1],
-    q[3] * v[1] + q[2] * v[0] - q[0] * v[2],
-    q[3] * v[2] + q[0] * v[1] - q[1] * v[0],
-    -q[0] * v[0] - q[1] * v[1] - q[2] * v[2]
-  };
-  result[0] = qv[3] * conj[0] + qv[0] * conj[3] + qv[1] * conj[2] - qv[2] * conj[1];
-  result[1] = qv[3] * conj[1] + qv[1] * conj[3] + qv[2] * conj[0] - qv[0] * conj[2];
-  result[2] = qv[3] * conj[2] + qv[2] * conj[3] + qv[0] * conj[1] - qv[1] * conj[0];
-}
-
-int wand_rotation(double q[4]) {
-  static int lastAngle = 0;
-
-  double v0[3];
-  double axis0[3] = {0.0, 1.0, 0.0};
-  rotate(q, axis0, v0);
-
-  double v1[3];
-  double axis1[3] = {1.0, 0.0, 0.0};
-  rotate(q, axis1, v1);
-
-  double s = sqrt(v1[0] * v1[0] + v1[2] * v1[2]);
-  if (s < 0.01) return lastAngle;
-  double v2[3] = {-v1[0] * v1[2] / s, -v1[1] * v1[2] / s, (v1[0] * v1[0] + v1[2] * v1[2]) / s};
-
-  double v3[3];
-  cross(v1, v2, v3);
-
-  double d1 = 0.0;
-  double d2 = 0.0;
-  for (int i = 0; i < 3; i++) {
-    d1 += v0[i] * v2[i];
-    d2 += v0[i] * v3[i];
-  }
-
-  d1 = max(-1.0, min(d1, 1.0));
-  d2 = max(-1.0, min(d2, 1.0));
-  d1 = acos(d1);
-  d2 = acos(d2);
-
-  int phi1 = (int)(d1 * 180.0 / PI);
-  int phi2 = (int)(d2 * 180.0 / PI);
-  lastAngle = phi2 < 90 ? phi1 : 360 - phi1;
-  return lastAngle;
-}
-
-void dot_mv(int n, double *mat, double *v, double *result) {
-  for (int i = 0; i < n; i++) {
-    result[i] = 0;
-    for (int j = 0; j < n; j++)
-      result[i] += mat[i * n + j] * v[j];
-  }
-}
-
 void mul_mm(int n1, int m1, int n2, int m2, double *mat1, double *mat2, double *result) {
   for (int i = 0; i < n1; i++) 
     for (int j = 0; j < m2; j++) 
@@ -203,54 +118,6 @@ void lstsq(double a[3][4], double b[3][4], double x[4][4]) {
   mul_mm(4, 3, 3, 4, &temp2[0][0], &b[0][0], &x[0][0]);
 }
 
-
-rgb_t hsv_to_rgb(double h, double s, double v) {
-  if (s < 0.01) 
-    return (rgb_t){(uint8_t)(v * 255), (uint8_t)(v * 255), (uint8_t)(v * 255)};
-  
-  int i = (int)(h * 6.0);
-  double f = (h * 6.0) - i;
-  double p = v * (1.0 - s);
-  double q = v * (1.0 - s * f);
-  double t = v * (1.0 - s * (1.0 - f));
-  rgb_t result = {0, 0, 0};
-  switch (i % 6) 
-  {
-    case 0:
-      result.r = (uint8_t)(v * 255);
-      result.g = (uint8_t)(t * 255);
-      result.b = (uint8_t)(p * 255);
-      break;
-    case 1:
-      result.r = (uint8_t)(q * 255);
-      result.g = (uint8_t)(v * 255);
-      result.b = (uint8_t)(p * 255);
-      break;
-    case 2:
-      result.r = (uint8_t)(p * 255);
-      result.g = (uint8_t)(v * 255);
-      result.b = (uint8_t)(t * 255);
-      break;
-    case 3:
-      result.r = (uint8_t)(p * 255);
-      result.g = (uint8_t)(q * 255);
-      result.b = (uint8_t)(v * 255);
-      break;
-    case 4:
-      result.r = (uint8_t)(t * 255);
-      result.g = (uint8_t)(p * 255);
-      result.b = (uint8_t)(v * 255);
-      break;
-    case 5:
-      result.r = (uint8_t)(v * 255);
-      result.g = (uint8_t)(p * 255);
-      result.b = (uint8_t)(q * 255);
-      break;
-  }
-
-  return result;
-}
-
 int get_interpolated_size(xy_t *obj, int obj_len, int seg_dist) {
   int result = 1;
   for (int i = 1; i < obj_len; i++) {
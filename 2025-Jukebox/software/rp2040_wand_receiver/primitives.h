@@ -2,10 +2,25 @@
 #define _PRIMITIVES_
 
 #include <Arduino.h>
+#include "fixed.h"
 
-typedef struct {
-  uint16_t x, y;
-  uint8_t r, g, b;
+// Uncomment to run the per-point wand projection and color kernels in Q16.16
+// fixed point instead of soft-float double
+//#define LASER_FIXED_POINT
+
+#ifdef LASER_FIXED_POINT
+typedef fix16 laser_scalar_t;
+#else
+typedef double laser_scalar_t;
+#endif
+
+// Coordinates are 12 bits on the wire (see point_to_bytes), so a point fits
+// in the same 6 bytes it is sent as. Blanked points have all colors at 0.
+typedef struct __attribute__((packed)) {
+  uint32_t x : 12;
+  uint32_t y : 12;
+  uint32_t r : 8;
+  uint8_t g, b;
 } laser_point_t;
 
 typedef struct {
@@ -16,26 +31,21 @@ typedef struct {
   uint8_t r, g, b;
 } rgb_t;
 
+// Signed so shapes can be centered on 0, with headroom for offsets that
+// are added before the result is cast into a laser_point_t
 typedef struct {
-  int x, y;
-  bool on;
+  int x : 15;
+  int y : 15;
+  bool on : 1;
 } xy_t;
 
-void cross(double a[3], double b[3], double result[3]);
 void norm(int n, double *a, double *result);
 void find_edge_pos(double p1[3], double p2[3], double z, double result[3]);
 void find_surface_normal(double surface[4][3], double result[3]);
-int same_side(double p1[3], double p2[3], double a[3], double b[3]);
-int point_in_triangle(double a[3], double b[3], double c[3], double p[3]);
-int point_in_surface(double p1[3], double p2[3], double p3[3], double p4[3], double p[3]);
-void rotate(double q[4], double v[3], double result[3]);
-int wand_rotation(double q[4]);
-void dot_mv(int n, double *mat, double *v, double *result);
 void mul_mm(int n1, int m1, int n2, int m2, double *mat1, double *mat2, double *result);
 void eigen(double a[4][4], double eigenvalues[4], double eigenvectors[4][4]);
 void lstsq(double a[3][4], double b[3][4], double x[4][4]);
 
-rgb_t hsv_to_rgb(double h, double s, double v);
 int get_interpolated_size(xy_t *obj, int obj_len, int seg_dist);
 void interpolate_objects(xy_t *obj, int obj_len, int seg_dist, xy_t *result);
 void get_laser_obj_bounds(xy_t *obj, int obj_len, int *min_x, int *max_x, int *min_y, int *max_y);
@@ -43,4 +53,152 @@ void get_laser_obj_size(xy_t *obj, int obj_len, int *width, int *height);
 void get_laser_obj_midpoint(xy_t *obj, int obj_len, int *mid_x, int *mid_y);
 int convert_to_xy(uint16_t *obj, int obj_len, double x_scale, double y_scale, xy_t *result);
 
+// The kernels below run for every laser point, so they are templated on the
+// scalar type. The double instantiation is the reference implementation.
+
+template <typename T>
+void cross(T a[3], T b[3], T result[3]) {
+  result[0] = a[1] * b[2] - a[2] * b[1];
+  result[1] = a[2] * b[0] - a[0] * b[2];
+  result[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+// Sign test of a 3-vector dot product. Products of surface edge lengths
+// overflow Q16.16, so the fixed point version accumulates in 64 bits.
+inline int dot_non_negative(double a[3], double b[3]) {
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] >= 0;
+}
+
+inline int dot_non_negative(fix16 a[3], fix16 b[3]) {
+  int64_t dot = 0;
+  for (int i = 0; i < 3; i++)
+    dot += (int64_t)a[i].raw * b[i].raw;
+  return dot >= 0;
+}
+
+template <typename T>
+int same_side(T p1[3], T p2[3], T a[3], T b[3]) {
+  T diff1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+  T diff2[3] = {p1[0] - a[0], p1[1] - a[1], p1[2] - a[2]};
+  T diff3[3] = {p2[0] - a[0], p2[1] - a[1], p2[2] - a[2]};
+  T cross1[3];
+  T cross2[3];
+  cross(diff1, diff2, cross1);
+  cross(diff1, diff3, cross2);
+  return dot_non_negative(cross1, cross2);
+}
+
+template <typename T>
+int point_in_triangle(T a[3], T b[3], T c[3], T p[3]) {
+  return same_side(p, a, b, c) && same_side(p, b, a, c) && same_side(p, c, a, b);
+}
+
+template <typename T>
+int point_in_surface(T p1[3], T p2[3], T p3[3], T p4[3], T p[3]) {
+  return point_in_triangle(p1, p2, p3, p) || point_in_triangle(p3, p4, p1, p);
+}
+
+template <typename T>
+void rotate(T q[4], T v[3], T result[3]) {
+  T conj[4] = { -q[0], -q[1], -q[2], q[3] };
+  T qv[4] = {
+    q[3] * v[0] + q[1] * v[2] - q[2] * v[1],
+    q[3] * v[1] + q[2] * v[0] - q[0] * v[2],
+    q[3] * v[2] + q[0] * v[1] - q[1] * v[0],
+    -q[0] * v[0] - q[1] * v[1] - q[2] * v[2]
+  };
+  result[0] = qv[3] * conj[0] + qv[0] * conj[3] + qv[1] * conj[2] - qv[2] * conj[1];
+  result[1] = qv[3] * conj[1] + qv[1] * conj[3] + qv[2] * conj[0] - qv[0] * conj[2];
+  result[2] = qv[3] * conj[2] + qv[2] * conj[3] + qv[0] * conj[1] - qv[1] * conj[0];
+}
+
+template <typename T>
+int wand_rotation(T q[4]) {
+  static int lastAngle = 0;
+
+  T v0[3];
+  T axis0[3] = {0.0, 1.0, 0.0};
+  rotate(q, axis0, v0);
+
+  T v1[3];
+  T axis1[3] = {1.0, 0.0, 0.0};
+  rotate(q, axis1, v1);
+
+  T s = sqrt(v1[0] * v1[0] + v1[2] * v1[2]);
+  if (s < (T)0.01) return lastAngle;
+  T v2[3] = {-v1[0] * v1[2] / s, -v1[1] * v1[2] / s, (v1[0] * v1[0] + v1[2] * v1[2]) / s};
+
+  T v3[3];
+  cross(v1, v2, v3);
+
+  T d1 = 0.0;
+  T d2 = 0.0;
+  for (int i = 0; i < 3; i++) {
+    d1 += v0[i] * v2[i];
+    d2 += v0[i] * v3[i];
+  }
+
+  d1 = max((T)-1.0, min(d1, (T)1.0));
+  d2 = max((T)-1.0, min(d2, (T)1.0));
+  d1 = acos(d1);
+  d2 = acos(d2);
+
+  int phi1 = (int)(d1 * (T)(180.0 / PI));
+  int phi2 = (int)(d2 * (T)(180.0 / PI));
+  lastAngle = phi2 < 90 ? phi1 : 360 - phi1;
+  return lastAngle;
+}
+
+template <typename T>
+void dot_mv(int n, T *mat, T *v, T *result) {
+  for (int i = 0; i < n; i++) {
+    result[i] = 0;
+    for (int j = 0; j < n; j++)
+      result[i] += mat[i * n + j] * v[j];
+  }
+}
+
+template <typename T>
+rgb_t hsv_to_rgb(T h, T s, T v) {
+  if (s < (T)0.01) 
+    return (rgb_t){(uint8_t)(int)(v * (T)255), (uint8_t)(int)(v * (T)255), (uint8_t)(int)(v * (T)255)};
+  
+  int i = (int)(h * (T)6.0);
+  T f = (h * (T)6.0) - (T)i;
+  T p = v * ((T)1.0 - s);
+  T q = v * ((T)1.0 - s * f);
+  T t = v * ((T)1.0 - s * ((T)1.0 - f));
+  uint8_t vb = (uint8_t)(int)(v * (T)255);
+  uint8_t pb = (uint8_t)(int)(p * (T)255);
+  uint8_t qb = (uint8_t)(int)(q * (T)255);
+  uint8_t tb = (uint8_t)(int)(t * (T)255);
+  rgb_t result = {0, 0, 0};
+  switch (i % 6) 
+  {
+    case 0: result = (rgb_t){vb, tb, pb}; break;
+    case 1: result = (rgb_t){qb, vb, pb}; break;
+    case 2: result = (rgb_t){pb, vb, tb}; break;
+    case 3: result = (rgb_t){pb, qb, vb}; break;
+    case 4: result = (rgb_t){tb, pb, vb}; break;
+    case 5: result = (rgb_t){vb, pb, qb}; break;
+  }
+
+  return result;
+}
+
+// Wand quaternion components arrive as unsigned 16-bit values centred on 16384
+inline void wand_quaternion(uint16_t w, uint16_t x, uint16_t y, uint16_t z, double q[4]) {
+  q[0] = ((double)x - 16384.0) / 16384.0;
+  q[1] = ((double)y - 16384.0) / 16384.0;
+  q[2] = ((double)z - 16384.0) / 16384.0;
+  q[3] = ((double)w - 16384.0) / 16384.0;
+}
+
+inline void wand_quaternion(uint16_t w, uint16_t x, uint16_t y, uint16_t z, fix16 q[4]) {
+  q[0] = fix16::from_raw(((int32_t)x - 16384) * 4);
+  q[1] = fix16::from_raw(((int32_t)y - 16384) * 4);
+  q[2] = fix16::from_raw(((int32_t)z - 16384) * 4);
+  q[3] = fix16::from_raw(((int32_t)w - 16384) * 4);
+}
+
 #endif
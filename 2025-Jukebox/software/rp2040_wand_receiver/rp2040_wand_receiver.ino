@@ -2,7 +2,15 @@
 #include <Ethernet.h>
 #include <EthernetUdp.h>
 #include "pico/util/queue.h"
+#include "pico/time.h"
+#include "hardware/sync.h"
+#include <JukeboxProtocol.h>
+#include <PacketDispatcher.h>
+#include <LinkHealth.h>
+#include <Mailbox.h>
 #include "laser_generator.h"
+#include "laser_frame.h"
+#include "point_codec.h"
 
 #define BTN_2_PIN     8
 #define BTN_1_PIN     9
@@ -29,36 +37,62 @@
 #define JUKEBOX_MODE_EFFECTS 2
 #define JUKEBOX_MODE_INVALID 255
 
-#define PACKET_ID_ROBBIE_MODE    1
-#define PACKET_ID_LASER_DATA     2
-#define PACKET_ID_AUDIO_DATA     3
-#define PACKET_ID_BUTTON_PRESS   4
-#define PACKET_ID_AUDIO_METADATA 5
-#define PACKET_ID_PLAY_EFFECT    6
-#define PACKET_ID_WAND_DATA      7
-#define PACKET_ID_JUKEBOX_MODE   8
-
 byte mac[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x33 };
 IPAddress ip(10, 0, 0, 33);
 EthernetUDP udp;
+EthernetUDP laserUdp[3];
+EthernetUDP laserFrameUdp;
 #define PACKET_BUF_SIZE 1472
-uint8_t packetBuffer[PACKET_BUF_SIZE];
+#define RX_RING_SLOTS   4
+#define RX_BUDGET_US    500
+PacketDispatcher<RX_RING_SLOTS, PACKET_BUF_SIZE> rx;
+WizInterrupt wizInt;
 IPAddress ioIP(10, 0, 0, 31);
 IPAddress jukeboxIP(10, 0, 0, 32);
 IPAddress laserIPs[3] = { IPAddress(10, 0, 0, 10), IPAddress(10, 0, 0, 11), IPAddress(10, 0, 0, 12) };
+IPAddress statusIP(10, 0, 0, 255);
+
+// Set to 1 to send one combined frame per LASER_FRAME_POINTS to laserGroupIP
+// instead of a packet to each projector (see laser_frame.h). The projectors
+// must be listening on the group for this.
+#define LASER_MULTICAST 0
+IPAddress laserGroupIP(239, 0, 0, 33);
+
+LinkHealth laserLinks[3] = {
+  LinkHealth(laserIPs[0], 1000, 30000),
+  LinkHealth(laserIPs[1], 1000, 30000),
+  LinkHealth(laserIPs[2], 1000, 30000)
+};
+LinkHealth laserGroupLink(laserGroupIP, 1000, 30000);
+LinkHealth jukeboxLink(jukeboxIP, 1000, 10000);
+
+// Set to 1 to send each projector the compressed stream from point_codec.h,
+// which fits about twice the points in a packet
+#define LASER_COMPRESSED 0
 
 typedef struct {
   uint16_t w, x, y, z;
   uint8_t buttonPressed;
 } wand_data_t;
 
+#define WAND_CMD_LEN        4
+#define WAND_FRAME_LEN      40
+#define WAND_ACK_TIMEOUT_US 5000
+
+typedef enum {
+  WAND_SPI_IDLE,
+  WAND_SPI_WAIT_ACK,
+  WAND_SPI_TRANSFER
+} wand_spi_state_t;
+
 SPISettings spiSettings(8000000, MSBFIRST, SPI_MODE0);
-uint8_t spiBuffer[40];
+uint8_t spiBuffer[2][WAND_FRAME_LEN];
+uint8_t spiFront = 0;
 uint8_t numWandsConnected = 0;
 wand_data_t wandData[4];
 
-uint8_t sendMode = 0;
 uint8_t currentRobbieMode = 0;
+uint8_t modeChanges = 0;
 uint8_t MODE_MAPPING[10] = {
   JUKEBOX_MODE_INVALID, 
   JUKEBOX_MODE_MUSIC,
@@ -86,11 +120,81 @@ const uint8_t seg_lookup[10] = {
   0b11110110, //9
 };
 
-#define POINT_BUFFER_SIZE 1000
-#define LASER_PACKET_LEN  (1 + 170 * 6)
+#define POINT_BUFFER_SIZE   1000
+#define LASER_PACKET_POINTS 170
+#define LASER_CHUNK_POINTS  10
+#define LASER_CHUNK_LEN     (LASER_CHUNK_POINTS * 6)
+#define LASER_PACKET_MAX_LEN 1472
+static_assert(LASER_PACKET_POINTS % LASER_CHUNK_POINTS == 0, "packets must hold whole chunks");
 queue_t data_buf;
 bool queueReady = false;
 LaserGenerator laserGen;
+static_assert(UDP_AUDIO_BUFF_SIZE == PROTOCOL_AUDIO_SAMPLES, "audio packet size mismatch");
+
+// Core 0 owns laserGen, the wands, the buttons and the display, core 1 owns
+// the network. Everything that crosses between them goes through a mailbox,
+// so neither side ever sees a half written update.
+typedef struct {
+  uint8_t samples[UDP_AUDIO_BUFF_SIZE];
+} audio_samples_t;
+
+typedef struct {
+  uint8_t robbieMode;
+  uint8_t modeChanges;     // bumped when the buttons change the mode
+  uint8_t numWandsConnected;
+  wand_data_t wand;        // first wand, forwarded to the jukebox
+  uint8_t soundEffects;    // bumped for each sound effect laserGen asks for
+  uint8_t soundEffect;
+} core0_state_t;
+
+Mailbox<audio_samples_t> audioMailbox;  // core 1 -> core 0
+Mailbox<audio_features_packet_t> featureMailbox;  // core 1 -> core 0
+Mailbox<audio_spectrum_packet_t> spectrumMailbox;  // core 1 -> core 0
+
+// The jukebox's beat grid, with the next beat as a local time
+typedef struct {
+  uint32_t beatAtMs;
+  uint16_t periodMs;  // 0 when the song has no grid
+  uint16_t index;
+  uint8_t level;
+} beat_sync_t;
+Mailbox<beat_sync_t> beatMailbox;       // core 1 -> core 0
+#define BEAT_GRID_TIMEOUT_MS 500
+static_assert(AUDIO_SPECTRUM_BANDS == PROTOCOL_SPECTRUM_BANDS, "spectrum band count mismatch");
+Mailbox<uint8_t> modeMailbox;           // core 1 -> core 0, mode set over the network
+Mailbox<core0_state_t> stateMailbox;    // core 0 -> core 1
+core0_state_t core0State;               // core 1's copy of stateMailbox
+
+#define LASER_POINT_PERIOD_US 150
+// Periods a point stats request may set. Much faster and the alarm IRQ
+// starves loop(), which is the only place a new period is applied.
+#define POINT_PERIOD_MIN_US   50
+#define POINT_PERIOD_MAX_US   5000
+#define POINT_CATCHUP_MAX     32
+#define JITTER_BUCKETS        PROTOCOL_JITTER_BUCKETS
+
+// Upper bound of each jitter bucket in us, the last bucket takes the rest
+const uint16_t JITTER_BUCKET_US[JITTER_BUCKETS - 1] = {10, 25, 50, 100, 150, 300, 600};
+
+typedef struct {
+  uint32_t ticks;
+  uint32_t lateTicks;
+  uint32_t skippedTicks;
+  uint32_t dropped;
+  uint16_t queueMin, queueMax;
+  uint32_t jitter[JITTER_BUCKETS];
+} point_stats_t;
+
+repeating_timer_t pointTimer;
+volatile uint32_t pointTicks = 0;
+volatile uint32_t pointTickUs = 0;
+volatile uint32_t handledTicks = 0;
+volatile uint16_t pointPeriodUs = LASER_POINT_PERIOD_US;
+volatile uint16_t pointPeriodRequest = LASER_POINT_PERIOD_US;
+volatile point_stats_t pointStats;
+// Bumped by core 1 after each report, core 0 then restarts the occupancy
+// extremes so the IRQ stays their only other writer
+volatile uint32_t pointExtremesRequest = 0;
 
 /////////////////////////////////////////////////////////////////////
 
@@ -107,21 +211,44 @@ void setup1() {
   Ethernet.begin(mac, ip);
   Ethernet.setRetransmissionCount(0);
   Ethernet.setRetransmissionTimeout(0);
-  udp.begin(8888);
+  udp.begin(PROTOCOL_PORT);
+  wizInt.begin(WIZ_INT_PIN);
+  rx.on(PACKET_ID_ROBBIE_MODE, handleRobbieMode);
+  rx.on(PACKET_ID_AUDIO_DATA, handleAudioData);
+  rx.on(PACKET_ID_AUDIO_FEATURES, handleAudioFeatures);
+  rx.on(PACKET_ID_AUDIO_SPECTRUM, handleAudioSpectrum);
+  rx.on(PACKET_ID_AUDIO_BEAT, handleAudioBeat);
+  rx.on(PACKET_ID_POINT_STATS_REQUEST, handlePointStatsRequest);
+#if LASER_MULTICAST
+  laserFrameUdp.beginMulticast(laserGroupIP, LASER_FRAME_PORT);
+#else
+  for (int i = 0; i < 3; i++)
+    laserUdp[i].begin(8091 + i);
+#endif
 }
 
 void loop1() {
-  checkForPacket();
+  rx.poll(udp, wizInt, RX_BUDGET_US);
+  readCore0State();
+#if LASER_MULTICAST
+  sendLaserFrame();
+#elif LASER_COMPRESSED
+  sendCompressedLaserData();
+#else
   sendLaserData();
+#endif
   sendButtonData();
   sendWandData();
+  sendLinkStatus();
   sendSoundEffect();
 }
 
 void setup() { 
   queue_init(&data_buf, sizeof(laser_point_x3_t), POINT_BUFFER_SIZE);
   queueReady = true;
-  memset(spiBuffer, 0, 40);
+  resetPointStats();
+  startPointScheduler(LASER_POINT_PERIOD_US);
+  memset(spiBuffer, 0, sizeof(spiBuffer));
 
   for (int i = 0; i < 4; i++)
     wandData[i] = (wand_data_t){16384, 16384, 16384, 16384, 0};
@@ -156,25 +283,177 @@ void setup() {
 }
 
 void loop() {
+  readCore1Updates();
   checkButtons();
   checkWandData();
   queueLaserData();
+  publishCore0State();
 }
 
 
 /////////////////////////////////////////////////////////////////////
 
-void checkForPacket() {
-  int packetSize = udp.parsePacket();
-  if (packetSize) {
-    udp.read(packetBuffer, PACKET_BUF_SIZE);
-    if (packetBuffer[0] == PACKET_ID_ROBBIE_MODE && packetSize == 2) {
-      currentRobbieMode = packetBuffer[1];
-      updateSegDisplay();
-    } else if (packetBuffer[0] == PACKET_ID_AUDIO_DATA && packetSize == (UDP_AUDIO_BUFF_SIZE + 1)) {
-      memcpy(laserGen.audioBuffer, packetBuffer + 1, UDP_AUDIO_BUFF_SIZE);
+bool handleRobbieMode(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  robbie_mode_packet_t pkt;
+  if (!packet_decode(buf, len, &pkt) || pkt.mode > 9) return false;
+  modeMailbox.write(pkt.mode);
+  return true;
+}
+
+bool handleAudioData(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  static audio_data_packet_t pkt;
+  static audio_samples_t samples;
+  if (!packet_decode(buf, len, &pkt)) return false;
+  memcpy(samples.samples, pkt.samples, UDP_AUDIO_BUFF_SIZE);
+  audioMailbox.write(samples);
+  return true;
+}
+
+bool handleAudioFeatures(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  audio_features_packet_t pkt;
+  if (!packet_decode(buf, len, &pkt)) return false;
+  featureMailbox.write(pkt);
+  return true;
+}
+
+bool handleAudioSpectrum(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  audio_spectrum_packet_t pkt;
+  if (!packet_decode(buf, len, &pkt)) return false;
+  spectrumMailbox.write(pkt);
+  return true;
+}
+
+bool handleAudioBeat(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  audio_beat_packet_t pkt;
+  if (!packet_decode(buf, len, &pkt)) return false;
+  beat_sync_t sync = { millis() + pkt.nextBeatMs, pkt.beatPeriodMs, pkt.beatIndex, pkt.level };
+  beatMailbox.write(sync);
+  return true;
+}
+
+// Core 0: picks up whatever core 1 has received since the last pass. The
+// visualizer follows whichever of samples or features arrived last.
+void readCore1Updates() {
+  static uint32_t audioVersion = 0;
+  static uint32_t featureVersion = 0;
+  static uint32_t spectrumVersion = 0;
+  static uint32_t beatVersion = 0;
+  static uint32_t modeVersion = 0;
+  static uint8_t featureBeats = 0;
+
+  if (audioMailbox.version() != audioVersion) {
+    audioVersion = audioMailbox.read((audio_samples_t *)laserGen.audioBuffer);
+    laserGen.audioFeatures = false;
+  }
+
+  if (featureMailbox.version() != featureVersion) {
+    audio_features_packet_t features;
+    featureVersion = featureMailbox.read(&features);
+    laserGen.audioLevel = (uint8_t)min(features.rms >> 6, 127);
+    laserGen.audioFeatures = true;
+    // Onsets only stand in for beats while there is no beat grid
+    if (features.beats != featureBeats) {
+      featureBeats = features.beats;
+      if (!updateBeatGrid(false)) {
+        laserGen.audioBeatLevel = 127;
+        laserGen.audioBeats++;
+      }
     }
   }
+
+  if (beatMailbox.version() != beatVersion) {
+    beat_sync_t sync;
+    beatVersion = beatMailbox.read(&sync);
+    syncBeatGrid(sync);
+  }
+  updateBeatGrid(true);
+
+  if (spectrumMailbox.version() != spectrumVersion) {
+    audio_spectrum_packet_t spectrum;
+    spectrumVersion = spectrumMailbox.read(&spectrum);
+    for (int i = 0; i < AUDIO_SPECTRUM_BANDS; i++)
+      laserGen.audioSpectrum[i] = (uint8_t)min(spectrum.bands[i] >> 6, 127);
+  }
+
+  if (modeMailbox.version() != modeVersion) {
+    uint8_t mode;
+    modeVersion = modeMailbox.read(&mode);
+    currentRobbieMode = mode;
+    updateSegDisplay();
+  }
+}
+
+// Core 0: the beat grid fires laserGen's beats on time from the jukebox's
+// precomputed beat times, rather than after an onset has been heard
+beat_sync_t beatGrid = {};
+unsigned long beatGridSyncMs = 0;
+
+void syncBeatGrid(const beat_sync_t &sync) {
+  beatGridSyncMs = millis();
+  bool running = beatGrid.periodMs && sync.periodMs;
+  int16_t ahead = (int16_t)(sync.index - beatGrid.index);
+  // A beat the jukebox has moved past but that has not fired here yet
+  // still fires. If the last beat fired here a little early, the jukebox
+  // still has it as next and the sync waits until it catches up; any
+  // other jump, like a new song, is taken as is.
+  if (running && ahead > 0) {
+    laserGen.audioBeatLevel = beatGrid.level >> 1;
+    laserGen.audioBeats++;
+  }
+  if (!running || ahead != -1)
+    beatGrid = sync;
+}
+
+// Returns whether the grid is running, firing a due beat if fire is set
+bool updateBeatGrid(bool fire) {
+  if (!beatGrid.periodMs) return false;
+  if (millis() - beatGridSyncMs > BEAT_GRID_TIMEOUT_MS) {
+    beatGrid.periodMs = 0;
+    return false;
+  }
+  if (fire && (int32_t)(millis() - beatGrid.beatAtMs) >= 0) {
+    laserGen.audioBeatLevel = beatGrid.level >> 1;
+    laserGen.audioBeats++;
+    beatGrid.beatAtMs += beatGrid.periodMs;
+    beatGrid.index++;
+  }
+  return true;
+}
+
+// Core 0: hands core 1 the state it sends out, only when it changed
+void publishCore0State() {
+  static core0_state_t state;
+
+  core0_state_t next = state;
+  next.robbieMode = currentRobbieMode;
+  next.modeChanges = modeChanges;
+  next.numWandsConnected = numWandsConnected;
+  next.wand = wandData[0];
+  if (laserGen.playSoundEffect != -1) {
+    next.soundEffects++;
+    next.soundEffect = laserGen.playSoundEffect;
+    laserGen.playSoundEffect = -1;
+  }
+
+  if (memcmp(&next, &state, sizeof(state)) == 0) return;
+  state = next;
+  stateMailbox.write(state);
+}
+
+// Core 1
+void readCore0State() {
+  static uint32_t version = 0;
+  if (stateMailbox.version() != version)
+    version = stateMailbox.read(&core0State);
+}
+
+bool handlePointStatsRequest(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  point_stats_request_packet_t pkt;
+  if (!packet_decode(buf, len, &pkt)) return false;
+  if (pkt.periodUs >= POINT_PERIOD_MIN_US && pkt.periodUs <= POINT_PERIOD_MAX_US)
+    pointPeriodRequest = pkt.periodUs;
+  sendPointStats(remoteIP, remotePort);
+  return true;
 }
 
 void updateSegDisplay() {
@@ -202,7 +481,7 @@ void checkButtons() {
     if (btn1State == 0 && state == 1) {
       if (currentRobbieMode > 0)
       currentRobbieMode--;
-      sendMode = 1;
+      modeChanges++;
       updateSegDisplay();
     }
     btn1State = state;
@@ -211,7 +490,7 @@ void checkButtons() {
     if (btn2State == 0 && state == 1) {
       if (currentRobbieMode < 9)
       currentRobbieMode++;
-      sendMode = 1;
+      modeChanges++;
       updateSegDisplay();
     }
     btn2State = state;
@@ -221,65 +500,81 @@ void checkButtons() {
 }
 
 void sendButtonData() {
-  if (sendMode == 1) {
-    if (udp.beginPacket(jukeboxIP, 8888) == 1) {
-      uint8_t buf[2] = { PACKET_ID_JUKEBOX_MODE, MODE_MAPPING[currentRobbieMode] };
-      udp.write(buf, 2);
+  static uint8_t sentModeChanges = 0;
+
+  if (core0State.modeChanges != sentModeChanges) {
+    uint8_t buf[PACKET_MAX_LEN(jukebox_mode_packet_t)];
+    size_t len = packet_encode((jukebox_mode_packet_t){MODE_MAPPING[core0State.robbieMode]}, buf, sizeof(buf));
+    if (udp.beginPacket(jukeboxIP, PROTOCOL_PORT) == 1) {
+      udp.write(buf, len);
       udp.endPacket();
     }
 
-    if (udp.beginPacket(ioIP, 8888) == 1) {
-      uint8_t buf[2] = { PACKET_ID_ROBBIE_MODE, currentRobbieMode };
-      udp.write(buf, 2);
+    len = packet_encode((robbie_mode_packet_t){core0State.robbieMode}, buf, sizeof(buf));
+    if (udp.beginPacket(ioIP, PROTOCOL_PORT) == 1) {
+      udp.write(buf, len);
       udp.endPacket();
     }
     
-    sendMode = 0;
+    sentModeChanges = core0State.modeChanges;
   }
 }
 
-void slaveSelect() {
-  while (digitalRead(ESP_RDY_PIN) == HIGH);
-  SPI1.beginTransaction(spiSettings);
-  digitalWrite(ESP_CS_PIN, LOW);
-  for (unsigned long start = millis(); (digitalRead(ESP_RDY_PIN) != HIGH) && (millis() - start) < 5;);
-}
-
-void slaveDeselect() {
-  digitalWrite(ESP_CS_PIN, HIGH);
-  SPI1.endTransaction();
-}
-
+// Non-blocking version of the ESP32 handshake: wait for RDY to go low, drop
+// CS, wait for the ESP32 to raise RDY (or time out), then run the transfer
+// on DMA. Each call advances at most one step, so loop() never waits on the
+// ESP32 and queueLaserData() keeps its 150 us cadence. A 4 byte command is
+// followed by the 40 byte frame, which lands in the back half of spiBuffer
+// and is only parsed once it is complete.
 void checkWandData() {
-  slaveSelect();
-  for (int i = 0; i < 4; i++)
-    SPI1.transfer(0);
-  slaveDeselect();
-  
-  slaveSelect();
-  for (int i = 0; i < 40; i++)
-    spiBuffer[i] = SPI1.transfer(0);
-  slaveDeselect();
+  static wand_spi_state_t state = WAND_SPI_IDLE;
+  static bool framePhase = false;
+  static unsigned long selectTime = 0;
+  static uint8_t txZeros[WAND_FRAME_LEN];
+  static uint8_t cmdRx[WAND_CMD_LEN];
+
+  switch (state) {
+    case WAND_SPI_IDLE:
+      if (digitalRead(ESP_RDY_PIN) == HIGH) return;
+      SPI1.beginTransaction(spiSettings);
+      digitalWrite(ESP_CS_PIN, LOW);
+      selectTime = micros();
+      state = WAND_SPI_WAIT_ACK;
+      // fall through
+
+    case WAND_SPI_WAIT_ACK:
+      if (digitalRead(ESP_RDY_PIN) != HIGH && micros() - selectTime < WAND_ACK_TIMEOUT_US) return;
+      if (framePhase)
+        SPI1.transferAsync(txZeros, spiBuffer[1 - spiFront], WAND_FRAME_LEN);
+      else
+        SPI1.transferAsync(txZeros, cmdRx, WAND_CMD_LEN);
+      state = WAND_SPI_TRANSFER;
+      return;
+
+    case WAND_SPI_TRANSFER:
+      if (!SPI1.finishedAsync()) return;
+      digitalWrite(ESP_CS_PIN, HIGH);
+      SPI1.endTransaction();
+      state = WAND_SPI_IDLE;
+      framePhase = !framePhase;
+      if (framePhase) return;
+      spiFront = 1 - spiFront;
+      break;
+  }
 
+  const uint8_t *frame = spiBuffer[spiFront];
   for (uint8_t i = 0; i < 4; i++) {
-    wandData[i].w = (uint16_t)spiBuffer[1 + i * 9] << 8 | spiBuffer[2 + i * 9];
-    wandData[i].x = (uint16_t)spiBuffer[3 + i * 9] << 8 | spiBuffer[4 + i * 9];
-    wandData[i].y = (uint16_t)spiBuffer[5 + i * 9] << 8 | spiBuffer[6 + i * 9];
-    wandData[i].z = (uint16_t)spiBuffer[7 + i * 9] << 8 | spiBuffer[8 + i * 9];
-    wandData[i].buttonPressed = spiBuffer[9 + i * 9];
+    wandData[i].w = (uint16_t)frame[1 + i * 9] << 8 | frame[2 + i * 9];
+    wandData[i].x = (uint16_t)frame[3 + i * 9] << 8 | frame[4 + i * 9];
+    wandData[i].y = (uint16_t)frame[5 + i * 9] << 8 | frame[6 + i * 9];
+    wandData[i].z = (uint16_t)frame[7 + i * 9] << 8 | frame[8 + i * 9];
+    wandData[i].buttonPressed = frame[9 + i * 9];
   }
 
-  laserGen.wandData1[0] = ((double)wandData[0].x - 16384) / 16384;
-  laserGen.wandData1[1] = ((double)wandData[0].y - 16384) / 16384;
-  laserGen.wandData1[2] = ((double)wandData[0].z - 16384) / 16384;
-  laserGen.wandData1[3] = ((double)wandData[0].w - 16384) / 16384;
+  wand_quaternion(wandData[0].w, wandData[0].x, wandData[0].y, wandData[0].z, laserGen.wandData1);
+  wand_quaternion(wandData[1].w, wandData[1].x, wandData[1].y, wandData[1].z, laserGen.wandData2);
 
-  laserGen.wandData2[0] = ((double)wandData[1].x - 16384) / 16384;
-  laserGen.wandData2[1] = ((double)wandData[1].y - 16384) / 16384;
-  laserGen.wandData2[2] = ((double)wandData[1].z - 16384) / 16384;
-  laserGen.wandData2[3] = ((double)wandData[1].w - 16384) / 16384;
-
-  uint8_t _numWandsConnected = spiBuffer[0];
+  uint8_t _numWandsConnected = frame[0];
   if (_numWandsConnected != numWandsConnected) {
     numWandsConnected = _numWandsConnected;
     laserGen.numWandsConnected = numWandsConnected;
@@ -304,91 +599,338 @@ void checkWandButton() {
 
 void sendWandData() {
   static unsigned long lastUpdate = 0;
-  static unsigned long extraDelay = 0;
-
-  if (numWandsConnected == 0) return;
-
-  if (millis() - lastUpdate > 30 + extraDelay) {
-    if (udp.beginPacket(jukeboxIP, 8888) == 1) {
-      uint8_t buf[10];
-      buf[0] = PACKET_ID_WAND_DATA;
-      buf[1] = (uint8_t)(wandData[0].w >> 8);
-      buf[2] = (uint8_t)(wandData[0].w & 0xff);
-      buf[3] = (uint8_t)(wandData[0].x >> 8);
-      buf[4] = (uint8_t)(wandData[0].x & 0xff);
-      buf[5] = (uint8_t)(wandData[0].y >> 8);
-      buf[6] = (uint8_t)(wandData[0].y & 0xff);
-      buf[7] = (uint8_t)(wandData[0].z >> 8);
-      buf[8] = (uint8_t)(wandData[0].z & 0xff);
-      buf[9] = wandData[0].buttonPressed;
-      udp.write(buf, 10);
-      extraDelay = udp.endPacket() == 1 ? 0 : 1000;
-    } else {
-      extraDelay = 1000;
-    }
 
+  if (core0State.numWandsConnected == 0) return;
+
+  if (millis() - lastUpdate > 30 && jukeboxLink.ready()) {
+    const wand_data_t *wand = &core0State.wand;
+    wand_data_packet_t pkt = { wand->w, wand->x, wand->y, wand->z, wand->buttonPressed };
+    uint8_t buf[PACKET_MAX_LEN(wand_data_packet_t)];
+    link_send(jukeboxLink, udp, PROTOCOL_PORT, buf, packet_encode(pkt, buf, sizeof(buf)));
     lastUpdate = millis();
   }
 }
 
+// Broadcasts the state of every link this node sends on, for anything on
+// the network that wants to watch it
+void sendLinkStatus() {
+  static unsigned long lastUpdate = 0;
+
+  if (millis() - lastUpdate < LINK_STATUS_PERIOD_MS) return;
+  lastUpdate = millis();
+
+  link_status_packet_t pkt;
+  pkt.uptimeMs = millis();
+  pkt.numLinks = 0;
+#if LASER_MULTICAST
+  laserGroupLink.report(&pkt.links[pkt.numLinks++]);
+#else
+  for (int i = 0; i < 3; i++)
+    laserLinks[i].report(&pkt.links[pkt.numLinks++]);
+#endif
+  jukeboxLink.report(&pkt.links[pkt.numLinks++]);
+
+  uint8_t buf[PACKET_MAX_LEN(link_status_packet_t)];
+  size_t len = packet_encode(pkt, buf, sizeof(buf));
+  if (udp.beginPacket(statusIP, PROTOCOL_PORT) == 1) {
+    udp.write(buf, len);
+    udp.endPacket();
+  }
+}
+
+// Runs from the core 0 alarm IRQ once per point period. Points are still
+// generated in loop(), this only records that one is due, so a slow
+// get_point() delays points instead of dropping the schedule. Every tick
+// that finds the previous one unhandled means generation is running late,
+// and is counted here only.
+bool pointTimerCallback(repeating_timer_t *rt) {
+  if (pointTicks != handledTicks)
+    pointStats.lateTicks++;
+
+  uint16_t level = queue_get_level(&data_buf);
+  if (level < pointStats.queueMin) pointStats.queueMin = level;
+  if (level > pointStats.queueMax) pointStats.queueMax = level;
+
+  pointTickUs = time_us_32();
+  pointTicks++;
+  pointStats.ticks++;
+  return true;
+}
+
+void startPointScheduler(uint16_t periodUs) {
+  if (periodUs < POINT_PERIOD_MIN_US || periodUs > POINT_PERIOD_MAX_US) return;
+  cancel_repeating_timer(&pointTimer);
+  pointPeriodUs = periodUs;
+  pointPeriodRequest = periodUs;
+  handledTicks = pointTicks;
+  // Negative delay keeps a fixed rate regardless of callback latency
+  add_repeating_timer_us(-(int64_t)periodUs, pointTimerCallback, NULL, &pointTimer);
+}
+
+void resetPointStats() {
+  uint32_t irq = save_and_disable_interrupts();
+  pointStats.ticks = 0;
+  pointStats.lateTicks = 0;
+  pointStats.skippedTicks = 0;
+  pointStats.dropped = 0;
+  pointStats.queueMin = UINT16_MAX;
+  pointStats.queueMax = 0;
+  for (int i = 0; i < JITTER_BUCKETS; i++)
+    pointStats.jitter[i] = 0;
+  restore_interrupts(irq);
+}
+
+void recordJitter(uint32_t lateUs) {
+  int bucket = 0;
+  while (bucket < JITTER_BUCKETS - 1 && lateUs >= JITTER_BUCKET_US[bucket])
+    bucket++;
+  pointStats.jitter[bucket]++;
+}
+
 void queueLaserData() {
-  static unsigned long nextTime = micros();
+  if (pointPeriodRequest != pointPeriodUs)
+    startPointScheduler(pointPeriodRequest);
+
+  static uint32_t extremesHandled = 0;
+  uint32_t irq = save_and_disable_interrupts();
+  uint32_t ticks = pointTicks;
+  uint32_t tickUs = pointTickUs;
+  if (pointExtremesRequest != extremesHandled) {
+    extremesHandled = pointExtremesRequest;
+    pointStats.queueMin = UINT16_MAX;
+    pointStats.queueMax = 0;
+  }
+  restore_interrupts(irq);
+
+  // After a long stall, skip ahead rather than bursting out stale points.
+  // The IRQ has already counted these ticks as late, but unlike other late
+  // ticks they never get a point, so they are counted again as dropouts.
+  if (ticks - handledTicks > POINT_CATCHUP_MAX) {
+    pointStats.skippedTicks += ticks - handledTicks - POINT_CATCHUP_MAX;
+    handledTicks = ticks - POINT_CATCHUP_MAX;
+  }
+
+  // Every pending point is generated in one block
+  static laser_point_x3_t points[POINT_CATCHUP_MAX];
+  uint32_t n = ticks - handledTicks;
+  if (n == 0) return;
+  laserGen.get_points(currentRobbieMode, points, n);
+
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t dueUs = tickUs - (n - i - 1) * pointPeriodUs;
+    if (!queue_try_add(&data_buf, &points[i]))
+      pointStats.dropped++;
+    recordJitter(time_us_32() - dueUs);
+  }
+  handledTicks = ticks;
+}
 
-  unsigned long currTime = micros();
-  if (currTime > nextTime) {
-    laser_point_x3_t p = laserGen.get_point(currentRobbieMode);
-    queue_try_add(&data_buf, &p);
-    nextTime += 150;
+// Counters are written from core 0 and only read here on core 1. Each field
+// is a single aligned word, so a report can mix two ticks but never tears a
+// value.
+void sendPointStats(IPAddress ip, uint16_t port) {
+  point_stats_packet_t pkt;
+  // The period core 0 runs at once it has seen the latest request, so an
+  // out of range request is answered with the period that stayed in force
+  pkt.periodUs = pointPeriodRequest;
+  pkt.queueLevel = queue_get_level(&data_buf);
+  pkt.queueMin = pointStats.queueMin == UINT16_MAX ? 0 : pointStats.queueMin;
+  pkt.queueMax = pointStats.queueMax;
+  pkt.ticks = pointStats.ticks;
+  pkt.lateTicks = pointStats.lateTicks;
+  pkt.skippedTicks = pointStats.skippedTicks;
+  pkt.dropped = pointStats.dropped;
+  for (int i = 0; i < JITTER_BUCKETS; i++)
+    pkt.jitter[i] = pointStats.jitter[i];
+
+  uint8_t buf[PACKET_MAX_LEN(point_stats_packet_t)];
+  size_t len = packet_encode(pkt, buf, sizeof(buf));
+
+  // Occupancy extremes are per report, the rest are running totals. Core 0
+  // restarts them on its next pass.
+  pointExtremesRequest = pointExtremesRequest + 1;
+
+  if (udp.beginPacket(ip, port) == 1) {
+    udp.write(buf, len);
+    udp.endPacket();
   }
 }
 
+// Each projector gets its own socket so all three packets can be built in
+// the W5500's TX buffers at once. Points are streamed in as chunks of
+// LASER_CHUNK_POINTS instead of one 1021 byte write per projector, which
+// spreads the SPI traffic over the packet and keeps rx.poll() from waiting
+// behind a 3 KB burst.
+// endPacket() is where the W5500 resolves the projector's MAC and sends, so
+// it is the only part of the streamed packet that is timed
+void sendLaserPacket(int i) {
+  unsigned long start = micros();
+  bool ok = laserUdp[i].endPacket() == 1;
+  laserLinks[i].record(ok, micros() - start);
+}
+
 void sendLaserData() {
   static uint8_t seqNum = 0;
-  static uint16_t currIndex = 1;
-  static uint8_t packetBuf[3][LASER_PACKET_LEN];
-  static unsigned long pausedTime[3] = {0, 0, 0};
-  static uint8_t failedAttempts[3] = {0, 0, 0};
+  static uint16_t numPoints = 0;
+  static uint16_t chunkIndex = 0;
+  static uint8_t chunkBuf[3][LASER_CHUNK_LEN];
+  static bool streaming[3] = {false, false, false};
 
   if (!queueReady) return;
 
   laser_point_x3_t newPoint;
-  if (queue_try_remove(&data_buf, &newPoint)) {
+  if (!queue_try_remove(&data_buf, &newPoint)) return;
+
+  if (numPoints == 0) {
     for (int i = 0; i < 3; i++) {
-      packetBuf[i][0] = seqNum;
-      laserGen.point_to_bytes(&(newPoint.p[i]), packetBuf[i], currIndex);
+      streaming[i] = false;
+      if (!laserLinks[i].ready()) continue;
+      if (laserUdp[i].beginPacket(laserIPs[i], 8090) == 1) {
+        laserUdp[i].write(seqNum);
+        streaming[i] = true;
+      }
     }
-    currIndex += 6;
-    
-    if (currIndex >= LASER_PACKET_LEN) {
-      for (int i = 0; i < 3; i++) {
-        if (pausedTime[i] > millis() || failedAttempts[i] > 12) continue;
-        if (udp.beginPacket(laserIPs[i], 8090) == 1) {
-          udp.write(packetBuf[i], LASER_PACKET_LEN);
-          if (udp.endPacket() != 1) {
-            pausedTime[i] = millis() + 5000;
-            failedAttempts[i]++;
-          }
-        }
+  }
+
+  for (int i = 0; i < 3; i++)
+    laserGen.point_to_bytes(&(newPoint.p[i]), chunkBuf[i], chunkIndex);
+  chunkIndex += 6;
+  numPoints++;
+
+  if (chunkIndex >= LASER_CHUNK_LEN) {
+    for (int i = 0; i < 3; i++)
+      if (streaming[i]) laserUdp[i].write(chunkBuf[i], LASER_CHUNK_LEN);
+    chunkIndex = 0;
+  }
+
+  if (numPoints >= LASER_PACKET_POINTS) {
+    for (int i = 0; i < 3; i++) {
+      if (streaming[i]) sendLaserPacket(i);
+    }
+
+    numPoints = 0;
+    seqNum++;
+  }
+}
+
+// Compressed version of sendLaserData(). The encoded size of a point varies,
+// so each projector's ops collect in its chunk buffer until they pass
+// LASER_CHUNK_LEN. All three packets are ended together once any of them
+// might not fit another point, which keeps the sequence numbers in step.
+void sendCompressedLaserData() {
+  static uint8_t seqNum = 0;
+  static uint16_t numPoints = 0;
+  static point_encoder encoders[3];
+  static uint8_t chunkBuf[3][LASER_CHUNK_LEN + LASER_CODEC_MAX_POINT_LEN];
+  static uint16_t chunkLen[3] = {0, 0, 0};
+  static uint16_t packetLen[3] = {0, 0, 0};
+  static bool streaming[3] = {false, false, false};
+
+  if (!queueReady) return;
+
+  laser_point_x3_t newPoint;
+  if (!queue_try_remove(&data_buf, &newPoint)) return;
+
+  if (numPoints == 0) {
+    for (int i = 0; i < 3; i++) {
+      encoders[i].reset();
+      chunkLen[i] = 0;
+      packetLen[i] = LASER_CODEC_HEADER_LEN;
+      streaming[i] = false;
+      if (!laserLinks[i].ready()) continue;
+      if (laserUdp[i].beginPacket(laserIPs[i], 8090) == 1) {
+        uint8_t header[LASER_CODEC_HEADER_LEN] = { seqNum, LASER_CODEC_ID };
+        laserUdp[i].write(header, LASER_CODEC_HEADER_LEN);
+        streaming[i] = true;
       }
-      
-      currIndex = 1;
-      seqNum++;
     }
   }
+
+  bool full = ++numPoints >= LASER_CODEC_PACKET_POINTS;
+  for (int i = 0; i < 3; i++) {
+    chunkLen[i] += encoders[i].add(&(newPoint.p[i]), chunkBuf[i] + chunkLen[i]);
+    if (chunkLen[i] >= LASER_CHUNK_LEN) {
+      if (streaming[i]) laserUdp[i].write(chunkBuf[i], chunkLen[i]);
+      packetLen[i] += chunkLen[i];
+      chunkLen[i] = 0;
+    }
+    if (packetLen[i] + chunkLen[i] + LASER_CODEC_MAX_POINT_LEN + 1 > LASER_PACKET_MAX_LEN)
+      full = true;
+  }
+
+  if (full) {
+    for (int i = 0; i < 3; i++) {
+      chunkLen[i] += encoders[i].flush(chunkBuf[i] + chunkLen[i]);
+      if (!streaming[i]) continue;
+      if (chunkLen[i] > 0) laserUdp[i].write(chunkBuf[i], chunkLen[i]);
+      sendLaserPacket(i);
+    }
+
+    numPoints = 0;
+    seqNum++;
+  }
+}
+
+// Multicast version of sendLaserData(). The three projectors' points go out
+// in one datagram, so the W5500 handles one socket and one SEND per frame
+// instead of three, and the group address needs no ARP per projector.
+void sendLaserFrame() {
+  static uint8_t seqNum = 0;
+  static uint16_t numPoints = 0;
+  static uint16_t chunkPoint = 0;
+  static uint8_t chunkBuf[LASER_FRAME_CHUNK_LEN];
+  static bool streaming = false;
+
+  if (!queueReady) return;
+
+  laser_point_x3_t newPoint;
+  if (!queue_try_remove(&data_buf, &newPoint)) return;
+
+  if (numPoints == 0) {
+    streaming = false;
+    if (laserGroupLink.ready() && laserFrameUdp.beginPacket(laserGroupIP, LASER_FRAME_PORT) == 1) {
+      uint8_t header[LASER_FRAME_HEADER_LEN];
+      laser_frame_header(header, seqNum);
+      laserFrameUdp.write(header, LASER_FRAME_HEADER_LEN);
+      streaming = true;
+    }
+  }
+
+  for (int i = 0; i < 3; i++)
+    laserGen.point_to_bytes(&(newPoint.p[i]), chunkBuf, LASER_FRAME_CHUNK_OFFSET(i, chunkPoint));
+  chunkPoint++;
+  numPoints++;
+
+  if (chunkPoint >= LASER_FRAME_CHUNK_POINTS) {
+    if (streaming) laserFrameUdp.write(chunkBuf, LASER_FRAME_CHUNK_LEN);
+    chunkPoint = 0;
+  }
+
+  if (numPoints >= LASER_FRAME_POINTS) {
+    if (streaming) {
+      unsigned long start = micros();
+      bool ok = laserFrameUdp.endPacket() == 1;
+      laserGroupLink.record(ok, micros() - start);
+    }
+
+    numPoints = 0;
+    seqNum++;
+  }
 }
 
 void sendSoundEffect() {
-  if (laserGen.playSoundEffect == -1) return;
-
-  if (udp.beginPacket(jukeboxIP, 8888) == 1) {
-    uint8_t buf[30];
-    buf[0] = PACKET_ID_PLAY_EFFECT;
-    for (int i = 0; i < strlen(laserGen.soundEffects[laserGen.playSoundEffect]); i++)
-      buf[1 + i] = (uint8_t)(laserGen.soundEffects[laserGen.playSoundEffect][i]);
-    buf[1 + strlen(laserGen.soundEffects[laserGen.playSoundEffect])] = 0;
-    udp.write(buf, 2 + strlen(laserGen.soundEffects[laserGen.playSoundEffect]));
+  static uint8_t sentSoundEffects = 0;
+
+  if (core0State.soundEffects == sentSoundEffects) return;
+
+  if (udp.beginPacket(jukeboxIP, PROTOCOL_PORT) == 1) {
+    play_effect_packet_t pkt;
+    strncpy(pkt.fileName, laserGen.soundEffects[core0State.soundEffect], PROTOCOL_SONG_NAME_LEN - 1);
+    pkt.fileName[PROTOCOL_SONG_NAME_LEN - 1] = '\0';
+    uint8_t buf[PACKET_MAX_LEN(play_effect_packet_t)];
+    udp.write(buf, packet_encode(pkt, buf, sizeof(buf)));
     udp.endPacket();
   }
 
-  laserGen.playSoundEffect = -1;
+  sentSoundEffects = core0State.soundEffects;
 }
@@ -1,4 +1,51 @@
 #include "sierpinski.h"
+#include "lookup_tables.h"
+
+// Per-point kernels shared by the double and Q16.16 overloads below
+
+template <typename T>
+static xy_t to_laser_coords(T matrix[4][4], T v[3]) {
+  T v2[4] = {v[0], v[1], v[2], 1};
+  T dot_result[4];
+  dot_mv(4, &matrix[0][0], v2, dot_result);
+  return (xy_t){(int)dot_result[0], (int)dot_result[1], true};
+}
+
+template <typename T>
+static void quaternion_direction(T q[4], T wand_vector[3], T pitch_diff, T yaw_diff, T result[3]) {
+  T qv[3];
+  rotate(q, wand_vector, qv);
+  T pitch = asin(qv[2]) + pitch_diff;
+  T yaw = atan2(qv[1], qv[0]) + yaw_diff;
+  result[0] = cos(pitch) * cos(yaw);
+  result[1] = cos(pitch) * sin(yaw);
+  result[2] = sin(pitch);
+}
+
+template <typename T>
+static int surface_intersection(T end[3], T surfaces[3][4][3], T plane_normals[3][3], T result[3]) {
+  T start[3] = {0, 0, WAND_HEIGHT};
+  T v[3] = {end[0] - start[0], end[1] - start[1], end[2] - start[2]};
+  if (v[2] < (T)0) return -1;
+  
+  for (int i = 0; i < 3; i++) {
+    T denom = 0.0;
+    for (int j = 0; j < 3; j++)
+      denom += v[j] * plane_normals[i][j];
+    if (denom < (T)0.01) continue;
+
+    T dot = 0.0;
+    for (int j = 0; j < 3; j++)
+      dot += (surfaces[i][0][j] - end[j]) * (plane_normals[i][j] / denom);
+    for (int j = 0; j < 3; j++)
+      result[j] = end[j] + dot * v[j];
+    
+    if (point_in_surface(surfaces[i][0], surfaces[i][1], surfaces[i][2], surfaces[i][3], result))
+      return i;
+  }
+
+  return -1;
+}
 
 void Sierpinski::init() {
   triangle_height = sqrt(SIDE_LENGTH * SIDE_LENGTH - (SIDE_LENGTH / 2) * (SIDE_LENGTH / 2));
@@ -120,6 +167,25 @@ void Sierpinski::calibrate_wand_position(double q[4]) {
 
   pitch_diff = asin(target_vector[2]) - asin(wand_pos[2]);
   yaw_diff = atan2(target_vector[1], target_vector[0]) - atan2(wand_pos[1], wand_pos[0]);
+  update_fixed_point_geometry();
+}
+
+void Sierpinski::update_fixed_point_geometry() {
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      plane_normals_fx[i][j] = plane_normals[i][j];
+      for (int k = 0; k < 4; k++)
+        surfaces_fx[i][k][j] = surfaces[i][k][j];
+    }
+    for (int j = 0; j < 4; j++)
+      for (int k = 0; k < 4; k++)
+        inv_trans_matrix_fx[i][j][k] = inv_trans_matrix[i][j][k];
+  }
+
+  for (int i = 0; i < 3; i++)
+    wand_vector_fx[i] = wand_vector[i];
+  yaw_diff_fx = yaw_diff;
+  pitch_diff_fx = pitch_diff;
 }
 
 void Sierpinski::laser_to_sierpinski_coords(int laser_index, int x, int y, double result[3]) {
@@ -132,10 +198,11 @@ void Sierpinski::laser_to_sierpinski_coords(int laser_index, int x, int y, doubl
 }
 
 xy_t Sierpinski::sierpinski_to_laser_coords(int laser_index, double v[3]) {
-  double v2[4] = {v[0], v[1], v[2], 1};
-  double dot_result[4];
-  dot_mv(4, &inv_trans_matrix[laser_index][0][0], v2, dot_result);
-  return (xy_t){(int)dot_result[0], (int)dot_result[1], true};
+  return to_laser_coords(inv_trans_matrix[laser_index], v);
+}
+
+xy_t Sierpinski::sierpinski_to_laser_coords(int laser_index, fix16 v[3]) {
+  return to_laser_coords(inv_trans_matrix_fx[laser_index], v);
 }
 
 void Sierpinski::get_laser_coordinate_bounds(xy_t result[4]) {
@@ -155,42 +222,25 @@ void Sierpinski::get_laser_rect_interior(uint16_t result[4]) {
 }
 
 void Sierpinski::apply_quaternion(double q[4], double result[3]) {
-  double qv[3];
-  rotate(q, wand_vector, qv);
-  double pitch = asin(qv[2]) + pitch_diff;
-  double yaw = atan2(qv[1], qv[0]) + yaw_diff;
-  result[0] = cos(pitch) * cos(yaw);
-  result[1] = cos(pitch) * sin(yaw);
-  result[2] = sin(pitch);
+  quaternion_direction(q, wand_vector, pitch_diff, yaw_diff, result);
 }
 
-void Sierpinski::get_wand_projection(double q[4], int *laser_index, double result[3]) {
-  *laser_index = -1;
+void Sierpinski::apply_quaternion(fix16 q[4], fix16 result[3]) {
+  quaternion_direction(q, wand_vector_fx, pitch_diff_fx, yaw_diff_fx, result);
+}
 
-  double start[3] = {0, 0, WAND_HEIGHT};
+void Sierpinski::get_wand_projection(double q[4], int *laser_index, double result[3]) {
   double end[3];
   apply_quaternion(q, end);
   end[2] += WAND_HEIGHT;
-  double v[3] = {end[0] - start[0], end[1] - start[1], end[2] - start[2]};
-  if (v[2] < 0) return;
-  
-  for (int i = 0; i < 3; i++) {
-    double denom = 0.0;
-    for (int j = 0; j < 3; j++)
-      denom += v[j] * plane_normals[i][j];
-    if (denom < 0.01) continue;
+  *laser_index = surface_intersection(end, surfaces, plane_normals, result);
+}
 
-    double dot = 0.0;
-    for (int j = 0; j < 3; j++)
-      dot += (surfaces[i][0][j] - end[j]) * (plane_normals[i][j] / denom);
-    for (int j = 0; j < 3; j++)
-      result[j] = end[j] + dot * v[j];
-    
-    if (point_in_surface(surfaces[i][0], surfaces[i][1], surfaces[i][2], surfaces[i][3], result)) {
-      *laser_index = i;
-      return;
-    }
-  }
+void Sierpinski::get_wand_projection(fix16 q[4], int *laser_index, fix16 result[3]) {
+  fix16 end[3];
+  apply_quaternion(q, end);
+  end[2] += WAND_HEIGHT;
+  *laser_index = surface_intersection(end, surfaces_fx, plane_normals_fx, result);
 }
 
 rgb_t Sierpinski::get_wand_rotation_color(double q[4], int degree_offset) {
@@ -198,6 +248,11 @@ rgb_t Sierpinski::get_wand_rotation_color(double q[4], int degree_offset) {
   return get_color_from_angle(angle + degree_offset);
 }
 
+rgb_t Sierpinski::get_wand_rotation_color(fix16 q[4], int degree_offset) {
+  int angle = wand_rotation(q);
+  return get_color_from_angle(angle + degree_offset);
+}
+
 rgb_t Sierpinski::get_color_from_angle(int angle) {
-  return hsv_to_rgb((double)(angle % 360) / 360.0, 1.0, 1.0);
+  return hue_to_rgb(angle);
 }
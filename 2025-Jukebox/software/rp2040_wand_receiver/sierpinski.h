@@ -14,11 +14,15 @@ class Sierpinski {
     void calibrate_wand_position(double q[4]);
     void laser_to_sierpinski_coords(int laser_index, int x, int y, double result[3]);
     xy_t sierpinski_to_laser_coords(int laser_index, double v[3]);
+    xy_t sierpinski_to_laser_coords(int laser_index, fix16 v[3]);
     void get_laser_coordinate_bounds(xy_t result[4]);
     void get_laser_rect_interior(uint16_t result[4]);
     void apply_quaternion(double q[4], double result[3]);
+    void apply_quaternion(fix16 q[4], fix16 result[3]);
     void get_wand_projection(double q[4], int *laser_index, double result[3]);
+    void get_wand_projection(fix16 q[4], int *laser_index, fix16 result[3]);
     rgb_t get_wand_rotation_color(double q[4], int degree_offset);
+    rgb_t get_wand_rotation_color(fix16 q[4], int degree_offset);
     rgb_t get_color_from_angle(int angle);
 
   private:
@@ -36,6 +40,16 @@ class Sierpinski {
 
     double yaw_diff = 0.0;
     double pitch_diff = 0.0;
+
+    // Q16.16 copies of the geometry used by the fixed point overloads
+    fix16 surfaces_fx[3][4][3];
+    fix16 plane_normals_fx[3][3];
+    fix16 wand_vector_fx[3];
+    fix16 inv_trans_matrix_fx[3][4][4];
+    fix16 yaw_diff_fx;
+    fix16 pitch_diff_fx;
+
+    void update_fixed_point_geometry();
 };
 
 #endif
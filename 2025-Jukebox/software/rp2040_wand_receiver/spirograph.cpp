@@ -1,4 +1,5 @@
 #include "spirograph.h"
+#include "lookup_tables.h"
 
 void Spirograph::init(double r1, double r2, double a, double t_d) {
   _r1 = r1;
@@ -38,11 +39,11 @@ void Spirograph::update(double xs, double ys, double xo, double yo) {
   }
 
   double q1 = _t;
-  double s1 = sin(q1);
-  double c1 = cos(q1);
+  double s1, c1;
+  sincos_rad(q1, &s1, &c1);
   double q2 = q1 * _r1 / _r2;
-  double s2 = sin(q2);
-  double c2 = cos(q2);
+  double s2, c2;
+  sincos_rad(q2, &s2, &c2);
   x = _r1 * s1 + _a * _r2 * (-s1 + c2 * s1 - c1 * s2);
   y = -_r1 * c1 + _a * _r2 * (c1 - c1 * c2 - s1 * s2);
   x = x * xs + xo;
@@ -0,0 +1,100 @@
+"""Prints the jukebox's play_log.bin, written by jukebox/PlayLog.cpp, with
+song names from song_catalog.bin when it is given.
+
+    python read_play_log.py play_log.bin [song_catalog.bin] [--summary]
+"""
+import struct
+import sys
+
+LOG_MAGIC = b'JBPL'
+LOG_VERSION = 1
+LOG_HEADER = struct.Struct('<4sHH')
+LOG_RECORD = struct.Struct('<IIIIHBBHH')
+
+CATALOG_MAGIC = b'JBCT'
+CATALOG_HEADER = struct.Struct('<4sHHHHIII')
+
+TYPES = {0: 'boot', 1: 'song', 2: 'resume'}
+ENDS = {0: 'finished', 1: 'skipped', 2: 'paused'}
+
+
+def read_catalog_names(path: str) -> list[str]:
+    """Returns the display names from the jukebox's song catalog"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    magic, _, count, _, _, _, names_offset, names_size = CATALOG_HEADER.unpack_from(data)
+    if magic != CATALOG_MAGIC:
+        raise ValueError(f'{path} is not a song catalog')
+    names = data[names_offset:names_offset + names_size].split(b'\0')
+    return [name.decode('utf-8', 'replace') for name in names[:count]]
+
+
+def read_log(path: str) -> list[tuple]:
+    """Returns the records of a play log, ignoring a partly written last one"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    magic, version, record_size = LOG_HEADER.unpack_from(data)
+    if magic != LOG_MAGIC or version != LOG_VERSION:
+        raise ValueError(f'{path} is not a version {LOG_VERSION} play log')
+    if record_size < LOG_RECORD.size:
+        raise ValueError(f'{path} has {record_size} byte records, expected {LOG_RECORD.size}')
+    return [LOG_RECORD.unpack_from(data, offset)
+            for offset in range(LOG_HEADER.size, len(data) - record_size + 1, record_size)]
+
+
+def song_id(index: int) -> str:
+    return f'{chr(ord("A") + index // 10)}{index % 10}'
+
+
+def print_records(records: list[tuple], names: list[str]) -> None:
+    print(f'{"boot":>4} {"start":>9} {"id":>3} {"type":<6} {"end":<8} {"played":>7} {"wait":>7} '
+          f'{"gap ms":>7} {"min fill":>8} {"under":>5}  name')
+    boot = 0
+    for start_ms, played_ms, wait_ms, gap_us, song, kind, end, min_fill, underruns in records:
+        if kind == 0:
+            boot += 1
+            print(f'{boot:>4} {"":>9} --- boot')
+            continue
+        name = names[song] if song < len(names) else ''
+        print(f'{boot:>4} {start_ms / 1000:>8.1f}s {song_id(song):>3} {TYPES.get(kind, kind):<6} '
+              f'{ENDS.get(end, end):<8} {played_ms / 1000:>6.1f}s {wait_ms / 1000:>6.1f}s '
+              f'{gap_us / 1000:>7.2f} {min_fill:>8} {underruns:>5}  {name}')
+
+
+def print_summary(records: list[tuple], names: list[str]) -> None:
+    plays = [r for r in records if r[5] != 0]
+    if not plays:
+        print('No songs played')
+        return
+    songs = [r for r in plays if r[5] == 1]
+    skipped = sum(1 for r in plays if r[6] == 1)
+    gaps = [r[3] for r in songs if r[3] > 0]
+    print(f'{sum(1 for r in records if r[5] == 0)} boots, {len(songs)} songs, {skipped} skipped, '
+          f'{sum(r[1] for r in plays) / 3600000:.1f} h played')
+    if songs:
+        print(f'queue wait: mean {sum(r[2] for r in songs) / len(songs) / 1000:.1f} s, '
+              f'max {max(r[2] for r in songs) / 1000:.1f} s')
+    if gaps:
+        print(f'gap between songs: mean {sum(gaps) / len(gaps) / 1000:.2f} ms, max {max(gaps) / 1000:.2f} ms')
+    print(f'read-ahead: lowest fill {min(r[7] for r in plays)} bytes, '
+          f'{sum(r[8] for r in plays)} underruns in {sum(1 for r in plays if r[8])} plays')
+
+    counts: dict[int, int] = {}
+    for r in songs:
+        counts[r[4]] = counts.get(r[4], 0) + 1
+    print('most played:')
+    for song, count in sorted(counts.items(), key=lambda item: -item[1])[:10]:
+        print(f'  {count:>4}  {song_id(song)}  {names[song] if song < len(names) else ""}')
+
+
+if __name__ == '__main__':
+    args = [a for a in sys.argv[1:] if not a.startswith('--')]
+    if not args:
+        print(__doc__)
+        sys.exit(1)
+    records = read_log(args[0])
+    names = read_catalog_names(args[1]) if len(args) > 1 else []
+    if '--summary' in sys.argv:
+        print_summary(records, names)
+    else:
+        print_records(records, names)
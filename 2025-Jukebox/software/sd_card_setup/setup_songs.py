@@ -1,6 +1,9 @@
 import random
 import os
+import struct
 import subprocess
+import wave
+import numpy as np
 from reportlab.pdfgen import canvas
 from reportlab.lib.pagesizes import letter
 
@@ -38,6 +41,205 @@ class SongHandler:
         return chr(ord('A') + (len(self.songs) - 1) // 10)
 
 
+# song_catalog.bin, read by the jukebox in SongCatalog.cpp. Little endian:
+#   header   magic, version, count, entry size, reserved,
+#            entries offset, names offset, names size
+#   entries  path offset, duration in ms, offset of the song in
+#            song_meta.bin (0 for none), gain in Q8, path length, flags
+#   names    NUL terminated display names in song order, kept in RAM
+#   paths    song paths on the card, read when a song starts
+CATALOG_MAGIC = b'JBCT'
+CATALOG_VERSION = 2
+CATALOG_HEADER = struct.Struct('<4sHHHHIII')
+CATALOG_ENTRY = struct.Struct('<IIIHBB')
+CATALOG_MAX_SONGS = 260
+CATALOG_NAME_LEN = 60    # PROTOCOL_SONG_NAME_LEN, including the NUL
+CATALOG_PATH_LEN = 96    # SONG_PATH_LEN, including the NUL
+# AudioOutput::SetGain() stores gain * 64 in a byte, so its own limit of 4.0
+# at full volume would wrap to 0 and play silent
+CATALOG_MAX_GAIN = 255 / 64
+
+# song_meta.bin, streamed by the jukebox during playback in SongMeta.cpp.
+# Little endian, a header of magic, version and song count, then one
+# section per song:
+#   section  tempo in 1/100 BPM, envelope rate in Hz, beat count,
+#            envelope count, beat times in ms, envelope levels
+# Levels are RMS over 1 / META_ENVELOPE_HZ s, 0 at -60 dBFS up to 255 at
+# full scale.
+META_MAGIC = b'JBMT'
+META_VERSION = 1
+META_HEADER = struct.Struct('<4sHH')
+META_SECTION = struct.Struct('<HHII')
+META_ENVELOPE_HZ = 20
+
+# Beat tracking runs on a copy at a quarter of the rate, with an onset
+# envelope of BEAT_HOP samples (~11.6 ms at 44.1 kHz)
+BEAT_DECIMATE = 4
+BEAT_FRAME = 512
+BEAT_HOP = 128
+BEAT_MIN_BPM = 60
+BEAT_MAX_BPM = 200
+BEAT_TIGHTNESS = 100
+
+
+class SongAnalysis:
+    """What the setup measures in one song's WAV"""
+    def __init__(self) -> None:
+        self.duration_ms = 0
+        self.rms = 0.0
+        self.peak = 0
+        self.envelope = b''
+        self.tempo_bpm = 0.0
+        self.beats_ms: list[int] = []
+
+
+def onset_strength(mono: np.ndarray) -> np.ndarray:
+    """Spectral flux of the log magnitude, one value per BEAT_HOP"""
+    count = 1 + (len(mono) - BEAT_FRAME) // BEAT_HOP
+    if count < 2:
+        return np.zeros(0)
+    window = np.hanning(BEAT_FRAME)
+    flux = np.zeros(count)
+    previous = None
+    for first in range(0, count, 4096):
+        last = min(first + 4096, count)
+        index = np.arange(first, last)[:, None] * BEAT_HOP + np.arange(BEAT_FRAME)
+        spectrum = np.log1p(100 * np.abs(np.fft.rfft(mono[index] * window, axis=1)))
+        if previous is not None:
+            spectrum = np.vstack([previous, spectrum])
+        rise = np.maximum(np.diff(spectrum, axis=0), 0).sum(axis=1)
+        flux[last - len(rise):last] = rise
+        previous = spectrum[-1:]
+    flux -= flux.mean()
+    return flux / (flux.std() + 1e-9)
+
+
+def track_beats(onsets: np.ndarray, fps: float) -> tuple[float, list[float]]:
+    """Returns the tempo in BPM and the beat times in frames, by picking the
+    strongest periodicity near 120 BPM and then the beat sequence that best
+    follows the onsets at that period (Ellis, 2007)"""
+    min_lag = int(60 * fps / BEAT_MAX_BPM)
+    max_lag = int(60 * fps / BEAT_MIN_BPM)
+    if len(onsets) < 2 * max_lag:
+        return 0.0, []
+
+    lags = np.arange(min_lag, max_lag + 1)
+    corr = np.array([np.dot(onsets[:-lag], onsets[lag:]) / (len(onsets) - lag) for lag in lags])
+    bpm = 60 * fps / lags
+    corr *= np.exp(-0.5 * np.log2(bpm / 120) ** 2)
+    period = float(lags[np.argmax(corr)])
+
+    score = onsets.copy()
+    backlink = np.full(len(onsets), -1)
+    offsets = np.arange(-int(round(2 * period)), -int(round(period / 2)) + 1)
+    penalty = -BEAT_TIGHTNESS * np.log(-offsets / period) ** 2
+    for t in range(-offsets[0], len(onsets)):
+        candidates = score[t + offsets] + penalty
+        best = int(np.argmax(candidates))
+        if candidates[best] > 0:
+            score[t] += candidates[best]
+            backlink[t] = t + offsets[best]
+
+    t = len(onsets) - int(period) + int(np.argmax(score[-int(period):]))
+    beats = []
+    while t >= 0:
+        beats.append(float(t))
+        t = backlink[t]
+    return 60 * fps / period, beats[::-1]
+
+
+def analyze_wav(path: str) -> SongAnalysis:
+    """Measures a 16 bit WAV for the catalog and the metadata sidecar"""
+    result = SongAnalysis()
+    with wave.open(path, 'rb') as w:
+        rate, channels = w.getframerate(), w.getnchannels()
+        result.duration_ms = w.getnframes() * 1000 // rate
+        if w.getsampwidth() != 2:
+            return result
+        samples = np.frombuffer(w.readframes(w.getnframes()), dtype='<i2').reshape(-1, channels)
+    if len(samples) == 0:
+        return result
+
+    square = samples.astype(np.float64) ** 2
+    result.rms = float(np.sqrt(square.mean()))
+    result.peak = int(np.abs(samples.astype(np.int32)).max())
+
+    hop = rate // META_ENVELOPE_HZ
+    frames = len(square) // hop
+    if frames > 0:
+        power = square[:frames * hop].reshape(frames, -1).mean(axis=1)
+        db = 10 * np.log10(np.maximum(power, 1e-12) / 32768 ** 2)
+        result.envelope = np.clip(np.round((db + 60) * 255 / 60), 0, 255).astype(np.uint8).tobytes()
+
+    mono = samples.astype(np.float32).mean(axis=1) / 32768
+    mono = mono[:len(mono) // BEAT_DECIMATE * BEAT_DECIMATE].reshape(-1, BEAT_DECIMATE).mean(axis=1)
+    fps = rate / BEAT_DECIMATE / BEAT_HOP
+    result.tempo_bpm, beats = track_beats(onset_strength(mono), fps)
+    # The flux of a frame peaks once the onset is a quarter of the way into
+    # the window, through the rising half of the Hann taper
+    result.beats_ms = [int(round((b * BEAT_HOP + BEAT_FRAME * 3 / 4) * BEAT_DECIMATE * 1000 / rate)) for b in beats]
+    return result
+
+
+def write_meta(analyses: list[SongAnalysis], out_path: str) -> list[int]:
+    """Writes the metadata sidecar, returns each song's offset in it"""
+    offsets = []
+    with open(out_path, 'wb') as f:
+        f.write(META_HEADER.pack(META_MAGIC, META_VERSION, len(analyses)))
+        for analysis in analyses:
+            offsets.append(f.tell())
+            f.write(META_SECTION.pack(round(analysis.tempo_bpm * 100), META_ENVELOPE_HZ,
+                                      len(analysis.beats_ms), len(analysis.envelope)))
+            f.write(struct.pack(f'<{len(analysis.beats_ms)}I', *analysis.beats_ms))
+            f.write(analysis.envelope)
+    print(f'Wrote {out_path}')
+    return offsets
+
+
+def write_catalog(songs: list[Song], wav_dir: str, out_path: str, meta_path: str) -> None:
+    """Writes the jukebox's song catalog and metadata sidecar for the WAVs
+    made from songs. The gains bring every song to the median loudness of
+    the library without clipping."""
+    songs = songs[:CATALOG_MAX_SONGS]
+    analyses = []
+    for song in songs:
+        stem = os.path.splitext(os.path.basename(song.path))[0]
+        analyses.append(analyze_wav(os.path.join(wav_dir, stem + '.wav')))
+        song.length_s = analyses[-1].duration_ms / 1000
+        print(f'{song.song_id_str} {analyses[-1].tempo_bpm:5.1f} BPM  {stem}')
+    meta_offsets = write_meta(analyses, meta_path)
+
+    levels = sorted(a.rms for a in analyses if a.rms > 0)
+    target = levels[len(levels) // 2] if levels else 0
+
+    names, paths, gains = [], [], []
+    for song, analysis in zip(songs, analyses):
+        stem = os.path.splitext(os.path.basename(song.path))[0]
+        name = stem.encode('utf-8')[:CATALOG_NAME_LEN - 1].decode('utf-8', 'ignore')
+        names.append(name.encode('utf-8') + b'\0')
+        paths.append(f'/songs/{stem}.wav'.encode('utf-8'))
+        if len(paths[-1]) >= CATALOG_PATH_LEN:
+            raise ValueError(f'Song path too long for the jukebox: {paths[-1].decode()}')
+
+        gain = target / analysis.rms if analysis.rms > 0 else 1.0
+        if analysis.peak > 0:
+            gain = min(gain, 32767 / analysis.peak)
+        gains.append(min(gain, CATALOG_MAX_GAIN))
+
+    names_offset = CATALOG_HEADER.size + CATALOG_ENTRY.size * len(songs)
+    names_size = sum(len(name) for name in names)
+    path_offset = names_offset + names_size
+    with open(out_path, 'wb') as f:
+        f.write(CATALOG_HEADER.pack(CATALOG_MAGIC, CATALOG_VERSION, len(songs), CATALOG_ENTRY.size, 0,
+                                    CATALOG_HEADER.size, names_offset, names_size))
+        for path, gain, analysis, meta_offset in zip(paths, gains, analyses, meta_offsets):
+            f.write(CATALOG_ENTRY.pack(path_offset, analysis.duration_ms, meta_offset, round(gain * 256), len(path), 0))
+            path_offset += len(path)
+        f.write(b''.join(names))
+        f.write(b''.join(paths))
+    print(f'Wrote {out_path} with {len(songs)} songs')
+
+
 MARGIN_MM = 20
 BLACK = (0.0, 0.0, 0.0, 1.0)
 WHITE = (0.0, 0.0, 0.0, 0.0)
@@ -167,6 +369,5 @@ if __name__ == '__main__':
 
     p = subprocess.Popen("normalize_songs.bat")
     stdout, stderr = p.communicate()
-    
-    p = subprocess.Popen("create_directory.bat")
-    stdout, stderr = p.communicate()
\ No newline at end of file
+
+    write_catalog(song_handler.songs, 'wav', 'song_catalog.bin', 'song_meta.bin')
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include <Wire.h>
 #include <Ethernet.h>
 #include <EthernetUdp.h>
+#include <JukeboxProtocol.h>
+#include <PacketDispatcher.h>
 #include <LiquidCrystal.h>
 #include "MAX7313.h"
 #include "Animation.h"
@@ -34,15 +36,6 @@
 #define JUKEBOX_MODE_EFFECTS 2
 #define JUKEBOX_MODE_INVALID 255
 
-#define PACKET_ID_ROBBIE_MODE    1
-#define PACKET_ID_LASER_DATA     2
-#define PACKET_ID_AUDIO_DATA     3
-#define PACKET_ID_BUTTON_PRESS   4
-#define PACKET_ID_AUDIO_METADATA 5
-#define PACKET_ID_PLAY_EFFECT    6
-#define PACKET_ID_WAND_DATA      7
-#define PACKET_ID_JUKEBOX_MODE   8
-
 LiquidCrystal lcd1(LCD_RS_PIN, LCD_1_EN_PIN, LCD_DB4_PIN, LCD_DB5_PIN, LCD_DB6_PIN, LCD_DB7_PIN);
 LiquidCrystal lcd2(LCD_RS_PIN, LCD_2_EN_PIN, LCD_DB4_PIN, LCD_DB5_PIN, LCD_DB6_PIN, LCD_DB7_PIN);
 
@@ -52,14 +45,17 @@ IPAddress jukeboxIP(10, 0, 0, 32);
 IPAddress laserControllerIP(10, 0, 0, 33);
 EthernetUDP udp;
 #define PACKET_BUF_SIZE 1472
-uint8_t packetBuffer[PACKET_BUF_SIZE];
+#define RX_RING_SLOTS   4
+#define RX_BUDGET_US    2000
+PacketDispatcher<RX_RING_SLOTS, PACKET_BUF_SIZE> rx;
+WizInterrupt wizInt;
 
 uint16_t prevSelectedSongIndex = 1000;
 uint16_t prevPlayingSongIndex = 1000;
 uint8_t prevSongQueueLength = 255;
 bool updateDisplay = false;
 
-#define MAX_SONG_NAME_LEN 60
+#define MAX_SONG_NAME_LEN PROTOCOL_SONG_NAME_LEN
 uint8_t buttonsToSend[7] = { 0, 0, 0, 0, 0, 0, 0 };
 uint8_t sendMode = 0;
 uint8_t currentRobbieMode = 0;
@@ -146,11 +142,14 @@ void setup1() {
   Ethernet.begin(mac, ip);
   Ethernet.setRetransmissionCount(0);
   Ethernet.setRetransmissionTimeout(0);
-  udp.begin(8888);
+  udp.begin(PROTOCOL_PORT);
+  wizInt.begin(WIZ_INT_PIN);
+  rx.on(PACKET_ID_ROBBIE_MODE, handleRobbieMode);
+  rx.on(PACKET_ID_AUDIO_METADATA, handleAudioMetadata);
 }
 
 void loop1() {
-  checkForPacket();
+  rx.poll(udp, wizInt, RX_BUDGET_US);
   sendUDPButtons();
   sendSoundEffect();
 }
@@ -214,64 +213,64 @@ void loop() {
 
 /////////////////////////////////////////////////////////////////////
 
-void checkForPacket() {
-  int packetSize = udp.parsePacket();
-  if (packetSize) {
-    udp.read(packetBuffer, PACKET_BUF_SIZE);
-    if (packetBuffer[0] == PACKET_ID_ROBBIE_MODE && packetSize == 2) {
-      currentRobbieMode = packetBuffer[1];
-      updateDisplay = true;
-    } else if (packetBuffer[0] == PACKET_ID_AUDIO_METADATA) {
-      uint16_t selectedSongIndex = ((uint16_t)packetBuffer[1] << 8) | (uint16_t)packetBuffer[2];
-      uint16_t playingSongIndex = ((uint16_t)packetBuffer[3] << 8) | (uint16_t)packetBuffer[4];
-      uint8_t songQueueLength = packetBuffer[5];
-
-      if (selectedSongIndex != prevSelectedSongIndex || playingSongIndex != prevPlayingSongIndex ||
-          songQueueLength != prevSongQueueLength || updateDisplay) {
-      
-        prevSelectedSongIndex = selectedSongIndex;
-        prevPlayingSongIndex = playingSongIndex;
-        prevSongQueueLength = songQueueLength;
-        updateDisplay = false;
-
-        char currentSong[MAX_SONG_NAME_LEN];
-        for (int i = 0; i < MAX_SONG_NAME_LEN; i++)
-          currentSong[i] = packetBuffer[6 + songQueueLength * 2 + i];
-
-        lcd1.clear();
-        lcd1.setCursor(0, 0);
-        lcd1.print("Playing: ");
-        lcd1.print(currentSong[0] == 0 ? "None" : currentSong);
-
-        lcd1.setCursor(0, 1);
-        lcd1.print("Queue:                                  ");
-        lcd1.setCursor(7, 1);
-    
-        for (uint8_t i = 0; i < songQueueLength; i++) {
-          uint16_t songIndex = ((uint16_t)packetBuffer[6 + i * 2] << 8) | (uint16_t)packetBuffer[6 + i * 2 + 1];
-          lcd1.print((char)((songIndex / 10) + 65));
-          lcd1.print((char)((songIndex % 10) + 48));
-          lcd1.print(" ");
-          if (i == 8 && songQueueLength > 9) {
-            lcd1.print("...");
-            break;
-          }
-        }
+bool handleRobbieMode(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  robbie_mode_packet_t pkt;
+  if (!packet_decode(buf, len, &pkt) || pkt.mode > 9) return false;
+  currentRobbieMode = pkt.mode;
+  updateDisplay = true;
+  return true;
+}
 
-        lcd2.clear();
-        lcd2.setCursor(0, 0);
-        lcd2.print("Mode: ");
-        lcd2.print(currentRobbieMode);
-        lcd2.print(" - ");
-        lcd2.print(MODE_NAMES[currentRobbieMode]);
-
-        lcd2.setCursor(0, 1);
-        lcd2.print("Song Selection: ");
-        lcd2.print((char)((selectedSongIndex / 10) + 65));
-        lcd2.print((char)((selectedSongIndex % 10) + 48));
+bool handleAudioMetadata(const uint8_t *buf, size_t len, IPAddress remoteIP, uint16_t remotePort) {
+  audio_metadata_packet_t pkt;
+  if (!packet_decode(buf, len, &pkt)) return false;
+  uint16_t selectedSongIndex = pkt.selectedSong;
+  uint16_t playingSongIndex = pkt.playingSong;
+  uint8_t songQueueLength = pkt.queueLength;
+
+  if (selectedSongIndex != prevSelectedSongIndex || playingSongIndex != prevPlayingSongIndex ||
+      songQueueLength != prevSongQueueLength || updateDisplay) {
+  
+    prevSelectedSongIndex = selectedSongIndex;
+    prevPlayingSongIndex = playingSongIndex;
+    prevSongQueueLength = songQueueLength;
+    updateDisplay = false;
+
+    const char *currentSong = pkt.songName;
+
+    lcd1.clear();
+    lcd1.setCursor(0, 0);
+    lcd1.print("Playing: ");
+    lcd1.print(currentSong[0] == 0 ? "None" : currentSong);
+
+    lcd1.setCursor(0, 1);
+    lcd1.print("Queue:                                  ");
+    lcd1.setCursor(7, 1);
+
+    for (uint8_t i = 0; i < songQueueLength; i++) {
+      uint16_t songIndex = pkt.queue[i];
+      lcd1.print((char)((songIndex / 10) + 65));
+      lcd1.print((char)((songIndex % 10) + 48));
+      lcd1.print(" ");
+      if (i == 8 && songQueueLength > 9) {
+        lcd1.print("...");
+        break;
       }
     }
+
+    lcd2.clear();
+    lcd2.setCursor(0, 0);
+    lcd2.print("Mode: ");
+    lcd2.print(currentRobbieMode);
+    lcd2.print(" - ");
+    lcd2.print(MODE_NAMES[currentRobbieMode]);
+
+    lcd2.setCursor(0, 1);
+    lcd2.print("Song Selection: ");
+    lcd2.print((char)((selectedSongIndex / 10) + 65));
+    lcd2.print((char)((selectedSongIndex % 10) + 48));
   }
+  return true;
 }
 
 void checkButtons() {
@@ -336,15 +335,16 @@ void checkButtons() {
 
 void sendUDPButtons() {
   if (sendMode == 1) {
-    if (udp.beginPacket(laserControllerIP, 8888) == 1) {
-      uint8_t buf[2] = { PACKET_ID_ROBBIE_MODE, currentRobbieMode };
-      udp.write(buf, 2);
+    uint8_t buf[PACKET_MAX_LEN(robbie_mode_packet_t)];
+    size_t len = packet_encode((robbie_mode_packet_t){currentRobbieMode}, buf, sizeof(buf));
+    if (udp.beginPacket(laserControllerIP, PROTOCOL_PORT) == 1) {
+      udp.write(buf, len);
       udp.endPacket();
     }
 
-    if (udp.beginPacket(jukeboxIP, 8888) == 1) {
-      uint8_t buf[2] = { PACKET_ID_JUKEBOX_MODE, MODE_MAPPING[currentRobbieMode] };
-      udp.write(buf, 2);
+    len = packet_encode((jukebox_mode_packet_t){MODE_MAPPING[currentRobbieMode]}, buf, sizeof(buf));
+    if (udp.beginPacket(jukeboxIP, PROTOCOL_PORT) == 1) {
+      udp.write(buf, len);
       udp.endPacket();
     }
 
@@ -354,9 +354,9 @@ void sendUDPButtons() {
   for (int i = 0; i < 7; i++) {
     if (buttonsToSend[i] == 1) {
       buttonsToSend[i] = 0;
-      if (udp.beginPacket(jukeboxIP, 8888) == 1) {
-        uint8_t buf[2] = { PACKET_ID_BUTTON_PRESS, BUTTON_VAL[i] };
-        udp.write(buf, 2);
+      if (udp.beginPacket(jukeboxIP, PROTOCOL_PORT) == 1) {
+        uint8_t buf[PACKET_MAX_LEN(button_press_packet_t)];
+        udp.write(buf, packet_encode((button_press_packet_t){BUTTON_VAL[i]}, buf, sizeof(buf)));
         udp.endPacket();
       }
     }
@@ -369,14 +369,12 @@ void sendSoundEffect() {
     nextSoundEffectTime = millis() + 60000;
     int index = random(NUM_SOUND_EFFECTS);
     
-    if (udp.beginPacket(jukeboxIP, 8888) == 1) {
-      uint8_t buf[20];
-      buf[0] = PACKET_ID_PLAY_EFFECT;
-      for (int i = 0; i < strlen(soundEffects[index]); i++)
-        buf[1 + i] = (uint8_t)(soundEffects[index][i]);
-      buf[1 + strlen(soundEffects[index])] = 0;
-      
-      udp.write(buf, 2 + strlen(soundEffects[index]));
+    if (udp.beginPacket(jukeboxIP, PROTOCOL_PORT) == 1) {
+      play_effect_packet_t pkt;
+      strncpy(pkt.fileName, soundEffects[index], PROTOCOL_SONG_NAME_LEN - 1);
+      pkt.fileName[PROTOCOL_SONG_NAME_LEN - 1] = '\0';
+      uint8_t buf[PACKET_MAX_LEN(play_effect_packet_t)];
+      udp.write(buf, packet_encode(pkt, buf, sizeof(buf)));
       udp.endPacket();
     }
   }